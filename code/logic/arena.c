@@ -0,0 +1,212 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/tofu/arena.h"
+
+#define FOSSIL_TOFU_ARENA_ALIGN _Alignof(max_align_t)
+#define FOSSIL_TOFU_ARENA_ROUND(n) (((n) + FOSSIL_TOFU_ARENA_ALIGN - 1) & ~(size_t)(FOSSIL_TOFU_ARENA_ALIGN - 1))
+#define FOSSIL_TOFU_ARENA_CHUNK_HEADER FOSSIL_TOFU_ARENA_ROUND(sizeof(fossil_tofu_arena_chunk_t))
+#define FOSSIL_TOFU_ARENA_BLOCK_HEADER FOSSIL_TOFU_ARENA_ROUND(sizeof(size_t))
+
+// *****************************************************************************
+// Internal helpers
+// *****************************************************************************
+
+// Every block starts with a header holding its requested size, so realloc can
+// copy the old contents without asking the caller for them.
+static unsigned char *fossil_tofu_arena_chunk_bytes(fossil_tofu_arena_chunk_t *chunk) {
+    return (unsigned char *)chunk + FOSSIL_TOFU_ARENA_CHUNK_HEADER;
+}
+
+static fossil_tofu_arena_chunk_t *fossil_tofu_arena_new_chunk(fossil_tofu_arena_t *arena, size_t capacity) {
+    fossil_tofu_arena_chunk_t *chunk = (fossil_tofu_arena_chunk_t *)arena->parent.alloc(
+        arena->parent.context, FOSSIL_TOFU_ARENA_CHUNK_HEADER + capacity);
+    if (chunk == NULL) {
+        return NULL;
+    }
+    chunk->next = NULL;
+    chunk->capacity = capacity;
+    chunk->used = 0;
+    return chunk;
+}
+
+static tofu_memory_t fossil_tofu_arena_hook_alloc(void *context, size_t size) {
+    return fossil_tofu_arena_alloc((fossil_tofu_arena_t *)context, size);
+}
+
+static tofu_memory_t fossil_tofu_arena_hook_realloc(void *context, tofu_memory_t ptr, size_t size) {
+    fossil_tofu_arena_t *arena = (fossil_tofu_arena_t *)context;
+    if (ptr == NULL) {
+        return fossil_tofu_arena_alloc(arena, size);
+    }
+
+    unsigned char *block = (unsigned char *)ptr - FOSSIL_TOFU_ARENA_BLOCK_HEADER;
+    size_t old_size;
+    memcpy(&old_size, block, sizeof(old_size));
+    if (size <= old_size) {
+        return ptr;
+    }
+
+    // The newest block of the current chunk can grow in place
+    fossil_tofu_arena_chunk_t *chunk = arena->head;
+    if (chunk != NULL &&
+        (unsigned char *)ptr + FOSSIL_TOFU_ARENA_ROUND(old_size) == fossil_tofu_arena_chunk_bytes(chunk) + chunk->used) {
+        size_t extra = FOSSIL_TOFU_ARENA_ROUND(size) - FOSSIL_TOFU_ARENA_ROUND(old_size);
+        if (chunk->capacity - chunk->used >= extra) {
+            chunk->used += extra;
+            memcpy(block, &size, sizeof(size));
+            return ptr;
+        }
+    }
+
+    tofu_memory_t moved = fossil_tofu_arena_alloc(arena, size);
+    if (moved == NULL) {
+        return NULL;
+    }
+    memcpy(moved, ptr, old_size);
+    return moved;
+}
+
+static void fossil_tofu_arena_hook_free(void *context, tofu_memory_t ptr) {
+    // Blocks are released together with the arena
+    (void)context;
+    (void)ptr;
+}
+
+// *****************************************************************************
+// Function definitions
+// *****************************************************************************
+
+fossil_tofu_arena_t* fossil_tofu_arena_create(size_t chunk_size) {
+    const fossil_tofu_allocator_t *parent = fossil_tofu_get_allocator();
+    fossil_tofu_arena_t *arena = (fossil_tofu_arena_t *)parent->alloc(parent->context, sizeof(fossil_tofu_arena_t));
+    if (arena == NULL) {
+        return NULL;
+    }
+    arena->head = NULL;
+    arena->chunk_size = chunk_size > 0 ? FOSSIL_TOFU_ARENA_ROUND(chunk_size) : FOSSIL_TOFU_ARENA_DEFAULT_CHUNK;
+    arena->depth = 0;
+    arena->parent = *parent;
+    arena->had_saved = false;
+    return arena;
+}
+
+void fossil_tofu_arena_destroy(fossil_tofu_arena_t* arena) {
+    if (arena == NULL) {
+        return;
+    }
+    fossil_tofu_arena_chunk_t *chunk = arena->head;
+    while (chunk != NULL) {
+        fossil_tofu_arena_chunk_t *next = chunk->next;
+        arena->parent.free(arena->parent.context, chunk);
+        chunk = next;
+    }
+    fossil_tofu_allocator_t parent = arena->parent;
+    parent.free(parent.context, arena);
+}
+
+void fossil_tofu_arena_reset(fossil_tofu_arena_t* arena) {
+    if (arena == NULL || arena->head == NULL) {
+        return;
+    }
+    // The head is always a regular chunk; oversized blocks live behind it
+    fossil_tofu_arena_chunk_t *chunk = arena->head->next;
+    while (chunk != NULL) {
+        fossil_tofu_arena_chunk_t *next = chunk->next;
+        arena->parent.free(arena->parent.context, chunk);
+        chunk = next;
+    }
+    arena->head->next = NULL;
+    arena->head->used = 0;
+}
+
+tofu_memory_t fossil_tofu_arena_alloc(fossil_tofu_arena_t* arena, size_t size) {
+    if (arena == NULL || size == 0 || size > SIZE_MAX / 2) {
+        return NULL;
+    }
+    size_t need = FOSSIL_TOFU_ARENA_BLOCK_HEADER + FOSSIL_TOFU_ARENA_ROUND(size);
+
+    fossil_tofu_arena_chunk_t *chunk = arena->head;
+    if (chunk == NULL || chunk->capacity - chunk->used < need) {
+        if (need > arena->chunk_size && arena->head != NULL) {
+            // Oversized blocks get their own chunk so the current one keeps filling
+            chunk = fossil_tofu_arena_new_chunk(arena, need);
+            if (chunk == NULL) {
+                return NULL;
+            }
+            chunk->next = arena->head->next;
+            arena->head->next = chunk;
+        } else {
+            chunk = fossil_tofu_arena_new_chunk(arena, need > arena->chunk_size ? need : arena->chunk_size);
+            if (chunk == NULL) {
+                return NULL;
+            }
+            chunk->next = arena->head;
+            arena->head = chunk;
+        }
+    }
+
+    unsigned char *block = fossil_tofu_arena_chunk_bytes(chunk) + chunk->used;
+    chunk->used += need;
+    memcpy(block, &size, sizeof(size));
+    return block + FOSSIL_TOFU_ARENA_BLOCK_HEADER;
+}
+
+size_t fossil_tofu_arena_used(const fossil_tofu_arena_t* arena) {
+    size_t used = 0;
+    for (const fossil_tofu_arena_chunk_t *chunk = arena ? arena->head : NULL; chunk != NULL; chunk = chunk->next) {
+        used += chunk->used;
+    }
+    return used;
+}
+
+fossil_tofu_allocator_t fossil_tofu_arena_allocator(fossil_tofu_arena_t* arena) {
+    fossil_tofu_allocator_t allocator = {
+        fossil_tofu_arena_hook_alloc,
+        fossil_tofu_arena_hook_realloc,
+        fossil_tofu_arena_hook_free,
+        arena
+    };
+    return allocator;
+}
+
+void fossil_tofu_arena_enter(fossil_tofu_arena_t* arena) {
+    if (arena == NULL || arena->depth++ > 0) {
+        return;
+    }
+    const fossil_tofu_allocator_t *current = fossil_tofu_get_thread_allocator();
+    arena->had_saved = current != NULL;
+    if (current != NULL) {
+        arena->saved = *current;
+    }
+    fossil_tofu_allocator_t hooks = fossil_tofu_arena_allocator(arena);
+    fossil_tofu_set_thread_allocator(&hooks);
+}
+
+void fossil_tofu_arena_leave(fossil_tofu_arena_t* arena) {
+    if (arena == NULL || arena->depth == 0 || --arena->depth > 0) {
+        return;
+    }
+    fossil_tofu_set_thread_allocator(arena->had_saved ? &arena->saved : NULL);
+}
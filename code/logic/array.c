@@ -29,7 +29,8 @@
 // *****************************************************************************
 
 fossil_tofu_array_t* fossil_tofu_array_create_container(char* type) {
-    if (type == NULL || fossil_tofu_validate_type(type) == FOSSIL_TOFU_TYPE_CNULL) {
+    fossil_tofu_type_t type_enum = type == NULL ? FOSSIL_TOFU_TYPE_CNULL : fossil_tofu_validate_type(type);
+    if (type_enum == FOSSIL_TOFU_TYPE_CNULL) {
         return NULL;
     }
     fossil_tofu_array_t* array = (fossil_tofu_array_t*)fossil_tofu_alloc(sizeof(fossil_tofu_array_t));
@@ -44,6 +45,7 @@ fossil_tofu_array_t* fossil_tofu_array_create_container(char* type) {
     array->size = 0;
     array->capacity = INITIAL_CAPACITY;
     array->type = type;
+    array->type_enum = type_enum;
     return array;
 }
 
@@ -52,7 +54,7 @@ fossil_tofu_array_t* fossil_tofu_array_create_default(void) {
 }
 
 fossil_tofu_array_t* fossil_tofu_array_create_copy(const fossil_tofu_array_t* other) {
-    if (other == NULL || other->type == NULL || fossil_tofu_validate_type(other->type) == FOSSIL_TOFU_TYPE_CNULL) {
+    if (other == NULL || other->type == NULL || other->type_enum == FOSSIL_TOFU_TYPE_CNULL) {
         return NULL;
     }
     fossil_tofu_array_t* array = (fossil_tofu_array_t*)fossil_tofu_alloc(sizeof(fossil_tofu_array_t));
@@ -67,8 +69,9 @@ fossil_tofu_array_t* fossil_tofu_array_create_copy(const fossil_tofu_array_t* ot
     array->size = other->size;
     array->capacity = other->capacity;
     array->type = other->type;
+    array->type_enum = other->type_enum;
     for (size_t i = 0; i < other->size; i++) {
-        if (fossil_tofu_get_type(&other->data[i]) != fossil_tofu_validate_type(other->type)) {
+        if (fossil_tofu_get_type(&other->data[i]) != other->type_enum) {
             // Type mismatch encountered
             fossil_tofu_free(array->data);
             fossil_tofu_free(array);
@@ -80,7 +83,7 @@ fossil_tofu_array_t* fossil_tofu_array_create_copy(const fossil_tofu_array_t* ot
 }
 
 fossil_tofu_array_t* fossil_tofu_array_create_move(fossil_tofu_array_t* other) {
-    if (other == NULL || other->type == NULL || fossil_tofu_validate_type(other->type) == FOSSIL_TOFU_TYPE_CNULL) {
+    if (other == NULL || other->type == NULL || other->type_enum == FOSSIL_TOFU_TYPE_CNULL) {
         return NULL;
     }
     fossil_tofu_array_t* array = (fossil_tofu_array_t*)fossil_tofu_alloc(sizeof(fossil_tofu_array_t));
@@ -91,10 +94,12 @@ fossil_tofu_array_t* fossil_tofu_array_create_move(fossil_tofu_array_t* other) {
     array->size = other->size;
     array->capacity = other->capacity;
     array->type = other->type;
+    array->type_enum = other->type_enum;
     other->data = NULL;
     other->size = 0;
     other->capacity = 0;
     other->type = NULL;
+    other->type_enum = FOSSIL_TOFU_TYPE_CNULL;
     return array;
 }
 
@@ -122,7 +127,31 @@ void fossil_tofu_array_push_back(fossil_tofu_array_t* array, char *element) {
         array->data = new_data;
         array->capacity *= 2;
     }
-    array->data[array->size++] = fossil_tofu_create(array->type, element);
+    array->data[array->size++] = fossil_tofu_create_typed(array->type_enum, element);
+}
+
+int32_t fossil_tofu_array_push_back_many(fossil_tofu_array_t* array, char **elements, size_t count) {
+    if (array == NULL || elements == NULL) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    // Reserve room for the whole batch at once instead of doubling per element
+    if (array->size + count > array->capacity) {
+        size_t new_capacity = array->capacity * 2;
+        if (new_capacity < array->size + count) {
+            new_capacity = array->size + count;
+        }
+        fossil_tofu_t* new_data = (fossil_tofu_t*)fossil_tofu_realloc(array->data, new_capacity * sizeof(fossil_tofu_t));
+        if (new_data == NULL) {
+            return FOSSIL_TOFU_FAILURE;
+        }
+        array->data = new_data;
+        array->capacity = new_capacity;
+    }
+    if (fossil_tofu_create_batch(array->type_enum, (const char *const *)elements, count, array->data + array->size) != FOSSIL_TOFU_SUCCESS) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    array->size += count;
+    return FOSSIL_TOFU_SUCCESS;
 }
 
 void fossil_tofu_array_push_front(fossil_tofu_array_t* array, char *element) {
@@ -145,7 +174,7 @@ void fossil_tofu_array_push_front(fossil_tofu_array_t* array, char *element) {
             array->data[i] = array->data[i - 1];
         }
     }
-    array->data[0] = fossil_tofu_create(array->type, element);
+    array->data[0] = fossil_tofu_create_typed(array->type_enum, element);
     array->size++;
 }
 
@@ -172,7 +201,7 @@ void fossil_tofu_array_push_at(fossil_tofu_array_t* array, size_t index, char *e
             array->data[i] = array->data[i - 1];
         }
     }
-    array->data[index] = fossil_tofu_create(array->type, element);
+    array->data[index] = fossil_tofu_create_typed(array->type_enum, element);
     array->size++;
 }
 
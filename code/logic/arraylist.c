@@ -29,7 +29,8 @@
 // *****************************************************************************
 
 fossil_tofu_arraylist_t* fossil_tofu_arraylist_create_container(char* type, size_t capacity) {
-    if (type == NULL || fossil_tofu_validate_type(type) == FOSSIL_TOFU_TYPE_CNULL) {
+    fossil_tofu_type_t type_enum = type == NULL ? FOSSIL_TOFU_TYPE_CNULL : fossil_tofu_validate_type(type);
+    if (type_enum == FOSSIL_TOFU_TYPE_CNULL) {
         return NULL;
     }
     fossil_tofu_arraylist_t* alist = (fossil_tofu_arraylist_t*)fossil_tofu_alloc(sizeof(fossil_tofu_arraylist_t));
@@ -37,6 +38,7 @@ fossil_tofu_arraylist_t* fossil_tofu_arraylist_create_container(char* type, size
         return NULL;
     }
     alist->type = fossil_tofu_strdup(type);
+    alist->type_enum = type_enum;
     alist->size = 0;
     alist->capacity = capacity;
     alist->items = (fossil_tofu_arraylist_node_t*)fossil_tofu_alloc(sizeof(fossil_tofu_arraylist_node_t) * capacity);
@@ -58,7 +60,7 @@ fossil_tofu_arraylist_t* fossil_tofu_arraylist_create_copy(const fossil_tofu_arr
     if (alist == NULL) return NULL;
     alist->size = other->size;
     for (size_t i = 0; i < other->size; ++i) {
-        alist->items[i].data = fossil_tofu_create(other->type, fossil_tofu_get_value(&other->items[i].data));
+        alist->items[i].data = fossil_tofu_create_typed(alist->type_enum, fossil_tofu_get_value(&other->items[i].data));
     }
     return alist;
 }
@@ -68,10 +70,12 @@ fossil_tofu_arraylist_t* fossil_tofu_arraylist_create_move(fossil_tofu_arraylist
     fossil_tofu_arraylist_t* alist = (fossil_tofu_arraylist_t*)fossil_tofu_alloc(sizeof(fossil_tofu_arraylist_t));
     if (alist == NULL) return NULL;
     alist->type = other->type;
+    alist->type_enum = other->type_enum;
     alist->size = other->size;
     alist->capacity = other->capacity;
     alist->items = other->items;
     other->type = NULL;
+    other->type_enum = FOSSIL_TOFU_TYPE_CNULL;
     other->items = NULL;
     other->size = 0;
     other->capacity = 0;
@@ -105,11 +109,37 @@ int32_t fossil_tofu_arraylist_insert(fossil_tofu_arraylist_t* alist, char *data)
         alist->items = new_items;
         alist->capacity = new_capacity;
     }
-    alist->items[alist->size].data = fossil_tofu_create(alist->type, data);
+    alist->items[alist->size].data = fossil_tofu_create_typed(alist->type_enum, data);
     alist->size++;
     return FOSSIL_TOFU_SUCCESS;
 }
 
+int32_t fossil_tofu_arraylist_insert_many(fossil_tofu_arraylist_t* alist, char **data, size_t count) {
+    if (alist == NULL || data == NULL) return FOSSIL_TOFU_FAILURE;
+    if (count == 0) return FOSSIL_TOFU_SUCCESS;
+    // Reserve room for the whole batch at once instead of doubling per element
+    if (alist->size + count > alist->capacity) {
+        size_t new_capacity = alist->capacity * 2;
+        if (new_capacity < alist->size + count) new_capacity = alist->size + count;
+        fossil_tofu_arraylist_node_t* new_items = (fossil_tofu_arraylist_node_t*)fossil_tofu_realloc(alist->items, sizeof(fossil_tofu_arraylist_node_t) * new_capacity);
+        if (new_items == NULL) return FOSSIL_TOFU_FAILURE;
+        alist->items = new_items;
+        alist->capacity = new_capacity;
+    }
+    fossil_tofu_t* batch = (fossil_tofu_t*)fossil_tofu_alloc(sizeof(fossil_tofu_t) * count);
+    if (batch == NULL) return FOSSIL_TOFU_FAILURE;
+    if (fossil_tofu_create_batch(alist->type_enum, (const char *const *)data, count, batch) != FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_free(batch);
+        return FOSSIL_TOFU_FAILURE;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        alist->items[alist->size + i].data = batch[i];
+    }
+    fossil_tofu_free(batch);
+    alist->size += count;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
 int32_t fossil_tofu_arraylist_remove(fossil_tofu_arraylist_t* alist, size_t index) {
     if (alist == NULL || index >= alist->size) return FOSSIL_TOFU_FAILURE;
     fossil_tofu_destroy(&alist->items[index].data);
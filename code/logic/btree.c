@@ -0,0 +1,744 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/tofu/btree.h"
+
+// *****************************************************************************
+// Node helpers
+// *****************************************************************************
+
+static fossil_tofu_btree_node_t* fossil_tofu_btree_node_create(bool leaf) {
+    fossil_tofu_btree_node_t* node = (fossil_tofu_btree_node_t*)fossil_tofu_alloc(sizeof(fossil_tofu_btree_node_t));
+    if (node == NULL) {
+        return NULL;
+    }
+    node->count = 0;
+    node->leaf = leaf;
+    node->prev = NULL;
+    node->next = NULL;
+    return node;
+}
+
+// Destroys the keys of `node` and of every node under it.
+static void fossil_tofu_btree_node_destroy(fossil_tofu_btree_node_t* node) {
+    if (!node->leaf) {
+        for (size_t i = 0; i <= node->count; i++) {
+            fossil_tofu_btree_node_destroy(node->children[i]);
+        }
+    }
+    for (size_t i = 0; i < node->count; i++) {
+        fossil_tofu_destroy(&node->keys[i]);
+    }
+    fossil_tofu_free(node);
+}
+
+// Returns the first index in `node` whose key is not less than `key`.
+static size_t fossil_tofu_btree_lower_index(const fossil_tofu_btree_node_t* node, const fossil_tofu_t* key) {
+    size_t low = 0;
+    size_t high = node->count;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (fossil_tofu_compare(&node->keys[mid], key) < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+// Returns the first index in `node` whose key is greater than `key`.
+static size_t fossil_tofu_btree_upper_index(const fossil_tofu_btree_node_t* node, const fossil_tofu_t* key) {
+    size_t low = 0;
+    size_t high = node->count;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (fossil_tofu_compare(&node->keys[mid], key) <= 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+// Descends from a non-empty root to the leaf that holds or would hold `key`.
+static const fossil_tofu_btree_node_t* fossil_tofu_btree_find_leaf(const fossil_tofu_btree_t* tree, const fossil_tofu_t* key) {
+    const fossil_tofu_btree_node_t* node = tree->root;
+    while (!node->leaf) {
+        node = node->children[fossil_tofu_btree_upper_index(node, key)];
+    }
+    return node;
+}
+
+// Returns the smallest key stored under `node`.
+static const fossil_tofu_t* fossil_tofu_btree_subtree_min(const fossil_tofu_btree_node_t* node) {
+    while (!node->leaf) {
+        node = node->children[0];
+    }
+    return &node->keys[0];
+}
+
+// Builds an iterator, stepping into the next leaf when `index` is one past the end.
+static fossil_tofu_btree_iterator_t fossil_tofu_btree_make_iterator(const fossil_tofu_btree_node_t* leaf, size_t index) {
+    fossil_tofu_btree_iterator_t iterator;
+    while (leaf != NULL && index >= leaf->count) {
+        leaf = leaf->next;
+        index = 0;
+    }
+    iterator.leaf = leaf;
+    iterator.index = index;
+    return iterator;
+}
+
+// Builds the tree bottom-up from `count` distinct keys in ascending order,
+// taking ownership of them even on failure. The tree must be empty.
+static bool fossil_tofu_btree_build(fossil_tofu_btree_t* tree, fossil_tofu_t* keys, size_t count) {
+    if (count == 0) {
+        return true;
+    }
+    size_t total = 0;
+    for (size_t width = (count + FOSSIL_TOFU_BTREE_ORDER - 1) / FOSSIL_TOFU_BTREE_ORDER;; width = (width + FOSSIL_TOFU_BTREE_ORDER) / (FOSSIL_TOFU_BTREE_ORDER + 1)) {
+        total += width;
+        if (width == 1) {
+            break;
+        }
+    }
+    fossil_tofu_btree_node_t** made = (fossil_tofu_btree_node_t**)fossil_tofu_alloc(total * sizeof(fossil_tofu_btree_node_t*));
+    size_t made_count = 0;
+    size_t leaves = (count + FOSSIL_TOFU_BTREE_ORDER - 1) / FOSSIL_TOFU_BTREE_ORDER;
+    for (size_t i = 0; made != NULL && i < leaves; i++) {
+        fossil_tofu_btree_node_t* leaf = fossil_tofu_btree_node_create(true);
+        if (leaf == NULL) {
+            break;
+        }
+        made[made_count++] = leaf;
+    }
+    if (made_count < leaves) {
+        for (size_t i = 0; i < made_count; i++) {
+            fossil_tofu_free(made[i]);
+        }
+        fossil_tofu_free(made);
+        for (size_t i = 0; i < count; i++) {
+            fossil_tofu_destroy(&keys[i]);
+        }
+        return false;
+    }
+
+    // Spread the keys evenly so every leaf is at least half full
+    size_t offset = 0;
+    for (size_t i = 0; i < leaves; i++) {
+        fossil_tofu_btree_node_t* leaf = made[i];
+        size_t share = count / leaves + (i < count % leaves ? 1 : 0);
+        for (size_t j = 0; j < share; j++) {
+            leaf->keys[j] = keys[offset + j];
+        }
+        leaf->count = share;
+        offset += share;
+        leaf->prev = i > 0 ? made[i - 1] : NULL;
+        leaf->next = i + 1 < leaves ? made[i + 1] : NULL;
+    }
+
+    // Each pass groups one level of nodes under new parents the same way
+    size_t level = 0;
+    size_t width = leaves;
+    while (width > 1) {
+        size_t parents = (width + FOSSIL_TOFU_BTREE_ORDER) / (FOSSIL_TOFU_BTREE_ORDER + 1);
+        size_t next_level = made_count;
+        size_t child = level;
+        for (size_t p = 0; p < parents; p++) {
+            fossil_tofu_btree_node_t* parent = fossil_tofu_btree_node_create(false);
+            if (parent == NULL) {
+                goto fail;
+            }
+            made[made_count++] = parent;
+            size_t share = width / parents + (p < width % parents ? 1 : 0);
+            parent->children[0] = made[child];
+            for (size_t j = 1; j < share; j++) {
+                fossil_tofu_t* separator = &parent->keys[j - 1];
+                *separator = (fossil_tofu_t){0};
+                if (fossil_tofu_copy(separator, fossil_tofu_btree_subtree_min(made[child + j])) != FOSSIL_TOFU_SUCCESS) {
+                    fossil_tofu_destroy(separator);
+                    goto fail;
+                }
+                parent->children[j] = made[child + j];
+                parent->count = j;
+            }
+            child += share;
+        }
+        level = next_level;
+        width = parents;
+    }
+
+    tree->root = made[level];
+    tree->first = made[0];
+    tree->last = made[leaves - 1];
+    tree->size = count;
+    fossil_tofu_free(made);
+    return true;
+
+fail:
+    // Every node made so far owns exactly its first `count` keys
+    for (size_t i = 0; i < made_count; i++) {
+        for (size_t j = 0; j < made[i]->count; j++) {
+            fossil_tofu_destroy(&made[i]->keys[j]);
+        }
+        fossil_tofu_free(made[i]);
+    }
+    fossil_tofu_free(made);
+    return false;
+}
+
+// *****************************************************************************
+// Rebalancing helpers
+// *****************************************************************************
+
+// Moves the last key of the left sibling into `parent->children[index]`.
+static bool fossil_tofu_btree_borrow_left(fossil_tofu_btree_node_t* parent, size_t index) {
+    fossil_tofu_btree_node_t* child = parent->children[index];
+    fossil_tofu_btree_node_t* left = parent->children[index - 1];
+    if (child->leaf) {
+        // The moved key becomes the new separator, so copy it before changing anything
+        fossil_tofu_t separator = {0};
+        if (fossil_tofu_copy(&separator, &left->keys[left->count - 1]) != FOSSIL_TOFU_SUCCESS) {
+            fossil_tofu_destroy(&separator);
+            return false;
+        }
+        memmove(&child->keys[1], &child->keys[0], child->count * sizeof(fossil_tofu_t));
+        child->keys[0] = left->keys[--left->count];
+        fossil_tofu_destroy(&parent->keys[index - 1]);
+        parent->keys[index - 1] = separator;
+    } else {
+        // Rotate through the parent: its separator comes down, the sibling's last key goes up
+        memmove(&child->keys[1], &child->keys[0], child->count * sizeof(fossil_tofu_t));
+        memmove(&child->children[1], &child->children[0], (child->count + 1) * sizeof(fossil_tofu_btree_node_t*));
+        child->keys[0] = parent->keys[index - 1];
+        child->children[0] = left->children[left->count];
+        parent->keys[index - 1] = left->keys[--left->count];
+    }
+    child->count++;
+    return true;
+}
+
+// Moves the first key of the right sibling into `parent->children[index]`.
+static bool fossil_tofu_btree_borrow_right(fossil_tofu_btree_node_t* parent, size_t index) {
+    fossil_tofu_btree_node_t* child = parent->children[index];
+    fossil_tofu_btree_node_t* right = parent->children[index + 1];
+    if (child->leaf) {
+        // The sibling's second key becomes its first and the new separator
+        fossil_tofu_t separator = {0};
+        if (fossil_tofu_copy(&separator, &right->keys[1]) != FOSSIL_TOFU_SUCCESS) {
+            fossil_tofu_destroy(&separator);
+            return false;
+        }
+        child->keys[child->count] = right->keys[0];
+        memmove(&right->keys[0], &right->keys[1], (right->count - 1) * sizeof(fossil_tofu_t));
+        fossil_tofu_destroy(&parent->keys[index]);
+        parent->keys[index] = separator;
+    } else {
+        child->keys[child->count] = parent->keys[index];
+        child->children[child->count + 1] = right->children[0];
+        parent->keys[index] = right->keys[0];
+        memmove(&right->keys[0], &right->keys[1], (right->count - 1) * sizeof(fossil_tofu_t));
+        memmove(&right->children[0], &right->children[1], right->count * sizeof(fossil_tofu_btree_node_t*));
+    }
+    child->count++;
+    right->count--;
+    return true;
+}
+
+// Folds `parent->children[index + 1]` into `parent->children[index]`.
+static void fossil_tofu_btree_merge(fossil_tofu_btree_t* tree, fossil_tofu_btree_node_t* parent, size_t index) {
+    fossil_tofu_btree_node_t* left = parent->children[index];
+    fossil_tofu_btree_node_t* right = parent->children[index + 1];
+    if (left->leaf) {
+        memcpy(&left->keys[left->count], &right->keys[0], right->count * sizeof(fossil_tofu_t));
+        left->count += right->count;
+        left->next = right->next;
+        if (right->next != NULL) {
+            right->next->prev = left;
+        } else {
+            tree->last = left;
+        }
+        fossil_tofu_destroy(&parent->keys[index]);
+    } else {
+        // The separator comes down between the two halves
+        left->keys[left->count] = parent->keys[index];
+        memcpy(&left->keys[left->count + 1], &right->keys[0], right->count * sizeof(fossil_tofu_t));
+        memcpy(&left->children[left->count + 1], &right->children[0], (right->count + 1) * sizeof(fossil_tofu_btree_node_t*));
+        left->count += right->count + 1;
+    }
+    fossil_tofu_free(right);
+    memmove(&parent->keys[index], &parent->keys[index + 1], (parent->count - index - 1) * sizeof(fossil_tofu_t));
+    memmove(&parent->children[index + 1], &parent->children[index + 2], (parent->count - index - 1) * sizeof(fossil_tofu_btree_node_t*));
+    parent->count--;
+}
+
+// Tops up the underfull `parent->children[index]` from a sibling, or merges it with one.
+static void fossil_tofu_btree_rebalance_child(fossil_tofu_btree_t* tree, fossil_tofu_btree_node_t* parent, size_t index) {
+    fossil_tofu_btree_node_t* child = parent->children[index];
+    fossil_tofu_btree_node_t* left = index > 0 ? parent->children[index - 1] : NULL;
+    fossil_tofu_btree_node_t* right = index < parent->count ? parent->children[index + 1] : NULL;
+    size_t joint = child->leaf ? 0 : 1; // Internal merges also take the separator
+    if (left != NULL && left->count > FOSSIL_TOFU_BTREE_MIN_KEYS && fossil_tofu_btree_borrow_left(parent, index)) {
+        return;
+    }
+    if (right != NULL && right->count > FOSSIL_TOFU_BTREE_MIN_KEYS && fossil_tofu_btree_borrow_right(parent, index)) {
+        return;
+    }
+    if (left != NULL && left->count + joint + child->count <= FOSSIL_TOFU_BTREE_ORDER) {
+        fossil_tofu_btree_merge(tree, parent, index - 1);
+    } else if (right != NULL && child->count + joint + right->count <= FOSSIL_TOFU_BTREE_ORDER) {
+        fossil_tofu_btree_merge(tree, parent, index);
+    }
+    // Otherwise a separator copy failed to allocate; the child stays underfull,
+    // which costs space but not correctness
+}
+
+// *****************************************************************************
+// Function prototypes
+// *****************************************************************************
+
+// Creates an empty tree with an already resolved type, so copies and moves
+// never re-parse a type string the source tree may no longer own.
+static fossil_tofu_btree_t* fossil_tofu_btree_create_as(char* type, fossil_tofu_type_t type_enum) {
+    fossil_tofu_btree_t* tree = (fossil_tofu_btree_t*)fossil_tofu_alloc(sizeof(fossil_tofu_btree_t));
+    if (tree == NULL) {
+        return NULL;
+    }
+    tree->type = type;
+    tree->type_enum = type_enum;
+    tree->root = NULL;
+    tree->first = NULL;
+    tree->last = NULL;
+    tree->size = 0;
+    return tree;
+}
+
+fossil_tofu_btree_t* fossil_tofu_btree_create_container(char* type) {
+    fossil_tofu_type_t type_enum = fossil_tofu_validate_type(type);
+    if (type_enum == FOSSIL_TOFU_TYPE_CNULL) {
+        return NULL;
+    }
+    return fossil_tofu_btree_create_as(type, type_enum);
+}
+
+fossil_tofu_btree_t* fossil_tofu_btree_create_default(void) {
+    return fossil_tofu_btree_create_container("any");
+}
+
+fossil_tofu_btree_t* fossil_tofu_btree_create_copy(const fossil_tofu_btree_t* other) {
+    if (other == NULL) {
+        return NULL;
+    }
+    fossil_tofu_btree_t* tree = fossil_tofu_btree_create_as(other->type, other->type_enum);
+    if (tree == NULL || other->size == 0) {
+        return tree;
+    }
+    fossil_tofu_t* keys = (fossil_tofu_t*)fossil_tofu_alloc(other->size * sizeof(fossil_tofu_t));
+    if (keys == NULL) {
+        fossil_tofu_btree_destroy(tree);
+        return NULL;
+    }
+    // The leaves already hold the keys in order, so the copy is bulk loaded
+    size_t count = 0;
+    for (const fossil_tofu_btree_node_t* leaf = other->first; leaf != NULL; leaf = leaf->next) {
+        for (size_t i = 0; i < leaf->count; i++) {
+            keys[count] = (fossil_tofu_t){0};
+            if (fossil_tofu_copy(&keys[count], &leaf->keys[i]) != FOSSIL_TOFU_SUCCESS) {
+                for (size_t j = 0; j <= count; j++) {
+                    fossil_tofu_destroy(&keys[j]);
+                }
+                fossil_tofu_free(keys);
+                fossil_tofu_btree_destroy(tree);
+                return NULL;
+            }
+            count++;
+        }
+    }
+    bool built = fossil_tofu_btree_build(tree, keys, count);
+    fossil_tofu_free(keys);
+    if (!built) {
+        fossil_tofu_btree_destroy(tree);
+        return NULL;
+    }
+    return tree;
+}
+
+fossil_tofu_btree_t* fossil_tofu_btree_create_move(fossil_tofu_btree_t* other) {
+    if (other == NULL) {
+        return NULL;
+    }
+    fossil_tofu_btree_t* tree = fossil_tofu_btree_create_as(other->type, other->type_enum);
+    if (tree == NULL) {
+        return NULL;
+    }
+    tree->root = other->root;
+    tree->first = other->first;
+    tree->last = other->last;
+    tree->size = other->size;
+    other->root = NULL;
+    other->first = NULL;
+    other->last = NULL;
+    other->size = 0;
+    return tree;
+}
+
+void fossil_tofu_btree_destroy(fossil_tofu_btree_t* tree) {
+    if (tree == NULL) {
+        return;
+    }
+    fossil_tofu_btree_clear(tree);
+    fossil_tofu_free(tree);
+}
+
+int32_t fossil_tofu_btree_insert(fossil_tofu_btree_t* tree, char *data) {
+    if (tree == NULL || data == NULL) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    if (tree->root == NULL) {
+        fossil_tofu_btree_node_t* leaf = fossil_tofu_btree_node_create(true);
+        if (leaf == NULL) {
+            return FOSSIL_TOFU_FAILURE;
+        }
+        leaf->keys[0] = fossil_tofu_create_typed(tree->type_enum, data);
+        leaf->count = 1;
+        tree->root = leaf;
+        tree->first = leaf;
+        tree->last = leaf;
+        tree->size = 1;
+        return FOSSIL_TOFU_SUCCESS;
+    }
+
+    fossil_tofu_t view = fossil_tofu_view_typed(tree->type_enum, data);
+    fossil_tofu_btree_node_t* path[FOSSIL_TOFU_BTREE_MAX_DEPTH];
+    size_t slots[FOSSIL_TOFU_BTREE_MAX_DEPTH];
+    size_t depth = 0;
+    fossil_tofu_btree_node_t* node = tree->root;
+    while (!node->leaf) {
+        path[depth] = node;
+        slots[depth] = fossil_tofu_btree_upper_index(node, &view);
+        node = node->children[slots[depth]];
+        depth++;
+    }
+    size_t pos = fossil_tofu_btree_lower_index(node, &view);
+    if (pos < node->count && fossil_tofu_compare(&node->keys[pos], &view) == 0) {
+        return FOSSIL_TOFU_SUCCESS; // Already a member
+    }
+    fossil_tofu_t key = fossil_tofu_create_typed(tree->type_enum, data);
+    if (node->count < FOSSIL_TOFU_BTREE_ORDER) {
+        memmove(&node->keys[pos + 1], &node->keys[pos], (node->count - pos) * sizeof(fossil_tofu_t));
+        node->keys[pos] = key;
+        node->count++;
+        tree->size++;
+        return FOSSIL_TOFU_SUCCESS;
+    }
+
+    // The leaf is full. Allocate everything the split can need up front, so a
+    // failure leaves the tree untouched: one node per full level plus a new root.
+    fossil_tofu_btree_node_t* spare[FOSSIL_TOFU_BTREE_MAX_DEPTH + 2];
+    size_t needed = 1;
+    size_t level = depth;
+    while (level > 0 && path[level - 1]->count == FOSSIL_TOFU_BTREE_ORDER) {
+        level--;
+        needed++;
+    }
+    if (level == 0) {
+        needed++;
+    }
+    size_t mid = (FOSSIL_TOFU_BTREE_ORDER + 1) / 2;
+    const fossil_tofu_t* first_right = mid < pos ? &node->keys[mid] : (mid == pos ? &key : &node->keys[mid - 1]);
+    fossil_tofu_t carry_key = {0};
+    bool ready = fossil_tofu_copy(&carry_key, first_right) == FOSSIL_TOFU_SUCCESS;
+    size_t made = 0;
+    while (ready && made < needed) {
+        spare[made] = fossil_tofu_btree_node_create(made == 0);
+        if (spare[made] == NULL) {
+            ready = false;
+            break;
+        }
+        made++;
+    }
+    if (!ready) {
+        while (made > 0) {
+            fossil_tofu_free(spare[--made]);
+        }
+        fossil_tofu_destroy(&carry_key);
+        fossil_tofu_destroy(&key);
+        return FOSSIL_TOFU_FAILURE;
+    }
+
+    // Split the leaf: the lower half stays, the upper half moves to a new right leaf
+    fossil_tofu_t keys[FOSSIL_TOFU_BTREE_ORDER + 1];
+    memcpy(&keys[0], &node->keys[0], pos * sizeof(fossil_tofu_t));
+    keys[pos] = key;
+    memcpy(&keys[pos + 1], &node->keys[pos], (FOSSIL_TOFU_BTREE_ORDER - pos) * sizeof(fossil_tofu_t));
+    fossil_tofu_btree_node_t* right = spare[0];
+    memcpy(&node->keys[0], &keys[0], mid * sizeof(fossil_tofu_t));
+    node->count = mid;
+    memcpy(&right->keys[0], &keys[mid], (FOSSIL_TOFU_BTREE_ORDER + 1 - mid) * sizeof(fossil_tofu_t));
+    right->count = FOSSIL_TOFU_BTREE_ORDER + 1 - mid;
+    right->prev = node;
+    right->next = node->next;
+    if (node->next != NULL) {
+        node->next->prev = right;
+    } else {
+        tree->last = right;
+    }
+    node->next = right;
+    tree->size++;
+
+    // Push the separator up, splitting full parents on the way
+    fossil_tofu_btree_node_t* carry_child = right;
+    size_t used = 1;
+    while (depth > 0) {
+        fossil_tofu_btree_node_t* parent = path[--depth];
+        size_t index = slots[depth];
+        if (parent->count < FOSSIL_TOFU_BTREE_ORDER) {
+            memmove(&parent->keys[index + 1], &parent->keys[index], (parent->count - index) * sizeof(fossil_tofu_t));
+            memmove(&parent->children[index + 2], &parent->children[index + 1], (parent->count - index) * sizeof(fossil_tofu_btree_node_t*));
+            parent->keys[index] = carry_key;
+            parent->children[index + 1] = carry_child;
+            parent->count++;
+            return FOSSIL_TOFU_SUCCESS;
+        }
+        fossil_tofu_btree_node_t* children[FOSSIL_TOFU_BTREE_ORDER + 2];
+        memcpy(&keys[0], &parent->keys[0], index * sizeof(fossil_tofu_t));
+        keys[index] = carry_key;
+        memcpy(&keys[index + 1], &parent->keys[index], (FOSSIL_TOFU_BTREE_ORDER - index) * sizeof(fossil_tofu_t));
+        memcpy(&children[0], &parent->children[0], (index + 1) * sizeof(fossil_tofu_btree_node_t*));
+        children[index + 1] = carry_child;
+        memcpy(&children[index + 2], &parent->children[index + 1], (FOSSIL_TOFU_BTREE_ORDER - index) * sizeof(fossil_tofu_btree_node_t*));
+
+        // The middle key moves up rather than being copied
+        size_t half = FOSSIL_TOFU_BTREE_ORDER / 2;
+        fossil_tofu_btree_node_t* sibling = spare[used++];
+        memcpy(&parent->keys[0], &keys[0], half * sizeof(fossil_tofu_t));
+        memcpy(&parent->children[0], &children[0], (half + 1) * sizeof(fossil_tofu_btree_node_t*));
+        parent->count = half;
+        memcpy(&sibling->keys[0], &keys[half + 1], (FOSSIL_TOFU_BTREE_ORDER - half) * sizeof(fossil_tofu_t));
+        memcpy(&sibling->children[0], &children[half + 1], (FOSSIL_TOFU_BTREE_ORDER - half + 1) * sizeof(fossil_tofu_btree_node_t*));
+        sibling->count = FOSSIL_TOFU_BTREE_ORDER - half;
+        carry_key = keys[half];
+        carry_child = sibling;
+    }
+
+    // The root itself split: grow the tree by one level
+    fossil_tofu_btree_node_t* root = spare[used];
+    root->keys[0] = carry_key;
+    root->children[0] = tree->root;
+    root->children[1] = carry_child;
+    root->count = 1;
+    tree->root = root;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_btree_bulk_load(fossil_tofu_btree_t* tree, char **data, size_t count) {
+    if (tree == NULL || data == NULL || tree->root != NULL) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    if (count == 0) {
+        return FOSSIL_TOFU_SUCCESS;
+    }
+    fossil_tofu_t* keys = (fossil_tofu_t*)fossil_tofu_alloc(count * sizeof(fossil_tofu_t));
+    if (keys == NULL) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    if (fossil_tofu_create_batch(tree->type_enum, (const char *const *)data, count, keys) != FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_free(keys);
+        return FOSSIL_TOFU_FAILURE;
+    }
+
+    // Drop repeats in place and reject input that goes backwards
+    size_t unique = 0;
+    for (size_t i = 0; i < count; i++) {
+        int cmp = unique > 0 ? fossil_tofu_compare(&keys[unique - 1], &keys[i]) : -1;
+        if (cmp > 0) {
+            for (size_t j = 0; j < unique; j++) {
+                fossil_tofu_destroy(&keys[j]);
+            }
+            for (size_t j = i; j < count; j++) {
+                fossil_tofu_destroy(&keys[j]);
+            }
+            fossil_tofu_free(keys);
+            return FOSSIL_TOFU_FAILURE;
+        }
+        if (cmp == 0) {
+            fossil_tofu_destroy(&keys[i]);
+        } else {
+            keys[unique++] = keys[i];
+        }
+    }
+    bool built = fossil_tofu_btree_build(tree, keys, unique);
+    fossil_tofu_free(keys);
+    return built ? FOSSIL_TOFU_SUCCESS : FOSSIL_TOFU_FAILURE;
+}
+
+int32_t fossil_tofu_btree_remove(fossil_tofu_btree_t* tree, char *data) {
+    if (tree == NULL || data == NULL || tree->root == NULL) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    fossil_tofu_t view = fossil_tofu_view_typed(tree->type_enum, data);
+    fossil_tofu_btree_node_t* path[FOSSIL_TOFU_BTREE_MAX_DEPTH];
+    size_t slots[FOSSIL_TOFU_BTREE_MAX_DEPTH];
+    size_t depth = 0;
+    fossil_tofu_btree_node_t* node = tree->root;
+    while (!node->leaf) {
+        path[depth] = node;
+        slots[depth] = fossil_tofu_btree_upper_index(node, &view);
+        node = node->children[slots[depth]];
+        depth++;
+    }
+    size_t pos = fossil_tofu_btree_lower_index(node, &view);
+    if (pos >= node->count || fossil_tofu_compare(&node->keys[pos], &view) != 0) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    fossil_tofu_destroy(&node->keys[pos]);
+    memmove(&node->keys[pos], &node->keys[pos + 1], (node->count - pos - 1) * sizeof(fossil_tofu_t));
+    node->count--;
+    tree->size--;
+
+    // Separators may now sit below their right subtree's smallest key, which
+    // still orders the subtrees correctly, so only underfull nodes need work
+    while (depth > 0 && node->count < FOSSIL_TOFU_BTREE_MIN_KEYS) {
+        depth--;
+        fossil_tofu_btree_rebalance_child(tree, path[depth], slots[depth]);
+        node = path[depth];
+    }
+
+    fossil_tofu_btree_node_t* root = tree->root;
+    if (root->count == 0) {
+        if (root->leaf) {
+            tree->root = NULL;
+            tree->first = NULL;
+            tree->last = NULL;
+        } else {
+            tree->root = root->children[0];
+        }
+        fossil_tofu_free(root);
+    }
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+bool fossil_tofu_btree_contains(const fossil_tofu_btree_t* tree, char *data) {
+    if (tree == NULL || data == NULL || tree->root == NULL) {
+        return false;
+    }
+    fossil_tofu_t view = fossil_tofu_view_typed(tree->type_enum, data);
+    const fossil_tofu_btree_node_t* leaf = fossil_tofu_btree_find_leaf(tree, &view);
+    size_t pos = fossil_tofu_btree_lower_index(leaf, &view);
+    return pos < leaf->count && fossil_tofu_compare(&leaf->keys[pos], &view) == 0;
+}
+
+void fossil_tofu_btree_clear(fossil_tofu_btree_t* tree) {
+    if (tree == NULL || tree->root == NULL) {
+        return;
+    }
+    fossil_tofu_btree_node_destroy(tree->root);
+    tree->root = NULL;
+    tree->first = NULL;
+    tree->last = NULL;
+    tree->size = 0;
+}
+
+size_t fossil_tofu_btree_size(const fossil_tofu_btree_t* tree) {
+    return tree == NULL ? 0 : tree->size;
+}
+
+bool fossil_tofu_btree_is_empty(const fossil_tofu_btree_t* tree) {
+    return tree == NULL || tree->size == 0;
+}
+
+char *fossil_tofu_btree_get_front(const fossil_tofu_btree_t* tree) {
+    return tree == NULL || tree->first == NULL ? NULL : fossil_tofu_get_value(&tree->first->keys[0]);
+}
+
+char *fossil_tofu_btree_get_back(const fossil_tofu_btree_t* tree) {
+    return tree == NULL || tree->last == NULL ? NULL : fossil_tofu_get_value(&tree->last->keys[tree->last->count - 1]);
+}
+
+// *****************************************************************************
+// Iteration
+// *****************************************************************************
+
+fossil_tofu_btree_iterator_t fossil_tofu_btree_begin(const fossil_tofu_btree_t* tree) {
+    return fossil_tofu_btree_make_iterator(tree == NULL ? NULL : tree->first, 0);
+}
+
+fossil_tofu_btree_iterator_t fossil_tofu_btree_rbegin(const fossil_tofu_btree_t* tree) {
+    fossil_tofu_btree_iterator_t iterator = {NULL, 0};
+    if (tree != NULL && tree->last != NULL) {
+        iterator.leaf = tree->last;
+        iterator.index = tree->last->count - 1;
+    }
+    return iterator;
+}
+
+fossil_tofu_btree_iterator_t fossil_tofu_btree_lower_bound(const fossil_tofu_btree_t* tree, char *data) {
+    if (tree == NULL || data == NULL || tree->root == NULL) {
+        return fossil_tofu_btree_make_iterator(NULL, 0);
+    }
+    fossil_tofu_t view = fossil_tofu_view_typed(tree->type_enum, data);
+    const fossil_tofu_btree_node_t* leaf = fossil_tofu_btree_find_leaf(tree, &view);
+    return fossil_tofu_btree_make_iterator(leaf, fossil_tofu_btree_lower_index(leaf, &view));
+}
+
+fossil_tofu_btree_iterator_t fossil_tofu_btree_upper_bound(const fossil_tofu_btree_t* tree, char *data) {
+    if (tree == NULL || data == NULL || tree->root == NULL) {
+        return fossil_tofu_btree_make_iterator(NULL, 0);
+    }
+    fossil_tofu_t view = fossil_tofu_view_typed(tree->type_enum, data);
+    const fossil_tofu_btree_node_t* leaf = fossil_tofu_btree_find_leaf(tree, &view);
+    return fossil_tofu_btree_make_iterator(leaf, fossil_tofu_btree_upper_index(leaf, &view));
+}
+
+bool fossil_tofu_btree_iterator_valid(const fossil_tofu_btree_iterator_t* iterator) {
+    return iterator != NULL && iterator->leaf != NULL;
+}
+
+char *fossil_tofu_btree_iterator_get(const fossil_tofu_btree_iterator_t* iterator) {
+    if (!fossil_tofu_btree_iterator_valid(iterator)) {
+        return NULL;
+    }
+    return fossil_tofu_get_value(&iterator->leaf->keys[iterator->index]);
+}
+
+void fossil_tofu_btree_iterator_next(fossil_tofu_btree_iterator_t* iterator) {
+    if (!fossil_tofu_btree_iterator_valid(iterator)) {
+        return;
+    }
+    *iterator = fossil_tofu_btree_make_iterator(iterator->leaf, iterator->index + 1);
+}
+
+void fossil_tofu_btree_iterator_prev(fossil_tofu_btree_iterator_t* iterator) {
+    if (!fossil_tofu_btree_iterator_valid(iterator)) {
+        return;
+    }
+    if (iterator->index > 0) {
+        iterator->index--;
+        return;
+    }
+    iterator->leaf = iterator->leaf->prev;
+    iterator->index = iterator->leaf != NULL ? iterator->leaf->count - 1 : 0;
+}
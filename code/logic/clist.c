@@ -34,12 +34,15 @@ fossil_tofu_clist_t* fossil_tofu_clist_create_container(char* type) {
         return NULL;
     }
     // Validate type
-    if (fossil_tofu_validate_type(type) == FOSSIL_TOFU_TYPE_CNULL) {
+    fossil_tofu_type_t type_enum = fossil_tofu_validate_type(type);
+    if (type_enum == FOSSIL_TOFU_TYPE_CNULL) {
         fossil_tofu_free(clist);
         return NULL;
     }
     clist->head = NULL;
     clist->type = fossil_tofu_strdup(type);
+    clist->type_enum = type_enum;
+    fossil_tofu_pool_init(&clist->pool, sizeof(fossil_tofu_clist_node_t));
     return clist;
 }
 
@@ -56,12 +59,14 @@ fossil_tofu_clist_t* fossil_tofu_clist_create_copy(const fossil_tofu_clist_t* ot
         return NULL;
     }
     clist->type = fossil_tofu_strdup(other->type);
+    clist->type_enum = other->type_enum;
     clist->head = NULL;
+    fossil_tofu_pool_init(&clist->pool, sizeof(fossil_tofu_clist_node_t));
     fossil_tofu_clist_node_t* current = other->head;
     if (current != NULL) {
         do {
             // Check type match before insert
-            fossil_tofu_type_t t1 = fossil_tofu_validate_type(clist->type);
+            fossil_tofu_type_t t1 = clist->type_enum;
             fossil_tofu_type_t t2 = fossil_tofu_get_type(&current->data);
             if (t1 != FOSSIL_TOFU_TYPE_ANY && t1 != t2) {
                 fossil_tofu_clist_destroy(clist);
@@ -83,21 +88,27 @@ fossil_tofu_clist_t* fossil_tofu_clist_create_move(fossil_tofu_clist_t* other) {
         return NULL;
     }
     clist->type = other->type;
+    clist->type_enum = other->type_enum;
     clist->head = other->head;
+    fossil_tofu_pool_init(&clist->pool, sizeof(fossil_tofu_clist_node_t));
+    fossil_tofu_pool_move(&clist->pool, &other->pool);
     other->type = NULL; // Prevent double free of type
+    other->type_enum = FOSSIL_TOFU_TYPE_CNULL;
     other->head = NULL;
     return clist;
 }
 
 void fossil_tofu_clist_destroy(fossil_tofu_clist_t* clist) {
-    if (clist == NULL || clist->head == NULL) return;
+    if (clist == NULL) return;
     fossil_tofu_clist_node_t* current = clist->head;
-    do {
-        fossil_tofu_clist_node_t* next = current->next;
-        fossil_tofu_destroy(&current->data);
-        fossil_tofu_free(current);
-        current = next;
-    } while (current != clist->head);
+    if (current != NULL) {
+        do {
+            fossil_tofu_destroy(&current->data);
+            current = current->next;
+        } while (current != clist->head);
+    }
+    // Nodes are released with their slabs
+    fossil_tofu_pool_clear(&clist->pool);
     fossil_tofu_free(clist->type);
     fossil_tofu_free(clist);
 }
@@ -107,11 +118,11 @@ void fossil_tofu_clist_destroy(fossil_tofu_clist_t* clist) {
 // *****************************************************************************
 
 int32_t fossil_tofu_clist_insert(fossil_tofu_clist_t* clist, char* data) {
-    fossil_tofu_clist_node_t* node = (fossil_tofu_clist_node_t*)fossil_tofu_alloc(sizeof(fossil_tofu_clist_node_t));
+    fossil_tofu_clist_node_t* node = (fossil_tofu_clist_node_t*)fossil_tofu_pool_acquire(&clist->pool);
     if (node == NULL) {
         return FOSSIL_TOFU_FAILURE;
     }
-    node->data = fossil_tofu_create(clist->type, data);
+    node->data = fossil_tofu_create_typed(clist->type_enum, data);
     if (clist->head == NULL) {
         clist->head = node;
         node->next = node;
@@ -138,7 +149,7 @@ int32_t fossil_tofu_clist_remove(fossil_tofu_clist_t* clist) {
         clist->head = clist->head->next;
     }
     fossil_tofu_destroy(&node->data);
-    fossil_tofu_free(node);
+    fossil_tofu_pool_release(&clist->pool, node);
     return FOSSIL_TOFU_SUCCESS;
 }
 
@@ -23,21 +23,84 @@
  * -----------------------------------------------------------------------------
  */
 #include "fossil/tofu/cqueue.h"
+#include <stdatomic.h>
+
+// Padding that keeps the producer and consumer indices on different cache lines
+#define FOSSIL_TOFU_CQUEUE_CACHE_LINE 64
+
+struct fossil_tofu_cqueue_spsc_t {
+    // Fixed at creation, read by both sides
+    fossil_tofu_t* slots;
+    size_t capacity;              // Elements the caller asked room for
+    size_t mask;                  // Slot count minus one; the slot count is a power of two
+    char* type;
+    fossil_tofu_type_t type_enum;
+    char pad0[FOSSIL_TOFU_CQUEUE_CACHE_LINE];
+
+    // Written by the consumer; `head` counts pops and is never wrapped
+    atomic_size_t head;
+    size_t tail_cache;            // Consumer's last view of `tail`
+    char pad1[FOSSIL_TOFU_CQUEUE_CACHE_LINE];
+
+    // Written by the producer; `tail` counts pushes and is never wrapped
+    atomic_size_t tail;
+    size_t head_cache;            // Producer's last view of `head`
+    char pad2[FOSSIL_TOFU_CQUEUE_CACHE_LINE];
+};
 
 // *****************************************************************************
-// Function prototypes
+// Ring helpers
 // *****************************************************************************
 
-fossil_tofu_cqueue_t* fossil_tofu_cqueue_create_container(char* type, size_t capacity) {
+// Slot after `slot`; capacity need not be a power of two, so wrap by compare
+static inline size_t fossil_tofu_cqueue_next(const fossil_tofu_cqueue_t* queue, size_t slot) {
+    return slot + 1 == queue->capacity ? 0 : slot + 1;
+}
+
+// Slot holding the rear element; only meaningful when the queue is not empty
+static inline size_t fossil_tofu_cqueue_rear_slot(const fossil_tofu_cqueue_t* queue) {
+    return queue->tail == 0 ? queue->capacity - 1 : queue->tail - 1;
+}
+
+static fossil_tofu_cqueue_t* fossil_tofu_cqueue_alloc(char* type, fossil_tofu_type_t type_enum, size_t capacity) {
+    if (capacity > SIZE_MAX / sizeof(fossil_tofu_t)) {
+        return NULL;
+    }
     fossil_tofu_cqueue_t* queue = (fossil_tofu_cqueue_t*)fossil_tofu_alloc(sizeof(fossil_tofu_cqueue_t));
     if (queue == NULL) {
         return NULL;
     }
-    queue->front = NULL;
-    queue->rear = NULL;
+    queue->slots = NULL;
+    if (capacity > 0) {
+        queue->slots = (fossil_tofu_t*)fossil_tofu_alloc(capacity * sizeof(fossil_tofu_t));
+        if (queue->slots == NULL) {
+            fossil_tofu_free(queue);
+            return NULL;
+        }
+    }
+    queue->head = 0;
+    queue->tail = 0;
     queue->type = fossil_tofu_strdup(type);
+    queue->type_enum = type_enum;
     queue->capacity = capacity;
     queue->size = 0;
+    queue->overwrite = false;
+    return queue;
+}
+
+// *****************************************************************************
+// Function prototypes
+// *****************************************************************************
+
+fossil_tofu_cqueue_t* fossil_tofu_cqueue_create_container(char* type, size_t capacity) {
+    return fossil_tofu_cqueue_alloc(type, fossil_tofu_validate_type(type), capacity);
+}
+
+fossil_tofu_cqueue_t* fossil_tofu_cqueue_create_overwrite(char* type, size_t capacity) {
+    fossil_tofu_cqueue_t* queue = fossil_tofu_cqueue_create_container(type, capacity);
+    if (queue != NULL) {
+        queue->overwrite = true;
+    }
     return queue;
 }
 
@@ -49,39 +112,23 @@ fossil_tofu_cqueue_t* fossil_tofu_cqueue_create_copy(const fossil_tofu_cqueue_t*
     if (other == NULL) {
         return NULL;  // Cannot copy a null queue
     }
-    fossil_tofu_cqueue_t* queue = (fossil_tofu_cqueue_t*)fossil_tofu_alloc(sizeof(fossil_tofu_cqueue_t));
+    fossil_tofu_cqueue_t* queue = fossil_tofu_cqueue_alloc(other->type, other->type_enum, other->capacity);
     if (queue == NULL) {
         return NULL;  // Memory allocation failed
     }
-    queue->type = fossil_tofu_strdup(other->type);
-    queue->capacity = other->capacity;
-    queue->size = other->size;
-    queue->front = NULL;
-    queue->rear = NULL;
-
-    // Copy nodes
-    if (other->front != NULL) {
-        fossil_tofu_cqueue_node_t* current = other->front;
-        do {
-            fossil_tofu_cqueue_node_t* node = (fossil_tofu_cqueue_node_t*)fossil_tofu_alloc(sizeof(fossil_tofu_cqueue_node_t));
-            if (node == NULL) {
-                fossil_tofu_cqueue_destroy(queue);
-                return NULL;  // Memory allocation failed
-            }
-            node->data = fossil_tofu_create(queue->type, fossil_tofu_get_value(&current->data));
-            node->next = NULL;
-
-            if (queue->front == NULL) {
-                queue->front = node;
-                queue->rear = node;
-                node->next = node;  // Circular link
-            } else {
-                queue->rear->next = node;
-                queue->rear = node;
-                node->next = queue->front;  // Circular link
-            }
-            current = current->next;
-        } while (current != other->front);
+    queue->overwrite = other->overwrite;
+
+    // Copy elements, packed from slot 0
+    size_t slot = other->head;
+    for (size_t i = 0; i < other->size; i++) {
+        memset(&queue->slots[i], 0, sizeof(fossil_tofu_t));
+        if (fossil_tofu_copy(&queue->slots[i], &other->slots[slot]) != FOSSIL_TOFU_SUCCESS) {
+            fossil_tofu_cqueue_destroy(queue);
+            return NULL;  // Memory allocation failed
+        }
+        queue->size++;
+        queue->tail = fossil_tofu_cqueue_next(queue, queue->tail);
+        slot = fossil_tofu_cqueue_next(other, slot);
     }
     return queue;
 }
@@ -95,17 +142,22 @@ fossil_tofu_cqueue_t* fossil_tofu_cqueue_create_move(fossil_tofu_cqueue_t* other
         return NULL;
     }
     queue->type = other->type;
+    queue->type_enum = other->type_enum;
     queue->capacity = other->capacity;
     queue->size = other->size;
-    queue->front = other->front;
-    queue->rear = other->rear;
+    queue->slots = other->slots;
+    queue->head = other->head;
+    queue->tail = other->tail;
+    queue->overwrite = other->overwrite;
 
     // Empty the old queue
     other->type = NULL;
+    other->type_enum = FOSSIL_TOFU_TYPE_CNULL;
     other->capacity = 0;
     other->size = 0;
-    other->front = NULL;
-    other->rear = NULL;
+    other->slots = NULL;
+    other->head = 0;
+    other->tail = 0;
 
     return queue;
 }
@@ -114,16 +166,12 @@ void fossil_tofu_cqueue_destroy(fossil_tofu_cqueue_t* queue) {
     if (queue == NULL) {
         return;
     }
-    if (queue->front != NULL) {
-        queue->rear->next = NULL;  // Break the circular link
-    }
-    fossil_tofu_cqueue_node_t* current = queue->front;
-    while (current != NULL) {
-        fossil_tofu_cqueue_node_t* next = current->next;
-        fossil_tofu_destroy(&current->data);
-        fossil_tofu_free(current);
-        current = next;
+    size_t slot = queue->head;
+    for (size_t i = 0; i < queue->size; i++) {
+        fossil_tofu_destroy(&queue->slots[slot]);
+        slot = fossil_tofu_cqueue_next(queue, slot);
     }
+    fossil_tofu_free(queue->slots);
     fossil_tofu_free(queue->type);
     fossil_tofu_free(queue);
 }
@@ -133,48 +181,36 @@ void fossil_tofu_cqueue_destroy(fossil_tofu_cqueue_t* queue) {
 // *****************************************************************************
 
 int32_t fossil_tofu_cqueue_insert(fossil_tofu_cqueue_t* queue, char *data) {
-    if (queue->size >= queue->capacity) {
-        return FOSSIL_TOFU_FAILURE;  // Queue is full
-    }
-    fossil_tofu_cqueue_node_t* node = (fossil_tofu_cqueue_node_t*)fossil_tofu_alloc(sizeof(fossil_tofu_cqueue_node_t));
-    if (node == NULL) {
-        return FOSSIL_TOFU_FAILURE;  // Memory allocation failed
+    if (queue == NULL || data == NULL || queue->capacity == 0) {
+        return FOSSIL_TOFU_FAILURE;
     }
-    node->data = fossil_tofu_create(queue->type, data);
-    node->next = NULL;
-    if (queue->front == NULL) {
-        queue->front = node;
-        queue->rear = node;
-        node->next = node;  // Circular link
-    } else {
-        queue->rear->next = node;
-        queue->rear = node;
-        node->next = queue->front;  // Circular link
+    if (queue->size == queue->capacity) {
+        if (!queue->overwrite) {
+            return FOSSIL_TOFU_FAILURE;  // Queue is full
+        }
+        // Drop the oldest element; its slot is the one written below
+        fossil_tofu_destroy(&queue->slots[queue->head]);
+        queue->head = fossil_tofu_cqueue_next(queue, queue->head);
+        queue->size--;
     }
+    queue->slots[queue->tail] = fossil_tofu_create_typed(queue->type_enum, data);
+    queue->tail = fossil_tofu_cqueue_next(queue, queue->tail);
     queue->size++;
     return FOSSIL_TOFU_SUCCESS;
 }
 
 int32_t fossil_tofu_cqueue_remove(fossil_tofu_cqueue_t* queue) {
-    if (queue->front == NULL) {
+    if (queue == NULL || queue->size == 0) {
         return FOSSIL_TOFU_FAILURE;  // Queue is empty
     }
-    fossil_tofu_cqueue_node_t* node = queue->front;
-    if (queue->front == queue->rear) {  // Only one node in the queue
-        queue->front = NULL;
-        queue->rear = NULL;
-    } else {
-        queue->front = queue->front->next;
-        queue->rear->next = queue->front;  // Maintain circular link
-    }
-    fossil_tofu_destroy(&node->data);
-    fossil_tofu_free(node);
+    fossil_tofu_destroy(&queue->slots[queue->head]);
+    queue->head = fossil_tofu_cqueue_next(queue, queue->head);
     queue->size--;
     return FOSSIL_TOFU_SUCCESS;
 }
 
 size_t fossil_tofu_cqueue_size(const fossil_tofu_cqueue_t* queue) {
-    return queue->size;
+    return queue == NULL ? 0 : queue->size;
 }
 
 bool fossil_tofu_cqueue_not_empty(const fossil_tofu_cqueue_t* queue) {
@@ -193,30 +229,189 @@ bool fossil_tofu_cqueue_is_cnullptr(const fossil_tofu_cqueue_t* queue) {
     return queue == NULL;
 }
 
+bool fossil_tofu_cqueue_is_full(const fossil_tofu_cqueue_t* queue) {
+    return (queue != NULL) && (queue->size == queue->capacity);
+}
+
 char *fossil_tofu_cqueue_get_front(const fossil_tofu_cqueue_t* queue) {
-    if (queue->front == NULL) {
+    if (queue == NULL || queue->size == 0) {
         return NULL;  // Queue is empty
     }
-    return fossil_tofu_get_value(&queue->front->data);
+    return fossil_tofu_get_value(&queue->slots[queue->head]);
 }
 
 char *fossil_tofu_cqueue_get_rear(const fossil_tofu_cqueue_t* queue) {
-    if (queue->rear == NULL) {
+    if (queue == NULL || queue->size == 0) {
         return NULL;  // Queue is empty
     }
-    return fossil_tofu_get_value(&queue->rear->data);
+    return fossil_tofu_get_value(&queue->slots[fossil_tofu_cqueue_rear_slot(queue)]);
 }
 
 void fossil_tofu_cqueue_set_front(fossil_tofu_cqueue_t* queue, char *element) {
-    if (queue->front == NULL) {
+    if (queue == NULL || queue->size == 0) {
         return;  // Queue is empty
     }
-    fossil_tofu_set_value(&queue->front->data, element);
+    fossil_tofu_set_value(&queue->slots[queue->head], element);
 }
 
 void fossil_tofu_cqueue_set_rear(fossil_tofu_cqueue_t* queue, char *element) {
-    if (queue->rear == NULL) {
+    if (queue == NULL || queue->size == 0) {
         return;  // Queue is empty
     }
-    fossil_tofu_set_value(&queue->rear->data, element);
+    fossil_tofu_set_value(&queue->slots[fossil_tofu_cqueue_rear_slot(queue)], element);
+}
+
+// *****************************************************************************
+// Single-producer/single-consumer functions
+// *****************************************************************************
+
+// Free slots as the producer sees them, refreshing its view of `head` only
+// when the cached one leaves fewer than `wanted`
+static size_t fossil_tofu_cqueue_spsc_room(fossil_tofu_cqueue_spsc_t* queue, size_t tail, size_t wanted) {
+    size_t room = queue->capacity - (tail - queue->head_cache);
+    if (room < wanted) {
+        queue->head_cache = atomic_load_explicit(&queue->head, memory_order_acquire);
+        room = queue->capacity - (tail - queue->head_cache);
+    }
+    return room;
+}
+
+// Filled slots as the consumer sees them, refreshing its view of `tail` only
+// when the cached one shows fewer than `wanted`
+static size_t fossil_tofu_cqueue_spsc_ready(fossil_tofu_cqueue_spsc_t* queue, size_t head, size_t wanted) {
+    size_t ready = queue->tail_cache - head;
+    if (ready < wanted) {
+        queue->tail_cache = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        ready = queue->tail_cache - head;
+    }
+    return ready;
+}
+
+fossil_tofu_cqueue_spsc_t* fossil_tofu_cqueue_create_spsc(char* type, size_t capacity) {
+    if (type == NULL || capacity == 0) {
+        return NULL;
+    }
+    fossil_tofu_type_t type_enum = fossil_tofu_validate_type(type);
+    if (type_enum == FOSSIL_TOFU_TYPE_CNULL) {
+        return NULL;
+    }
+    // Round the slot count up so indices wrap with a mask
+    size_t slots = 1;
+    while (slots < capacity) {
+        if (slots > SIZE_MAX / 2 / sizeof(fossil_tofu_t)) {
+            return NULL;
+        }
+        slots *= 2;
+    }
+    fossil_tofu_cqueue_spsc_t* queue = (fossil_tofu_cqueue_spsc_t*)fossil_tofu_alloc(sizeof(fossil_tofu_cqueue_spsc_t));
+    if (queue == NULL) {
+        return NULL;
+    }
+    queue->slots = (fossil_tofu_t*)fossil_tofu_alloc(slots * sizeof(fossil_tofu_t));
+    queue->type = fossil_tofu_strdup(type);
+    if (queue->slots == NULL || queue->type == NULL) {
+        fossil_tofu_free(queue->slots);
+        fossil_tofu_free(queue->type);
+        fossil_tofu_free(queue);
+        return NULL;
+    }
+    queue->capacity = capacity;
+    queue->mask = slots - 1;
+    queue->type_enum = type_enum;
+    atomic_init(&queue->head, 0);
+    atomic_init(&queue->tail, 0);
+    queue->tail_cache = 0;
+    queue->head_cache = 0;
+    return queue;
+}
+
+void fossil_tofu_cqueue_spsc_destroy(fossil_tofu_cqueue_spsc_t* queue) {
+    if (queue == NULL) {
+        return;
+    }
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    for (size_t i = atomic_load_explicit(&queue->head, memory_order_relaxed); i != tail; i++) {
+        fossil_tofu_destroy(&queue->slots[i & queue->mask]);
+    }
+    fossil_tofu_free(queue->slots);
+    fossil_tofu_free(queue->type);
+    fossil_tofu_free(queue);
+}
+
+int32_t fossil_tofu_cqueue_spsc_try_push(fossil_tofu_cqueue_spsc_t* queue, char *data) {
+    if (queue == NULL || data == NULL) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    if (fossil_tofu_cqueue_spsc_room(queue, tail, 1) == 0) {
+        return FOSSIL_TOFU_FAILURE;  // Queue is full
+    }
+    queue->slots[tail & queue->mask] = fossil_tofu_create_typed(queue->type_enum, data);
+    atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_cqueue_spsc_try_pop(fossil_tofu_cqueue_spsc_t* queue, fossil_tofu_t* out) {
+    if (queue == NULL) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    if (fossil_tofu_cqueue_spsc_ready(queue, head, 1) == 0) {
+        return FOSSIL_TOFU_FAILURE;  // Queue is empty
+    }
+    fossil_tofu_t* slot = &queue->slots[head & queue->mask];
+    if (out != NULL) {
+        *out = *slot;  // The element is relocatable, so the caller takes it over
+    } else {
+        fossil_tofu_destroy(slot);
+    }
+    atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+size_t fossil_tofu_cqueue_spsc_push_n(fossil_tofu_cqueue_spsc_t* queue, char* const* data, size_t count) {
+    if (queue == NULL || data == NULL || count == 0) {
+        return 0;
+    }
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    size_t room = fossil_tofu_cqueue_spsc_room(queue, tail, count);
+    size_t pushed = 0;
+    while (pushed < count && pushed < room && data[pushed] != NULL) {
+        queue->slots[(tail + pushed) & queue->mask] = fossil_tofu_create_typed(queue->type_enum, data[pushed]);
+        pushed++;
+    }
+    if (pushed > 0) {
+        atomic_store_explicit(&queue->tail, tail + pushed, memory_order_release);
+    }
+    return pushed;
+}
+
+size_t fossil_tofu_cqueue_spsc_pop_n(fossil_tofu_cqueue_spsc_t* queue, fossil_tofu_t* out, size_t max) {
+    if (queue == NULL || out == NULL || max == 0) {
+        return 0;
+    }
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    size_t ready = fossil_tofu_cqueue_spsc_ready(queue, head, max);
+    size_t popped = ready < max ? ready : max;
+    for (size_t i = 0; i < popped; i++) {
+        out[i] = queue->slots[(head + i) & queue->mask];
+    }
+    if (popped > 0) {
+        atomic_store_explicit(&queue->head, head + popped, memory_order_release);
+    }
+    return popped;
+}
+
+size_t fossil_tofu_cqueue_spsc_size(const fossil_tofu_cqueue_spsc_t* queue) {
+    if (queue == NULL) {
+        return 0;
+    }
+    // Load `head` first so a concurrent pop cannot make the difference negative
+    size_t head = atomic_load_explicit(&((fossil_tofu_cqueue_spsc_t*)queue)->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&((fossil_tofu_cqueue_spsc_t*)queue)->tail, memory_order_acquire);
+    return tail - head;
+}
+
+size_t fossil_tofu_cqueue_spsc_capacity(const fossil_tofu_cqueue_spsc_t* queue) {
+    return queue == NULL ? 0 : queue->capacity;
 }
@@ -29,7 +29,8 @@
 // *****************************************************************************
 
 fossil_tofu_dlist_t* fossil_tofu_dlist_create_container(char* type) {
-    if (type == NULL || fossil_tofu_validate_type(type) == FOSSIL_TOFU_TYPE_CNULL) {
+    fossil_tofu_type_t type_enum = type == NULL ? FOSSIL_TOFU_TYPE_CNULL : fossil_tofu_validate_type(type);
+    if (type_enum == FOSSIL_TOFU_TYPE_CNULL) {
         return NULL;
     }
     fossil_tofu_dlist_t* dlist = (fossil_tofu_dlist_t*)fossil_tofu_alloc(sizeof(fossil_tofu_dlist_t));
@@ -39,6 +40,8 @@ fossil_tofu_dlist_t* fossil_tofu_dlist_create_container(char* type) {
     dlist->head = NULL;
     dlist->tail = NULL;
     dlist->type = fossil_tofu_strdup(type);
+    dlist->type_enum = type_enum;
+    fossil_tofu_pool_init(&dlist->pool, sizeof(fossil_tofu_dlist_node_t));
     return dlist;
 }
 
@@ -55,13 +58,15 @@ fossil_tofu_dlist_t* fossil_tofu_dlist_create_copy(const fossil_tofu_dlist_t* ot
         return NULL;
     }
     dlist->type = fossil_tofu_strdup(other->type);
+    dlist->type_enum = other->type_enum;
     dlist->head = NULL;
     dlist->tail = NULL;
+    fossil_tofu_pool_init(&dlist->pool, sizeof(fossil_tofu_dlist_node_t));
     fossil_tofu_dlist_node_t* current = other->head;
     while (current != NULL) {
         // Type check: ensure type matches
-        if (fossil_tofu_get_type(&current->data) != fossil_tofu_validate_type(dlist->type) &&
-            fossil_tofu_validate_type(dlist->type) != FOSSIL_TOFU_TYPE_ANY) {
+        if (fossil_tofu_get_type(&current->data) != dlist->type_enum &&
+            dlist->type_enum != FOSSIL_TOFU_TYPE_ANY) {
             fossil_tofu_dlist_destroy(dlist);
             return NULL;
         }
@@ -80,9 +85,13 @@ fossil_tofu_dlist_t* fossil_tofu_dlist_create_move(fossil_tofu_dlist_t* other) {
         return NULL;
     }
     dlist->type = other->type;
+    dlist->type_enum = other->type_enum;
     dlist->head = other->head;
     dlist->tail = other->tail;
+    fossil_tofu_pool_init(&dlist->pool, sizeof(fossil_tofu_dlist_node_t));
+    fossil_tofu_pool_move(&dlist->pool, &other->pool);
     other->type = NULL;
+    other->type_enum = FOSSIL_TOFU_TYPE_CNULL;
     other->head = NULL;
     other->tail = NULL;
     return dlist;
@@ -93,9 +102,10 @@ void fossil_tofu_dlist_destroy(fossil_tofu_dlist_t* dlist) {
     while (current != NULL) {
         fossil_tofu_dlist_node_t* next = current->next;
         fossil_tofu_destroy(&current->data);
-        fossil_tofu_free(current);
         current = next;
     }
+    // Nodes are released with their slabs
+    fossil_tofu_pool_clear(&dlist->pool);
     fossil_tofu_free(dlist->type);
     fossil_tofu_free(dlist);
 }
@@ -105,11 +115,11 @@ void fossil_tofu_dlist_destroy(fossil_tofu_dlist_t* dlist) {
 // *****************************************************************************
 
 int32_t fossil_tofu_dlist_insert(fossil_tofu_dlist_t* dlist, char *data) {
-    fossil_tofu_dlist_node_t* node = (fossil_tofu_dlist_node_t*)fossil_tofu_alloc(sizeof(fossil_tofu_dlist_node_t));
+    fossil_tofu_dlist_node_t* node = (fossil_tofu_dlist_node_t*)fossil_tofu_pool_acquire(&dlist->pool);
     if (node == NULL) {
         return FOSSIL_TOFU_FAILURE;
     }
-    node->data = fossil_tofu_create(dlist->type, data);
+    node->data = fossil_tofu_create_typed(dlist->type_enum, data);
     node->prev = NULL;
     node->next = NULL;
 
@@ -136,7 +146,7 @@ int32_t fossil_tofu_dlist_remove(fossil_tofu_dlist_t* dlist) {
         dlist->head->prev = NULL;
     }
     fossil_tofu_destroy(&node->data);
-    fossil_tofu_free(node);
+    fossil_tofu_pool_release(&dlist->pool, node);
     return FOSSIL_TOFU_SUCCESS;
 }
 
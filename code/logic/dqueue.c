@@ -23,22 +23,96 @@
  * -----------------------------------------------------------------------------
  */
 #include "fossil/tofu/dqueue.h"
+#include <stdatomic.h>
+
+// Padding that keeps the thieves' `top` off the owner's cache line
+#define FOSSIL_TOFU_DQUEUE_CACHE_LINE 64
+
+// Words in one element. Slots are copied a word at a time with relaxed
+// atomics: a thief may read a slot the owner is reusing, and only keeps what
+// it read once its compare-and-swap on `top` proves the slot was not reused.
+#define FOSSIL_TOFU_DQUEUE_WS_WORDS (sizeof(fossil_tofu_t) / sizeof(uintptr_t))
+_Static_assert(sizeof(fossil_tofu_t) % sizeof(uintptr_t) == 0, "fossil_tofu_t must be a whole number of words");
+
+typedef struct fossil_tofu_dqueue_ws_slot_t {
+    atomic_uintptr_t words[FOSSIL_TOFU_DQUEUE_WS_WORDS];
+} fossil_tofu_dqueue_ws_slot_t;
+
+// Ring of slots. A grown ring keeps the one it replaced, since thieves may
+// still be reading it; the chain is freed with the queue.
+typedef struct fossil_tofu_dqueue_ws_array_t {
+    size_t mask;
+    struct fossil_tofu_dqueue_ws_array_t* retired;
+    fossil_tofu_dqueue_ws_slot_t slots[];
+} fossil_tofu_dqueue_ws_array_t;
+
+struct fossil_tofu_dqueue_ws_t {
+    char *type;
+    fossil_tofu_type_t type_enum;
+    char pad0[FOSSIL_TOFU_DQUEUE_CACHE_LINE];
+
+    atomic_llong top;             // Next element to steal; advanced by CAS
+    char pad1[FOSSIL_TOFU_DQUEUE_CACHE_LINE];
+
+    atomic_llong bottom;          // Next slot to push; written by the owner only
+    _Atomic(fossil_tofu_dqueue_ws_array_t*) array;
+    char pad2[FOSSIL_TOFU_DQUEUE_CACHE_LINE];
+};
+
+// *****************************************************************************
+// Ring helpers
+// *****************************************************************************
+
+// Physical slot of the element `index` positions behind the front
+static inline size_t fossil_tofu_dqueue_slot(const fossil_tofu_dqueue_t* dqueue, size_t index) {
+    return (dqueue->head + index) & (dqueue->capacity - 1);
+}
+
+// Double the ring, unrolling it so the front lands in slot 0. Elements are
+// relocated bytewise, each one moved exactly once per growth.
+static int32_t fossil_tofu_dqueue_grow(fossil_tofu_dqueue_t* dqueue) {
+    size_t capacity = dqueue->capacity == 0 ? FOSSIL_TOFU_DQUEUE_INITIAL_CAPACITY : dqueue->capacity * 2;
+    if (capacity < dqueue->capacity || capacity > SIZE_MAX / sizeof(fossil_tofu_t)) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    fossil_tofu_t* buffer = (fossil_tofu_t*)fossil_tofu_alloc(capacity * sizeof(fossil_tofu_t));
+    if (buffer == NULL) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    if (dqueue->size > 0) {
+        size_t first = dqueue->capacity - dqueue->head;
+        if (first > dqueue->size) {
+            first = dqueue->size;
+        }
+        memcpy(buffer, dqueue->buffer + dqueue->head, first * sizeof(fossil_tofu_t));
+        memcpy(buffer + first, dqueue->buffer, (dqueue->size - first) * sizeof(fossil_tofu_t));
+    }
+    fossil_tofu_free(dqueue->buffer);
+    dqueue->buffer = buffer;
+    dqueue->capacity = capacity;
+    dqueue->head = 0;
+    return FOSSIL_TOFU_SUCCESS;
+}
 
 // *****************************************************************************
 // Function prototypes
 // *****************************************************************************
 
 fossil_tofu_dqueue_t* fossil_tofu_dqueue_create_container(char* type) {
-    if (type == NULL || fossil_tofu_validate_type(type) == FOSSIL_TOFU_TYPE_CNULL) {
+    fossil_tofu_type_t type_enum = type == NULL ? FOSSIL_TOFU_TYPE_CNULL : fossil_tofu_validate_type(type);
+    if (type_enum == FOSSIL_TOFU_TYPE_CNULL) {
         return NULL;
     }
     fossil_tofu_dqueue_t* dqueue = (fossil_tofu_dqueue_t*)fossil_tofu_alloc(sizeof(fossil_tofu_dqueue_t));
     if (dqueue == NULL) {
         return NULL;
     }
-    dqueue->front = NULL;
-    dqueue->rear = NULL;
+    dqueue->buffer = NULL;
+    dqueue->capacity = 0;
+    dqueue->head = 0;
+    dqueue->size = 0;
     dqueue->type = fossil_tofu_strdup(type);
+    dqueue->type_enum = type_enum;
     return dqueue;
 }
 
@@ -50,24 +124,27 @@ fossil_tofu_dqueue_t* fossil_tofu_dqueue_create_copy(const fossil_tofu_dqueue_t*
     if (other == NULL || other->type == NULL) {
         return NULL;
     }
-    fossil_tofu_dqueue_t* dqueue = (fossil_tofu_dqueue_t*)fossil_tofu_alloc(sizeof(fossil_tofu_dqueue_t));
+    fossil_tofu_dqueue_t* dqueue = fossil_tofu_dqueue_create_container(other->type);
     if (dqueue == NULL) {
         return NULL;
     }
-    dqueue->type = fossil_tofu_strdup(other->type);
-    dqueue->front = NULL;
-    dqueue->rear = NULL;
-    fossil_tofu_dqueue_node_t* current = other->front;
-    while (current != NULL) {
-        // Check type match before insert
-        fossil_tofu_type_t dqueue_type = fossil_tofu_validate_type(dqueue->type);
-        fossil_tofu_type_t node_type = fossil_tofu_get_type(&current->data);
-        if (dqueue_type != FOSSIL_TOFU_TYPE_ANY && dqueue_type != node_type) {
+    if (other->size == 0) {
+        return dqueue;
+    }
+    // The copy is unrolled into a ring of the same capacity
+    dqueue->buffer = (fossil_tofu_t*)fossil_tofu_alloc(other->capacity * sizeof(fossil_tofu_t));
+    if (dqueue->buffer == NULL) {
+        fossil_tofu_dqueue_destroy(dqueue);
+        return NULL;
+    }
+    memset(dqueue->buffer, 0, other->capacity * sizeof(fossil_tofu_t));
+    dqueue->capacity = other->capacity;
+    for (size_t i = 0; i < other->size; i++) {
+        if (fossil_tofu_copy(&dqueue->buffer[i], &other->buffer[fossil_tofu_dqueue_slot(other, i)]) != FOSSIL_TOFU_SUCCESS) {
             fossil_tofu_dqueue_destroy(dqueue);
             return NULL;
         }
-        fossil_tofu_dqueue_insert(dqueue, fossil_tofu_get_value(&current->data));
-        current = current->next;
+        dqueue->size++;
     }
     return dqueue;
 }
@@ -81,24 +158,30 @@ fossil_tofu_dqueue_t* fossil_tofu_dqueue_create_move(fossil_tofu_dqueue_t* other
         return NULL;
     }
     dqueue->type = other->type;
-    dqueue->front = other->front;
-    dqueue->rear = other->rear;
+    dqueue->type_enum = other->type_enum;
+    dqueue->buffer = other->buffer;
+    dqueue->capacity = other->capacity;
+    dqueue->head = other->head;
+    dqueue->size = other->size;
 
     other->type = NULL;
-    other->front = NULL;
-    other->rear = NULL;
+    other->type_enum = FOSSIL_TOFU_TYPE_CNULL;
+    other->buffer = NULL;
+    other->capacity = 0;
+    other->head = 0;
+    other->size = 0;
 
     return dqueue;
 }
 
 void fossil_tofu_dqueue_destroy(fossil_tofu_dqueue_t* dqueue) {
-    fossil_tofu_dqueue_node_t* current = dqueue->front;
-    while (current != NULL) {
-        fossil_tofu_dqueue_node_t* next = current->next;
-        fossil_tofu_destroy(&current->data);
-        fossil_tofu_free(current);
-        current = next;
+    if (dqueue == NULL) {
+        return;
     }
+    for (size_t i = 0; i < dqueue->size; i++) {
+        fossil_tofu_destroy(&dqueue->buffer[fossil_tofu_dqueue_slot(dqueue, i)]);
+    }
+    fossil_tofu_free(dqueue->buffer);
     fossil_tofu_free(dqueue->type);
     fossil_tofu_free(dqueue);
 }
@@ -108,56 +191,63 @@ void fossil_tofu_dqueue_destroy(fossil_tofu_dqueue_t* dqueue) {
 // *****************************************************************************
 
 int32_t fossil_tofu_dqueue_insert(fossil_tofu_dqueue_t* dqueue, char *data) {
+    return fossil_tofu_dqueue_push_back(dqueue, data);
+}
+
+int32_t fossil_tofu_dqueue_remove(fossil_tofu_dqueue_t* dqueue) {
+    return fossil_tofu_dqueue_pop_front(dqueue);
+}
+
+int32_t fossil_tofu_dqueue_push_front(fossil_tofu_dqueue_t* dqueue, char *data) {
     if (data == NULL || dqueue == NULL) {
         return FOSSIL_TOFU_FAILURE;
     }
+    if (dqueue->size == dqueue->capacity && fossil_tofu_dqueue_grow(dqueue) != FOSSIL_TOFU_SUCCESS) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    dqueue->head = (dqueue->head - 1) & (dqueue->capacity - 1);
+    dqueue->buffer[dqueue->head] = fossil_tofu_create_typed(dqueue->type_enum, data);
+    dqueue->size++;
+    return FOSSIL_TOFU_SUCCESS;
+}
 
-    fossil_tofu_dqueue_node_t* node = (fossil_tofu_dqueue_node_t*)fossil_tofu_alloc(sizeof(fossil_tofu_dqueue_node_t));
-    if (node == NULL) {
+int32_t fossil_tofu_dqueue_push_back(fossil_tofu_dqueue_t* dqueue, char *data) {
+    if (data == NULL || dqueue == NULL) {
         return FOSSIL_TOFU_FAILURE;
     }
-    node->data = fossil_tofu_create(dqueue->type, data);
-    node->next = NULL;
-    if (dqueue->front == NULL) {
-        dqueue->front = node;
-        dqueue->rear = node;
-        node->prev = NULL;
-    } else {
-        dqueue->rear->next = node;
-        node->prev = dqueue->rear;
-        dqueue->rear = node;
+    if (dqueue->size == dqueue->capacity && fossil_tofu_dqueue_grow(dqueue) != FOSSIL_TOFU_SUCCESS) {
+        return FOSSIL_TOFU_FAILURE;
     }
+    dqueue->buffer[fossil_tofu_dqueue_slot(dqueue, dqueue->size)] = fossil_tofu_create_typed(dqueue->type_enum, data);
+    dqueue->size++;
     return FOSSIL_TOFU_SUCCESS;
 }
 
-int32_t fossil_tofu_dqueue_remove(fossil_tofu_dqueue_t* dqueue) {
-    if (dqueue->front == NULL) {
+int32_t fossil_tofu_dqueue_pop_front(fossil_tofu_dqueue_t* dqueue) {
+    if (dqueue == NULL || dqueue->size == 0) {
         return FOSSIL_TOFU_FAILURE;
     }
-    fossil_tofu_dqueue_node_t* node = dqueue->front;
-    dqueue->front = node->next;
-    if (dqueue->front == NULL) {
-        dqueue->rear = NULL;
-    } else {
-        dqueue->front->prev = NULL;
+    fossil_tofu_destroy(&dqueue->buffer[dqueue->head]);
+    dqueue->head = (dqueue->head + 1) & (dqueue->capacity - 1);
+    dqueue->size--;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_dqueue_pop_back(fossil_tofu_dqueue_t* dqueue) {
+    if (dqueue == NULL || dqueue->size == 0) {
+        return FOSSIL_TOFU_FAILURE;
     }
-    fossil_tofu_destroy(&node->data);
-    fossil_tofu_free(node);
+    fossil_tofu_destroy(&dqueue->buffer[fossil_tofu_dqueue_slot(dqueue, dqueue->size - 1)]);
+    dqueue->size--;
     return FOSSIL_TOFU_SUCCESS;
 }
 
 size_t fossil_tofu_dqueue_size(const fossil_tofu_dqueue_t* dqueue) {
-    size_t size = 0;
-    fossil_tofu_dqueue_node_t* current = dqueue->front;
-    while (current != NULL) {
-        size++;
-        current = current->next;
-    }
-    return size;
+    return dqueue == NULL ? 0 : dqueue->size;
 }
 
 bool fossil_tofu_dqueue_not_empty(const fossil_tofu_dqueue_t* dqueue) {
-    return dqueue != NULL && dqueue->front != NULL;
+    return dqueue != NULL && dqueue->size != 0;
 }
 
 bool fossil_tofu_dqueue_not_cnullptr(const fossil_tofu_dqueue_t* dqueue) {
@@ -165,7 +255,7 @@ bool fossil_tofu_dqueue_not_cnullptr(const fossil_tofu_dqueue_t* dqueue) {
 }
 
 bool fossil_tofu_dqueue_is_empty(const fossil_tofu_dqueue_t* dqueue) {
-    return dqueue == NULL || dqueue->front == NULL;
+    return dqueue == NULL || dqueue->size == 0;
 }
 
 bool fossil_tofu_dqueue_is_cnullptr(const fossil_tofu_dqueue_t* dqueue) {
@@ -177,43 +267,234 @@ bool fossil_tofu_dqueue_is_cnullptr(const fossil_tofu_dqueue_t* dqueue) {
 // *****************************************************************************
 
 char *fossil_tofu_dqueue_get(const fossil_tofu_dqueue_t* dqueue, size_t index) {
-    size_t i = 0;
-    fossil_tofu_dqueue_node_t* current = dqueue->front;
-    while (current != NULL) {
-        if (i == index) {
-            return fossil_tofu_get_value(&current->data);
-        }
-        i++;
-        current = current->next;
+    if (dqueue == NULL || index >= dqueue->size) {
+        return NULL;
     }
-    return NULL;
+    return fossil_tofu_get_value(&dqueue->buffer[fossil_tofu_dqueue_slot(dqueue, index)]);
 }
 
 char *fossil_tofu_dqueue_get_front(const fossil_tofu_dqueue_t* dqueue) {
-    return fossil_tofu_get_value(&dqueue->front->data);
+    return dqueue == NULL || dqueue->size == 0 ? NULL : fossil_tofu_dqueue_get(dqueue, 0);
 }
 
 char *fossil_tofu_dqueue_get_back(const fossil_tofu_dqueue_t* dqueue) {
-    return fossil_tofu_get_value(&dqueue->rear->data);
+    return dqueue == NULL || dqueue->size == 0 ? NULL : fossil_tofu_dqueue_get(dqueue, dqueue->size - 1);
 }
 
 void fossil_tofu_dqueue_set(fossil_tofu_dqueue_t* dqueue, size_t index, char *element) {
-    size_t i = 0;
-    fossil_tofu_dqueue_node_t* current = dqueue->front;
-    while (current != NULL) {
-        if (i == index) {
-            fossil_tofu_set_value(&current->data, element);
-            return;
-        }
-        i++;
-        current = current->next;
+    if (dqueue == NULL || index >= dqueue->size) {
+        return;
     }
+    fossil_tofu_set_value(&dqueue->buffer[fossil_tofu_dqueue_slot(dqueue, index)], element);
 }
 
 void fossil_tofu_dqueue_set_front(fossil_tofu_dqueue_t* dqueue, char *element) {
-    fossil_tofu_set_value(&dqueue->front->data, element);
+    if (dqueue == NULL || dqueue->size == 0) {
+        return;
+    }
+    fossil_tofu_dqueue_set(dqueue, 0, element);
 }
 
 void fossil_tofu_dqueue_set_back(fossil_tofu_dqueue_t* dqueue, char *element) {
-    fossil_tofu_set_value(&dqueue->rear->data, element);
+    if (dqueue == NULL || dqueue->size == 0) {
+        return;
+    }
+    fossil_tofu_dqueue_set(dqueue, dqueue->size - 1, element);
+}
+
+// *****************************************************************************
+// Work-stealing functions
+// *****************************************************************************
+
+static void fossil_tofu_dqueue_ws_store(fossil_tofu_dqueue_ws_slot_t* slot, const fossil_tofu_t* value) {
+    uintptr_t words[FOSSIL_TOFU_DQUEUE_WS_WORDS];
+    memcpy(words, value, sizeof(words));
+    for (size_t i = 0; i < FOSSIL_TOFU_DQUEUE_WS_WORDS; i++) {
+        atomic_store_explicit(&slot->words[i], words[i], memory_order_relaxed);
+    }
+}
+
+static void fossil_tofu_dqueue_ws_load(fossil_tofu_dqueue_ws_slot_t* slot, fossil_tofu_t* value) {
+    uintptr_t words[FOSSIL_TOFU_DQUEUE_WS_WORDS];
+    for (size_t i = 0; i < FOSSIL_TOFU_DQUEUE_WS_WORDS; i++) {
+        words[i] = atomic_load_explicit(&slot->words[i], memory_order_relaxed);
+    }
+    memcpy(value, words, sizeof(words));
+}
+
+static fossil_tofu_dqueue_ws_array_t* fossil_tofu_dqueue_ws_array_alloc(size_t slots) {
+    if (slots > (SIZE_MAX - sizeof(fossil_tofu_dqueue_ws_array_t)) / sizeof(fossil_tofu_dqueue_ws_slot_t)) {
+        return NULL;
+    }
+    fossil_tofu_dqueue_ws_array_t* array = (fossil_tofu_dqueue_ws_array_t*)fossil_tofu_alloc(
+        sizeof(fossil_tofu_dqueue_ws_array_t) + slots * sizeof(fossil_tofu_dqueue_ws_slot_t));
+    if (array == NULL) {
+        return NULL;
+    }
+    array->mask = slots - 1;
+    array->retired = NULL;
+    return array;
+}
+
+// Owner only: move elements [top, bottom) into a ring twice the size
+static fossil_tofu_dqueue_ws_array_t* fossil_tofu_dqueue_ws_grow(fossil_tofu_dqueue_ws_t* dqueue, fossil_tofu_dqueue_ws_array_t* old,
+                                                                 long long top, long long bottom) {
+    if (old->mask + 1 > SIZE_MAX / 2) {
+        return NULL;
+    }
+    fossil_tofu_dqueue_ws_array_t* array = fossil_tofu_dqueue_ws_array_alloc((old->mask + 1) * 2);
+    if (array == NULL) {
+        return NULL;
+    }
+    for (long long i = top; i < bottom; i++) {
+        fossil_tofu_t value;
+        fossil_tofu_dqueue_ws_load(&old->slots[(size_t)i & old->mask], &value);
+        fossil_tofu_dqueue_ws_store(&array->slots[(size_t)i & array->mask], &value);
+    }
+    array->retired = old;
+    atomic_store_explicit(&dqueue->array, array, memory_order_release);
+    return array;
+}
+
+fossil_tofu_dqueue_ws_t* fossil_tofu_dqueue_create_ws(char* type, size_t capacity) {
+    fossil_tofu_type_t type_enum = type == NULL ? FOSSIL_TOFU_TYPE_CNULL : fossil_tofu_validate_type(type);
+    if (type_enum == FOSSIL_TOFU_TYPE_CNULL) {
+        return NULL;
+    }
+    size_t slots = 2;
+    while (slots < capacity) {
+        if (slots > SIZE_MAX / 2) {
+            return NULL;
+        }
+        slots *= 2;
+    }
+    fossil_tofu_dqueue_ws_t* dqueue = (fossil_tofu_dqueue_ws_t*)fossil_tofu_alloc(sizeof(fossil_tofu_dqueue_ws_t));
+    if (dqueue == NULL) {
+        return NULL;
+    }
+    fossil_tofu_dqueue_ws_array_t* array = fossil_tofu_dqueue_ws_array_alloc(slots);
+    dqueue->type = fossil_tofu_strdup(type);
+    if (array == NULL || dqueue->type == NULL) {
+        fossil_tofu_free(array);
+        fossil_tofu_free(dqueue->type);
+        fossil_tofu_free(dqueue);
+        return NULL;
+    }
+    dqueue->type_enum = type_enum;
+    atomic_init(&dqueue->top, 0);
+    atomic_init(&dqueue->bottom, 0);
+    atomic_init(&dqueue->array, array);
+    return dqueue;
+}
+
+void fossil_tofu_dqueue_ws_destroy(fossil_tofu_dqueue_ws_t* dqueue) {
+    if (dqueue == NULL) {
+        return;
+    }
+    fossil_tofu_dqueue_ws_array_t* array = atomic_load_explicit(&dqueue->array, memory_order_acquire);
+    long long bottom = atomic_load_explicit(&dqueue->bottom, memory_order_relaxed);
+    for (long long i = atomic_load_explicit(&dqueue->top, memory_order_acquire); i < bottom; i++) {
+        fossil_tofu_t value;
+        fossil_tofu_dqueue_ws_load(&array->slots[(size_t)i & array->mask], &value);
+        fossil_tofu_destroy(&value);
+    }
+    while (array != NULL) {
+        fossil_tofu_dqueue_ws_array_t* retired = array->retired;
+        fossil_tofu_free(array);
+        array = retired;
+    }
+    fossil_tofu_free(dqueue->type);
+    fossil_tofu_free(dqueue);
+}
+
+int32_t fossil_tofu_dqueue_ws_push(fossil_tofu_dqueue_ws_t* dqueue, char *data) {
+    if (dqueue == NULL || data == NULL) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    long long bottom = atomic_load_explicit(&dqueue->bottom, memory_order_relaxed);
+    long long top = atomic_load_explicit(&dqueue->top, memory_order_acquire);
+    fossil_tofu_dqueue_ws_array_t* array = atomic_load_explicit(&dqueue->array, memory_order_relaxed);
+    if ((size_t)(bottom - top) > array->mask) {
+        array = fossil_tofu_dqueue_ws_grow(dqueue, array, top, bottom);
+        if (array == NULL) {
+            return FOSSIL_TOFU_FAILURE;
+        }
+    }
+    fossil_tofu_t value = fossil_tofu_create_typed(dqueue->type_enum, data);
+    fossil_tofu_dqueue_ws_store(&array->slots[(size_t)bottom & array->mask], &value);
+    // Publish the slot before thieves can see the new bottom
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&dqueue->bottom, bottom + 1, memory_order_relaxed);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_dqueue_ws_pop(fossil_tofu_dqueue_ws_t* dqueue, fossil_tofu_t* out) {
+    if (dqueue == NULL) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    long long bottom = atomic_load_explicit(&dqueue->bottom, memory_order_relaxed) - 1;
+    fossil_tofu_dqueue_ws_array_t* array = atomic_load_explicit(&dqueue->array, memory_order_relaxed);
+    // Reserve the bottom slot before looking at `top`, so a thief either sees
+    // the reservation or the owner sees the thief's steal
+    atomic_store_explicit(&dqueue->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    long long top = atomic_load_explicit(&dqueue->top, memory_order_relaxed);
+    if (top > bottom) {
+        atomic_store_explicit(&dqueue->bottom, bottom + 1, memory_order_relaxed);
+        return FOSSIL_TOFU_FAILURE;  // Queue is empty
+    }
+    fossil_tofu_t value;
+    fossil_tofu_dqueue_ws_load(&array->slots[(size_t)bottom & array->mask], &value);
+    if (top == bottom) {
+        // Last element: race the thieves for it through `top`
+        bool won = atomic_compare_exchange_strong_explicit(&dqueue->top, &top, top + 1,
+                                                           memory_order_seq_cst, memory_order_relaxed);
+        atomic_store_explicit(&dqueue->bottom, bottom + 1, memory_order_relaxed);
+        if (!won) {
+            return FOSSIL_TOFU_FAILURE;
+        }
+    }
+    if (out != NULL) {
+        *out = value;
+    } else {
+        fossil_tofu_destroy(&value);
+    }
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_dqueue_ws_steal(fossil_tofu_dqueue_ws_t* dqueue, fossil_tofu_t* out) {
+    if (dqueue == NULL) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    for (;;) {
+        long long top = atomic_load_explicit(&dqueue->top, memory_order_acquire);
+        atomic_thread_fence(memory_order_seq_cst);
+        long long bottom = atomic_load_explicit(&dqueue->bottom, memory_order_acquire);
+        if (top >= bottom) {
+            return FOSSIL_TOFU_FAILURE;  // Queue is empty
+        }
+        fossil_tofu_dqueue_ws_array_t* array = atomic_load_explicit(&dqueue->array, memory_order_acquire);
+        fossil_tofu_t value;
+        fossil_tofu_dqueue_ws_load(&array->slots[(size_t)top & array->mask], &value);
+        if (atomic_compare_exchange_strong_explicit(&dqueue->top, &top, top + 1,
+                                                    memory_order_seq_cst, memory_order_relaxed)) {
+            if (out != NULL) {
+                *out = value;
+            } else {
+                fossil_tofu_destroy(&value);
+            }
+            return FOSSIL_TOFU_SUCCESS;
+        }
+        // Another thief or the owner took it; what was read may be stale
+    }
+}
+
+size_t fossil_tofu_dqueue_ws_size(const fossil_tofu_dqueue_ws_t* dqueue) {
+    if (dqueue == NULL) {
+        return 0;
+    }
+    fossil_tofu_dqueue_ws_t* shared = (fossil_tofu_dqueue_ws_t*)dqueue;
+    long long top = atomic_load_explicit(&shared->top, memory_order_acquire);
+    long long bottom = atomic_load_explicit(&shared->bottom, memory_order_acquire);
+    return bottom > top ? (size_t)(bottom - top) : 0;
 }
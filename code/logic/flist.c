@@ -31,6 +31,8 @@ fossil_tofu_flist_t* fossil_tofu_flist_create_container(char* type) {
     }
     flist->head = NULL;
     flist->type = fossil_tofu_strdup(type);
+    flist->type_enum = fossil_tofu_validate_type(type);
+    fossil_tofu_pool_init(&flist->pool, sizeof(fossil_tofu_flist_node_t));
     return flist;
 }
 
@@ -49,7 +51,7 @@ fossil_tofu_flist_t* fossil_tofu_flist_create_copy(const fossil_tofu_flist_t* ot
 
     fossil_tofu_flist_node_t* current = other->head;
     while (current) {
-        fossil_tofu_flist_insert(copy, current->data.value.data);
+        fossil_tofu_flist_insert(copy, fossil_tofu_get_value(&current->data));
         current = current->next;
     }
 
@@ -64,8 +66,10 @@ fossil_tofu_flist_t* fossil_tofu_flist_create_move(fossil_tofu_flist_t* other) {
     if (!new_list) {
         return NULL;
     }
+    new_list->type_enum = other->type_enum;
     new_list->head = other->head;
     other->head = NULL;
+    fossil_tofu_pool_move(&new_list->pool, &other->pool);
     return new_list;
 }
 
@@ -92,10 +96,11 @@ void fossil_tofu_flist_destroy(fossil_tofu_flist_t* flist) {
     }
     fossil_tofu_flist_node_t* current = flist->head;
     while (current) {
-        fossil_tofu_flist_node_t* next = current->next;
-        fossil_tofu_free(current);
-        current = next;
+        fossil_tofu_destroy(&current->data);
+        current = current->next;
     }
+    // Nodes are released with their slabs
+    fossil_tofu_pool_clear(&flist->pool);
     fossil_tofu_free(flist->type);
     fossil_tofu_free(flist);
 }
@@ -104,11 +109,11 @@ int32_t fossil_tofu_flist_insert(fossil_tofu_flist_t* flist, char *data) {
     if (!flist || !data) {
         return -1;  // Error
     }
-    fossil_tofu_flist_node_t* new_node = (fossil_tofu_flist_node_t*)fossil_tofu_alloc(sizeof(fossil_tofu_flist_node_t));
+    fossil_tofu_flist_node_t* new_node = (fossil_tofu_flist_node_t*)fossil_tofu_pool_acquire(&flist->pool);
     if (!new_node) {
         return -1;  // Error
     }
-    new_node->data.value.data = fossil_tofu_strdup(data);
+    new_node->data = fossil_tofu_create_typed(flist->type_enum, data);
     new_node->next = NULL;
 
     if (!flist->head) {
@@ -131,8 +136,8 @@ int32_t fossil_tofu_flist_remove(fossil_tofu_flist_t* flist) {
     }
     fossil_tofu_flist_node_t* to_remove = flist->head;
     flist->head = to_remove->next;
-    fossil_tofu_free(to_remove->data.value.data);
-    fossil_tofu_free(to_remove);
+    fossil_tofu_destroy(&to_remove->data);
+    fossil_tofu_pool_release(&flist->pool, to_remove);
     return 0;  // Success
 }
 
@@ -203,7 +208,7 @@ char *fossil_tofu_flist_get(const fossil_tofu_flist_t* flist, size_t index) {
     size_t count = 0;
     while (current) {
         if (count == index) {
-            return current->data.value.data;  // Found the element
+            return fossil_tofu_get_value(&current->data);  // Found the element
         }
         count++;
         current = current->next;
@@ -215,7 +220,7 @@ char *fossil_tofu_flist_get_front(const fossil_tofu_flist_t* flist) {
     if (!flist || !flist->head) {
         return NULL;  // Error
     }
-    return flist->head->data.value.data;
+    return fossil_tofu_get_value(&flist->head->data);
 }
 
 char *fossil_tofu_flist_get_back(const fossil_tofu_flist_t* flist) {
@@ -226,7 +231,7 @@ char *fossil_tofu_flist_get_back(const fossil_tofu_flist_t* flist) {
     while (current->next) {
         current = current->next;
     }
-    return current->data.value.data;
+    return fossil_tofu_get_value(&current->data);
 }
 
 void fossil_tofu_flist_set(fossil_tofu_flist_t* flist, size_t index, char *element) {
@@ -237,8 +242,7 @@ void fossil_tofu_flist_set(fossil_tofu_flist_t* flist, size_t index, char *eleme
     size_t count = 0;
     while (current) {
         if (count == index) {
-            fossil_tofu_free(current->data.value.data);  // Free old data
-            current->data.value.data = fossil_tofu_strdup(element);  // Set new data
+            fossil_tofu_set_value(&current->data, element);
             return;  // Element set successfully
         }
         count++;
@@ -250,8 +254,7 @@ void fossil_tofu_flist_set_front(fossil_tofu_flist_t* flist, char *element) {
     if (!flist || !flist->head) {
         return;  // Error
     }
-    fossil_tofu_free(flist->head->data.value.data);  // Free old data
-    flist->head->data.value.data = fossil_tofu_strdup(element);  // Set new data
+    fossil_tofu_set_value(&flist->head->data, element);
 }
 
 void fossil_tofu_flist_set_back(fossil_tofu_flist_t* flist, char *element) {
@@ -262,6 +265,5 @@ void fossil_tofu_flist_set_back(fossil_tofu_flist_t* flist, char *element) {
     while (current->next) {
         current = current->next;
     }
-    fossil_tofu_free(current->data.value.data);  // Free old data
-    current->data.value.data = fossil_tofu_strdup(element);  // Set new data
+    fossil_tofu_set_value(&current->data, element);
 }
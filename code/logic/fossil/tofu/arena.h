@@ -0,0 +1,224 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TOFU_ARENA_H
+#define FOSSIL_TOFU_ARENA_H
+
+#include "tofu.h"
+
+#define FOSSIL_TOFU_ARENA_DEFAULT_CHUNK 65536 // Default chunk size in bytes
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// Type definitions
+// *****************************************************************************
+
+typedef struct fossil_tofu_arena_chunk_t {
+    struct fossil_tofu_arena_chunk_t *next;
+    size_t capacity; // Usable bytes in this chunk
+    size_t used;     // Bytes handed out from this chunk
+} fossil_tofu_arena_chunk_t;
+
+// A region allocator: memory is bump-allocated from large chunks and released
+// all at once. Individual frees are no-ops. An arena is not thread-safe and
+// must only be used by one thread at a time.
+typedef struct {
+    fossil_tofu_arena_chunk_t *head;    // Chunk currently being filled
+    size_t chunk_size;                  // Size of regular chunks
+    size_t depth;                       // Nesting depth of `fossil_tofu_arena_enter`
+    fossil_tofu_allocator_t parent;     // Allocator the chunks are taken from
+    fossil_tofu_allocator_t saved;      // Thread allocator replaced while entered
+    bool had_saved;                     // Whether the thread had its own allocator
+} fossil_tofu_arena_t;
+
+// *****************************************************************************
+// Function prototypes
+// *****************************************************************************
+
+/**
+ * Create a new arena.
+ *
+ * Chunks are taken from the allocator in effect when the arena is created.
+ *
+ * Time complexity: O(1)
+ *
+ * @param chunk_size The size of each chunk in bytes, or 0 for the default.
+ * @return           The created arena, or NULL on failure.
+ */
+fossil_tofu_arena_t* fossil_tofu_arena_create(size_t chunk_size);
+
+/**
+ * Destroy an arena and release every block allocated from it.
+ *
+ * Time complexity: O(c) in the number of chunks
+ *
+ * @param arena The arena to destroy.
+ */
+void fossil_tofu_arena_destroy(fossil_tofu_arena_t* arena);
+
+/**
+ * Release every block allocated from the arena while keeping one chunk for reuse.
+ *
+ * Containers created in the arena must not be used afterwards.
+ *
+ * Time complexity: O(c) in the number of chunks
+ *
+ * @param arena The arena to reset.
+ */
+void fossil_tofu_arena_reset(fossil_tofu_arena_t* arena);
+
+/**
+ * Allocate a block from the arena.
+ *
+ * Time complexity: O(1) amortized
+ *
+ * @param arena The arena to allocate from.
+ * @param size  The size of the block in bytes.
+ * @return      The block, aligned for any type, or NULL on failure.
+ */
+tofu_memory_t fossil_tofu_arena_alloc(fossil_tofu_arena_t* arena, size_t size);
+
+/**
+ * Get the number of bytes handed out by the arena, including block headers.
+ *
+ * Time complexity: O(c) in the number of chunks
+ *
+ * @param arena The arena to inspect.
+ * @return      The number of bytes in use.
+ */
+size_t fossil_tofu_arena_used(const fossil_tofu_arena_t* arena);
+
+/**
+ * Get allocator hooks that allocate from the arena.
+ *
+ * The hooks can be passed to `fossil_tofu_set_thread_allocator`; freeing
+ * through them is a no-op.
+ *
+ * Time complexity: O(1)
+ *
+ * @param arena The arena to allocate from.
+ * @return      The allocator hooks.
+ */
+fossil_tofu_allocator_t fossil_tofu_arena_allocator(fossil_tofu_arena_t* arena);
+
+/**
+ * Route the calling thread's tofu allocations to the arena.
+ *
+ * Calls nest; the previous thread allocator is restored by the matching
+ * outermost `fossil_tofu_arena_leave`. A NULL arena is ignored, so containers
+ * can call this unconditionally.
+ *
+ * Time complexity: O(1)
+ *
+ * @param arena The arena to allocate from, or NULL.
+ */
+void fossil_tofu_arena_enter(fossil_tofu_arena_t* arena);
+
+/**
+ * Undo one `fossil_tofu_arena_enter` on the calling thread.
+ *
+ * Time complexity: O(1)
+ *
+ * @param arena The arena passed to `fossil_tofu_arena_enter`, or NULL.
+ */
+void fossil_tofu_arena_leave(fossil_tofu_arena_t* arena);
+
+#ifdef __cplusplus
+}
+#include <stdexcept>
+
+namespace fossil {
+
+    namespace tofu {
+
+        /**
+         * A wrapper class for the fossil_tofu_arena_t structure. The arena and every
+         * block allocated from it are released when the wrapper is destroyed.
+         */
+        class Arena {
+        public:
+            /**
+             * Constructor that creates a new arena.
+             * Throws a runtime_error if the arena creation fails.
+             *
+             * @param chunk_size The size of each chunk in bytes, or 0 for the default.
+             */
+            explicit Arena(size_t chunk_size = 0) : arena(fossil_tofu_arena_create(chunk_size)) {
+                if (arena == nullptr) {
+                    throw std::runtime_error("Failed to create arena");
+                }
+            }
+
+            Arena(const Arena&) = delete;
+            Arena& operator=(const Arena&) = delete;
+
+            /**
+             * Destructor. Releases the arena and all memory allocated from it.
+             */
+            ~Arena() {
+                fossil_tofu_arena_destroy(arena);
+            }
+
+            /**
+             * Releases every block allocated from the arena.
+             */
+            void reset() {
+                fossil_tofu_arena_reset(arena);
+            }
+
+            /**
+             * Gets the number of bytes handed out by the arena.
+             *
+             * @return The number of bytes in use.
+             */
+            size_t used() const {
+                return fossil_tofu_arena_used(arena);
+            }
+
+            /**
+             * Gets the underlying arena.
+             *
+             * @return A pointer to the underlying fossil_tofu_arena_t structure.
+             */
+            fossil_tofu_arena_t* get() const {
+                return arena;
+            }
+
+        private:
+            /**
+             * A pointer to the underlying fossil_tofu_arena_t structure.
+             */
+            fossil_tofu_arena_t* arena;
+        };
+
+    } // namespace tofu
+
+} // namespace fossil
+
+#endif
+
+#endif /* FOSSIL_TOFU_ARENA_H */
@@ -40,6 +40,7 @@ typedef struct {
     size_t size;
     size_t capacity;
     char* type;
+    fossil_tofu_type_t type_enum; // Resolved once from `type` at creation
 } fossil_tofu_array_t;
 
 /**
@@ -110,6 +111,19 @@ void fossil_tofu_array_destroy(fossil_tofu_array_t* array);
  */
 void fossil_tofu_array_push_back(fossil_tofu_array_t* array, char *element);
 
+/**
+ * Adds several elements to the end of the array.
+ *
+ * This function reserves room for all elements at once and builds them with
+ * `fossil_tofu_create_batch`, so their payloads share one allocation.
+ *
+ * @param array    Pointer to the array.
+ * @param elements The elements to add (as strings).
+ * @param count    The number of elements.
+ * @return FOSSIL_TOFU_SUCCESS on success, FOSSIL_TOFU_FAILURE otherwise.
+ */
+int32_t fossil_tofu_array_push_back_many(fossil_tofu_array_t* array, char **elements, size_t count);
+
 /**
  * Adds an element to the front of the array.
  *
@@ -236,6 +250,10 @@ size_t fossil_tofu_array_size(const fossil_tofu_array_t* array);
  */
 size_t fossil_tofu_array_capacity(const fossil_tofu_array_t* array);
 
+// The getters below point at text stored in the array's own elements, inline
+// for short strings. Any push, pop, erase or set may move or replace that
+// storage, so a returned string is only valid until the array changes.
+
 /**
  * Retrieves the element at the specified index in the array.
  *
@@ -244,7 +262,8 @@ size_t fossil_tofu_array_capacity(const fossil_tofu_array_t* array);
  *
  * @param array Pointer to the array.
  * @param index The index of the element to retrieve.
- * @return      Pointer to the element string, or NULL if out of bounds.
+ * @return      Pointer to the element string, or NULL if out of bounds;
+ *              valid until the array changes.
  */
 char *fossil_tofu_array_get(const fossil_tofu_array_t* array, size_t index);
 
@@ -254,7 +273,8 @@ char *fossil_tofu_array_get(const fossil_tofu_array_t* array, size_t index);
  * This function returns a pointer to the first element string, or NULL if the array is empty.
  *
  * @param array Pointer to the array.
- * @return      Pointer to the first element string, or NULL if the array is empty.
+ * @return      Pointer to the first element string, or NULL if the array is empty;
+ *              valid until the array changes.
  */
 char *fossil_tofu_array_get_front(const fossil_tofu_array_t* array);
 
@@ -264,7 +284,8 @@ char *fossil_tofu_array_get_front(const fossil_tofu_array_t* array);
  * This function returns a pointer to the last element string, or NULL if the array is empty.
  *
  * @param array Pointer to the array.
- * @return      Pointer to the last element string, or NULL if the array is empty.
+ * @return      Pointer to the last element string, or NULL if the array is empty;
+ *              valid until the array changes.
  */
 char *fossil_tofu_array_get_back(const fossil_tofu_array_t* array);
 
@@ -276,7 +297,8 @@ char *fossil_tofu_array_get_back(const fossil_tofu_array_t* array);
  *
  * @param array Pointer to the array.
  * @param index The index of the element to retrieve.
- * @return      Pointer to the element string, or NULL if out of bounds.
+ * @return      Pointer to the element string, or NULL if out of bounds;
+ *              valid until the array changes.
  */
 char *fossil_tofu_array_get_at(const fossil_tofu_array_t* array, size_t index);
 
@@ -330,6 +352,7 @@ void fossil_tofu_array_set_at(fossil_tofu_array_t* array, size_t index, char *el
 }
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace fossil {
 
@@ -425,6 +448,25 @@ namespace fossil {
                 fossil_tofu_array_push_back(array, const_cast<char*>(element.c_str()));
             }
 
+            /**
+             * Adds several elements to the end of the array.
+             *
+             * Appends all elements in one batch by calling
+             * fossil_tofu_array_push_back_many. Throws a runtime_error on failure.
+             *
+             * @param elements The elements to add.
+             */
+            void push_back_many(const std::vector<std::string>& elements) {
+                std::vector<char*> ptrs;
+                ptrs.reserve(elements.size());
+                for (const auto& element : elements) {
+                    ptrs.push_back(const_cast<char*>(element.c_str()));
+                }
+                if (fossil_tofu_array_push_back_many(array, ptrs.data(), ptrs.size()) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to add elements");
+                }
+            }
+
             /**
              * Adds an element to the front of the array.
              *
@@ -47,6 +47,7 @@ typedef struct fossil_tofu_arraylist_t {
     size_t capacity;
     size_t size;
     char* type;
+    fossil_tofu_type_t type_enum; // Resolved once from `type` at creation
 } fossil_tofu_arraylist_t;
 
 // *****************************************************************************
@@ -131,6 +132,21 @@ void fossil_tofu_arraylist_destroy(fossil_tofu_arraylist_t* alist);
  */
 int32_t fossil_tofu_arraylist_insert(fossil_tofu_arraylist_t* alist, char *data);
 
+/**
+ * @brief Insert several elements into the array list.
+ *
+ * Adds the elements to the end of the array list, growing it at most once and
+ * building the elements with `fossil_tofu_create_batch` so their payloads
+ * share one allocation.
+ *
+ * @param alist Pointer to the array list to insert data into.
+ * @param data  Array of data to insert (as strings).
+ * @param count Number of elements in `data`.
+ * @return      Error code indicating success (0) or failure (non-zero).
+ * @complexity  O(n) in the number of inserted elements
+ */
+int32_t fossil_tofu_arraylist_insert_many(fossil_tofu_arraylist_t* alist, char **data, size_t count);
+
 /**
  * @brief Remove data from the array list at the specified index.
  *
@@ -287,6 +303,7 @@ void fossil_tofu_arraylist_set_back(fossil_tofu_arraylist_t* alist, char *elemen
 }
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace fossil {
 
@@ -372,6 +389,24 @@ namespace fossil {
                 fossil_tofu_arraylist_insert(alist, const_cast<char*>(data.c_str()));
             }
 
+            /**
+             * @brief Insert several elements into the array list in one batch.
+             *
+             * Throws a runtime_error if the elements could not be inserted.
+             *
+             * @param data The data to insert.
+             */
+            void insert_many(const std::vector<std::string>& data) {
+                std::vector<char*> ptrs;
+                ptrs.reserve(data.size());
+                for (const auto& item : data) {
+                    ptrs.push_back(const_cast<char*>(item.c_str()));
+                }
+                if (fossil_tofu_arraylist_insert_many(alist, ptrs.data(), ptrs.size()) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to insert elements");
+                }
+            }
+
             /**
              * @brief Remove data from the array list at the specified index.
              *
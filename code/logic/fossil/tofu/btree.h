@@ -0,0 +1,443 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TOFU_BTREE_H
+#define FOSSIL_TOFU_BTREE_H
+
+#include "tofu.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// *****************************************************************************
+// Type definitions
+// *****************************************************************************
+
+#define FOSSIL_TOFU_BTREE_ORDER 32                             // Most keys a node holds
+#define FOSSIL_TOFU_BTREE_MIN_KEYS (FOSSIL_TOFU_BTREE_ORDER / 2) // Fewest keys a non-root node keeps
+#define FOSSIL_TOFU_BTREE_MAX_DEPTH 32                         // Deeper than any tree that fits in memory
+
+// A node of the B+-tree. Every element lives in a leaf; internal nodes hold
+// separator copies, where `keys[i]` is above every key under `children[i]`
+// and at most every key under `children[i + 1]`. Leaves are linked in key
+// order so ranges are read without going back up the tree.
+typedef struct fossil_tofu_btree_node_t {
+    fossil_tofu_t keys[FOSSIL_TOFU_BTREE_ORDER]; // Sorted keys, `count` in use
+    size_t count; // Number of keys in use
+    bool leaf; // Whether the node is a leaf
+    struct fossil_tofu_btree_node_t* children[FOSSIL_TOFU_BTREE_ORDER + 1]; // Internal nodes: `count + 1` children
+    struct fossil_tofu_btree_node_t* prev; // Leaves: the previous leaf in key order
+    struct fossil_tofu_btree_node_t* next; // Leaves: the next leaf in key order
+} fossil_tofu_btree_node_t;
+
+// Ordered set of elements kept in a B+-tree of wide nodes
+typedef struct fossil_tofu_btree_t {
+    char* type; // Type of the tree
+    fossil_tofu_type_t type_enum; // Resolved once from `type` at creation
+    fossil_tofu_btree_node_t* root; // NULL while the tree is empty
+    fossil_tofu_btree_node_t* first; // Leftmost leaf
+    fossil_tofu_btree_node_t* last; // Rightmost leaf
+    size_t size; // Number of elements in the tree
+} fossil_tofu_btree_t;
+
+// Position of one element in a B+-tree. Any insert or remove invalidates it.
+typedef struct fossil_tofu_btree_iterator_t {
+    const fossil_tofu_btree_node_t* leaf; // NULL once the iterator has left either end
+    size_t index; // Key index within `leaf`
+} fossil_tofu_btree_iterator_t;
+
+// *****************************************************************************
+// Function prototypes
+// *****************************************************************************
+
+/**
+ * @brief Creates a new B+-tree for elements of the specified type.
+ *
+ * @param type The type of elements that the tree will contain.
+ * @return A pointer to the newly created tree, or NULL if allocation fails
+ *         or `type` is "null".
+ */
+fossil_tofu_btree_t* fossil_tofu_btree_create_container(char* type);
+
+/**
+ * @brief Creates a new B+-tree with default settings.
+ *
+ * @return A pointer to the newly created default tree.
+ */
+fossil_tofu_btree_t* fossil_tofu_btree_create_default(void);
+
+/**
+ * @brief Creates a copy of the given tree.
+ *
+ * @param other The tree to copy.
+ * @return A pointer to the newly created copy of the tree.
+ * @note Time complexity: O(n)
+ */
+fossil_tofu_btree_t* fossil_tofu_btree_create_copy(const fossil_tofu_btree_t* other);
+
+/**
+ * @brief Moves the given tree to a new tree container.
+ *
+ * @param other The tree to move.
+ * @return A pointer to the newly created tree container with the moved tree,
+ *         or NULL if `other` is NULL or allocation fails.
+ */
+fossil_tofu_btree_t* fossil_tofu_btree_create_move(fossil_tofu_btree_t* other);
+
+/**
+ * @brief Destroys the given tree and frees its resources.
+ *
+ * @param tree The tree to destroy.
+ */
+void fossil_tofu_btree_destroy(fossil_tofu_btree_t* tree);
+
+/**
+ * @brief Inserts data into the tree. Inserting an element already present leaves the tree unchanged.
+ *
+ * @param tree The tree to insert data into.
+ * @param data The data to insert.
+ * @return An integer indicating success (0) or failure (non-zero).
+ * @note Time complexity: O(log n)
+ */
+int32_t fossil_tofu_btree_insert(fossil_tofu_btree_t* tree, char *data);
+
+/**
+ * @brief Fills an empty tree from data sorted in ascending order.
+ *
+ * The leaves are written left to right and the index built bottom-up, without
+ * any splits. Repeated elements are stored once.
+ *
+ * @param tree  The empty tree to fill.
+ * @param data  The data to insert, in ascending order.
+ * @param count The number of elements in `data`.
+ * @return FOSSIL_TOFU_SUCCESS, or FOSSIL_TOFU_FAILURE if the tree is not empty,
+ *         `data` is out of order, or memory could not be allocated; the tree
+ *         is left empty on failure.
+ * @note Time complexity: O(n)
+ */
+int32_t fossil_tofu_btree_bulk_load(fossil_tofu_btree_t* tree, char **data, size_t count);
+
+/**
+ * @brief Removes data from the tree.
+ *
+ * @param tree The tree to remove data from.
+ * @param data The data to remove.
+ * @return An integer indicating success (0) or failure (non-zero).
+ * @note Time complexity: O(log n)
+ */
+int32_t fossil_tofu_btree_remove(fossil_tofu_btree_t* tree, char *data);
+
+/**
+ * @brief Checks if the tree contains the specified data.
+ *
+ * @param tree The tree to check.
+ * @param data The data to check for.
+ * @return True if the tree contains the data, false otherwise.
+ * @note Time complexity: O(log n)
+ */
+bool fossil_tofu_btree_contains(const fossil_tofu_btree_t* tree, char *data);
+
+/**
+ * @brief Removes every element from the tree.
+ *
+ * @param tree The tree to clear.
+ */
+void fossil_tofu_btree_clear(fossil_tofu_btree_t* tree);
+
+/**
+ * @brief Gets the number of elements in the tree.
+ *
+ * @param tree The tree to get the size of.
+ * @return The number of elements in the tree.
+ */
+size_t fossil_tofu_btree_size(const fossil_tofu_btree_t* tree);
+
+/**
+ * @brief Checks if the tree is empty.
+ *
+ * @param tree The tree to check.
+ * @return True if the tree is empty, false otherwise.
+ */
+bool fossil_tofu_btree_is_empty(const fossil_tofu_btree_t* tree);
+
+// Element getters, the iterator's included, point at keys stored in the leaves
+// with short text inline. An insert or remove can split, merge or shift those
+// keys, so a returned string is only valid until the tree is next modified.
+
+/**
+ * @brief Gets the smallest element in the tree.
+ *
+ * @param tree The tree to read.
+ * @return The smallest element, or NULL if the tree is empty; valid until the tree changes.
+ * @note Time complexity: O(1)
+ */
+char *fossil_tofu_btree_get_front(const fossil_tofu_btree_t* tree);
+
+/**
+ * @brief Gets the largest element in the tree.
+ *
+ * @param tree The tree to read.
+ * @return The largest element, or NULL if the tree is empty; valid until the tree changes.
+ * @note Time complexity: O(1)
+ */
+char *fossil_tofu_btree_get_back(const fossil_tofu_btree_t* tree);
+
+// *****************************************************************************
+// Iteration
+// *****************************************************************************
+
+/**
+ * @brief Gets an iterator at the smallest element.
+ *
+ * @param tree The tree to iterate.
+ * @return The iterator, past the end if the tree is empty.
+ */
+fossil_tofu_btree_iterator_t fossil_tofu_btree_begin(const fossil_tofu_btree_t* tree);
+
+/**
+ * @brief Gets an iterator at the largest element, to walk the tree backwards.
+ *
+ * @param tree The tree to iterate.
+ * @return The iterator, past the end if the tree is empty.
+ */
+fossil_tofu_btree_iterator_t fossil_tofu_btree_rbegin(const fossil_tofu_btree_t* tree);
+
+/**
+ * @brief Gets an iterator at the first element not less than `data`.
+ *
+ * @param tree The tree to search.
+ * @param data The bound.
+ * @return The iterator, past the end if every element is less than `data`.
+ * @note Time complexity: O(log n)
+ */
+fossil_tofu_btree_iterator_t fossil_tofu_btree_lower_bound(const fossil_tofu_btree_t* tree, char *data);
+
+/**
+ * @brief Gets an iterator at the first element greater than `data`.
+ *
+ * @param tree The tree to search.
+ * @param data The bound.
+ * @return The iterator, past the end if no element is greater than `data`.
+ * @note Time complexity: O(log n)
+ */
+fossil_tofu_btree_iterator_t fossil_tofu_btree_upper_bound(const fossil_tofu_btree_t* tree, char *data);
+
+/**
+ * @brief Checks if an iterator is at an element.
+ *
+ * @param iterator The iterator to check.
+ * @return True if the iterator is at an element, false once it has left either end.
+ */
+bool fossil_tofu_btree_iterator_valid(const fossil_tofu_btree_iterator_t* iterator);
+
+/**
+ * @brief Gets the element an iterator is at.
+ *
+ * @param iterator The iterator to read.
+ * @return The element, or NULL if the iterator is not at one; valid until the tree changes.
+ */
+char *fossil_tofu_btree_iterator_get(const fossil_tofu_btree_iterator_t* iterator);
+
+/**
+ * @brief Moves an iterator to the next larger element.
+ *
+ * @param iterator The iterator to advance.
+ * @note Time complexity: O(1)
+ */
+void fossil_tofu_btree_iterator_next(fossil_tofu_btree_iterator_t* iterator);
+
+/**
+ * @brief Moves an iterator to the next smaller element.
+ *
+ * @param iterator The iterator to move back.
+ * @note Time complexity: O(1)
+ */
+void fossil_tofu_btree_iterator_prev(fossil_tofu_btree_iterator_t* iterator);
+
+#ifdef __cplusplus
+}
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace fossil {
+
+    namespace tofu {
+
+        /**
+         * @class BTree
+         * @brief A C++ wrapper class for an ordered set kept in a B+-tree using the Fossil Logic library.
+         */
+        class BTree {
+        public:
+            /**
+             * @brief Constructs a new BTree object with the specified type.
+             * 
+             * @param type The type of elements that the tree will contain.
+             * @throws std::runtime_error If the tree cannot be created.
+             */
+            BTree(const std::string& type) {
+                tree_ = fossil_tofu_btree_create_container(const_cast<char*>(type.c_str()));
+                if (!tree_) {
+                    throw std::runtime_error("Failed to create B+-tree.");
+                }
+            }
+
+            /**
+             * @brief Destroys the BTree object and releases its resources.
+             */
+            ~BTree() {
+                fossil_tofu_btree_destroy(tree_);
+            }
+
+            BTree(const BTree&) = delete;
+            BTree& operator=(const BTree&) = delete;
+
+            /**
+             * @brief Inserts a new element into the tree.
+             * 
+             * @param data The element to insert.
+             * @throws std::runtime_error If the insertion fails.
+             */
+            void insert(const std::string& data) {
+                if (fossil_tofu_btree_insert(tree_, const_cast<char*>(data.c_str())) != 0) {
+                    throw std::runtime_error("Failed to insert data into B+-tree.");
+                }
+            }
+
+            /**
+             * @brief Fills the empty tree from elements sorted in ascending order.
+             * 
+             * @param data The elements to load.
+             * @throws std::runtime_error If the tree is not empty, the data is out of order, or loading fails.
+             */
+            void bulk_load(const std::vector<std::string>& data) {
+                std::vector<char*> pointers;
+                pointers.reserve(data.size());
+                for (const std::string& item : data) {
+                    pointers.push_back(const_cast<char*>(item.c_str()));
+                }
+                if (fossil_tofu_btree_bulk_load(tree_, pointers.data(), pointers.size()) != 0) {
+                    throw std::runtime_error("Failed to bulk load B+-tree.");
+                }
+            }
+
+            /**
+             * @brief Removes an element from the tree.
+             * 
+             * @param data The element to remove.
+             * @throws std::runtime_error If the removal fails.
+             */
+            void remove(const std::string& data) {
+                if (fossil_tofu_btree_remove(tree_, const_cast<char*>(data.c_str())) != 0) {
+                    throw std::runtime_error("Failed to remove data from B+-tree.");
+                }
+            }
+
+            /**
+             * @brief Checks if the tree contains the specified element.
+             * 
+             * @param data The element to check for.
+             * @return True if the tree contains the element, false otherwise.
+             */
+            bool contains(const std::string& data) const {
+                return fossil_tofu_btree_contains(tree_, const_cast<char*>(data.c_str()));
+            }
+
+            /**
+             * @brief Collects the elements in the half-open range [low, high), in ascending order.
+             * 
+             * @param low  The inclusive lower bound.
+             * @param high The exclusive upper bound.
+             * @return The elements in range.
+             */
+            std::vector<std::string> range(const std::string& low, const std::string& high) const {
+                std::vector<std::string> result;
+                fossil_tofu_btree_iterator_t it = fossil_tofu_btree_lower_bound(tree_, const_cast<char*>(low.c_str()));
+                fossil_tofu_btree_iterator_t end = fossil_tofu_btree_lower_bound(tree_, const_cast<char*>(high.c_str()));
+                while (fossil_tofu_btree_iterator_valid(&it) && (it.leaf != end.leaf || it.index != end.index)) {
+                    result.emplace_back(fossil_tofu_btree_iterator_get(&it));
+                    fossil_tofu_btree_iterator_next(&it);
+                }
+                return result;
+            }
+
+            /**
+             * @brief Removes every element from the tree.
+             */
+            void clear() {
+                fossil_tofu_btree_clear(tree_);
+            }
+
+            /**
+             * @brief Gets the number of elements in the tree.
+             * 
+             * @return The number of elements in the tree.
+             */
+            size_t size() const {
+                return fossil_tofu_btree_size(tree_);
+            }
+
+            /**
+             * @brief Checks if the tree is empty.
+             * 
+             * @return True if the tree is empty, false otherwise.
+             */
+            bool is_empty() const {
+                return fossil_tofu_btree_is_empty(tree_);
+            }
+
+            /**
+             * @brief Gets the smallest element in the tree.
+             * 
+             * @return The smallest element, or an empty string if the tree is empty.
+             */
+            std::string get_front() const {
+                char* result = fossil_tofu_btree_get_front(tree_);
+                return result ? std::string(result) : std::string();
+            }
+
+            /**
+             * @brief Gets the largest element in the tree.
+             * 
+             * @return The largest element, or an empty string if the tree is empty.
+             */
+            std::string get_back() const {
+                char* result = fossil_tofu_btree_get_back(tree_);
+                return result ? std::string(result) : std::string();
+            }
+
+        private:
+            fossil_tofu_btree_t* tree_; /**< Pointer to the underlying C tree structure. */
+        };
+
+    } // namespace tofu
+
+} // namespace fossil
+
+#endif
+
+#endif /* FOSSIL_TOFU_BTREE_H */
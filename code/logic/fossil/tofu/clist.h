@@ -26,6 +26,7 @@
 #define FOSSIL_TOFU_CIRCALIRLIST_H
 
 #include "tofu.h"
+#include "pool.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -47,6 +48,8 @@ typedef struct fossil_tofu_clist_node_t {
 typedef struct fossil_tofu_clist_t {
     fossil_tofu_clist_node_t* head;  // Head node
     char* type;                 // Data type string
+    fossil_tofu_type_t type_enum; // Resolved once from `type` at creation
+    fossil_tofu_pool_t pool;      // Slab pool the nodes are taken from
 } fossil_tofu_clist_t;
 
 // *****************************************************************************
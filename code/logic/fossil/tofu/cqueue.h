@@ -36,21 +36,22 @@ extern "C"
 // Type definitions
 // *****************************************************************************
 
-// Node structure for the circular queue
-typedef struct fossil_tofu_cqueue_node_t {
-    fossil_tofu_t data;
-    struct fossil_tofu_cqueue_node_t* next;
-} fossil_tofu_cqueue_node_t;
-
-// Circular queue structure
+// Circular queue structure, a fixed ring of `capacity` slots allocated up front
 typedef struct fossil_tofu_cqueue_t {
-    fossil_tofu_cqueue_node_t* front;
-    fossil_tofu_cqueue_node_t* rear;
+    fossil_tofu_t* slots;         // Slot storage, NULL when capacity is zero
+    size_t head;                  // Slot holding the front element
+    size_t tail;                  // Slot the next insert is written to
     char* type;
+    fossil_tofu_type_t type_enum; // Resolved once from `type` at creation
     size_t capacity;
     size_t size;
+    bool overwrite;               // A full queue drops its oldest element on insert
 } fossil_tofu_cqueue_t;
 
+// Single-producer/single-consumer circular queue. Its indices are atomics,
+// so the layout is private to cqueue.c and the type is only used by pointer.
+typedef struct fossil_tofu_cqueue_spsc_t fossil_tofu_cqueue_spsc_t;
+
 // *****************************************************************************
 // Function prototypes
 // *****************************************************************************
@@ -62,11 +63,25 @@ typedef struct fossil_tofu_cqueue_t {
  * @param capacity The maximum number of elements the queue can hold.
  * @return         Pointer to the created circular queue structure, or NULL on failure.
  * @note           Time complexity: O(1)
- * @details        Allocates memory for a circular queue and initializes its members.
- *                 The queue will be able to store up to 'capacity' elements of the specified type.
+ * @details        Allocates the queue and all of its slots at once; inserting and removing
+ *                 never allocate afterwards. The queue will be able to store up to 'capacity'
+ *                 elements of the specified type.
  */
 fossil_tofu_cqueue_t* fossil_tofu_cqueue_create_container(char* type, size_t capacity);
 
+/**
+ * Create a new circular queue that overwrites its oldest element when full.
+ *
+ * @param type     The type of data the queue will store as a string.
+ * @param capacity The maximum number of elements the queue can hold.
+ * @return         Pointer to the created circular queue structure, or NULL on failure.
+ * @note           Time complexity: O(1)
+ * @details        Like fossil_tofu_cqueue_create_container, but inserting into a full queue
+ *                 drops the front element and succeeds instead of failing, so the queue
+ *                 always holds the latest 'capacity' elements.
+ */
+fossil_tofu_cqueue_t* fossil_tofu_cqueue_create_overwrite(char* type, size_t capacity);
+
 /**
  * Create a new circular queue with default values.
  *
@@ -103,7 +118,7 @@ fossil_tofu_cqueue_t* fossil_tofu_cqueue_create_move(fossil_tofu_cqueue_t* other
  *
  * @param queue Pointer to the circular queue to erase.
  * @note        Time complexity: O(n)
- * @details     Frees all memory associated with the queue, including all nodes and metadata.
+ * @details     Frees all memory associated with the queue, including all slots and metadata.
  *              After calling this function, the queue pointer should not be used.
  */
 void fossil_tofu_cqueue_destroy(fossil_tofu_cqueue_t* queue);
@@ -121,6 +136,8 @@ void fossil_tofu_cqueue_destroy(fossil_tofu_cqueue_t* queue);
  * @note        Time complexity: O(1)
  * @details     Adds the specified data to the rear of the queue.
  *              Returns 0 on success, or a negative error code on failure (e.g., if the queue is full).
+ *              A queue created with fossil_tofu_cqueue_create_overwrite drops its front element
+ *              instead of failing when full.
  */
 int32_t fossil_tofu_cqueue_insert(fossil_tofu_cqueue_t* queue, char *data);
 
@@ -185,6 +202,16 @@ bool fossil_tofu_cqueue_is_empty(const fossil_tofu_cqueue_t* queue);
  */
 bool fossil_tofu_cqueue_is_cnullptr(const fossil_tofu_cqueue_t* queue);
 
+/**
+ * Check if the circular queue is full.
+ *
+ * @param queue Pointer to the circular queue to check.
+ * @return      True if every slot holds an element, false otherwise.
+ * @note        Time complexity: O(1)
+ * @details     Returns false for a NULL queue.
+ */
+bool fossil_tofu_cqueue_is_full(const fossil_tofu_cqueue_t* queue);
+
 // *****************************************************************************
 // Getter and setter functions
 // *****************************************************************************
@@ -229,6 +256,98 @@ void fossil_tofu_cqueue_set_front(fossil_tofu_cqueue_t* queue, char *element);
  */
 void fossil_tofu_cqueue_set_rear(fossil_tofu_cqueue_t* queue, char *element);
 
+// *****************************************************************************
+// Single-producer/single-consumer functions
+// *****************************************************************************
+
+/**
+ * Create a lock-free circular queue for one producer thread and one consumer thread.
+ *
+ * @param type     The type of data the queue will store as a string.
+ * @param capacity The maximum number of elements the queue can hold.
+ * @return         Pointer to the created queue, or NULL on failure.
+ * @note           Time complexity: O(1)
+ * @details        All slots are allocated here. Exactly one thread may push and exactly one
+ *                 other thread may pop at a time; neither side ever blocks or waits on the other.
+ *                 The producer and consumer indices sit on separate cache lines.
+ *                 Elements are created on the producer and destroyed on the consumer, so
+ *                 the two threads must share an allocator; see `fossil_tofu_set_thread_allocator`.
+ */
+fossil_tofu_cqueue_spsc_t* fossil_tofu_cqueue_create_spsc(char* type, size_t capacity);
+
+/**
+ * Destroy a single-producer/single-consumer queue and any elements still in it.
+ *
+ * @param queue Pointer to the queue to destroy.
+ * @note        Time complexity: O(n)
+ * @details     Neither the producer nor the consumer may be using the queue.
+ */
+void fossil_tofu_cqueue_spsc_destroy(fossil_tofu_cqueue_spsc_t* queue);
+
+/**
+ * Push data onto the rear of the queue from the producer thread.
+ *
+ * @param queue Pointer to the queue.
+ * @param data  Pointer to the data to insert as a string.
+ * @return      FOSSIL_TOFU_SUCCESS, or FOSSIL_TOFU_FAILURE if the queue is full.
+ * @note        Time complexity: O(1), wait-free
+ */
+int32_t fossil_tofu_cqueue_spsc_try_push(fossil_tofu_cqueue_spsc_t* queue, char *data);
+
+/**
+ * Pop the front element from the consumer thread.
+ *
+ * @param queue Pointer to the queue.
+ * @param out   Receives the element, which the caller then owns and must pass to
+ *              fossil_tofu_destroy. May be NULL to discard the element.
+ * @return      FOSSIL_TOFU_SUCCESS, or FOSSIL_TOFU_FAILURE if the queue is empty.
+ * @note        Time complexity: O(1), wait-free
+ */
+int32_t fossil_tofu_cqueue_spsc_try_pop(fossil_tofu_cqueue_spsc_t* queue, fossil_tofu_t* out);
+
+/**
+ * Push up to `count` elements from the producer thread, publishing them with a single
+ * atomic store.
+ *
+ * @param queue Pointer to the queue.
+ * @param data  Array of `count` strings to insert, in order.
+ * @param count Number of strings in `data`.
+ * @return      The number of elements pushed, which is less than `count` if the queue filled up
+ *              or a NULL string was reached.
+ * @note        Time complexity: O(count), wait-free
+ */
+size_t fossil_tofu_cqueue_spsc_push_n(fossil_tofu_cqueue_spsc_t* queue, char* const* data, size_t count);
+
+/**
+ * Pop up to `max` elements from the consumer thread, releasing their slots with a single
+ * atomic store.
+ *
+ * @param queue Pointer to the queue.
+ * @param out   Array receiving the elements in order; the caller owns each one.
+ * @param max   Capacity of `out`.
+ * @return      The number of elements popped.
+ * @note        Time complexity: O(max), wait-free
+ */
+size_t fossil_tofu_cqueue_spsc_pop_n(fossil_tofu_cqueue_spsc_t* queue, fossil_tofu_t* out, size_t max);
+
+/**
+ * Get the number of elements in the queue.
+ *
+ * @param queue Pointer to the queue.
+ * @return      The number of elements; only a snapshot while the other thread is active.
+ * @note        Time complexity: O(1)
+ */
+size_t fossil_tofu_cqueue_spsc_size(const fossil_tofu_cqueue_spsc_t* queue);
+
+/**
+ * Get the capacity the queue was created with.
+ *
+ * @param queue Pointer to the queue.
+ * @return      The maximum number of elements the queue can hold.
+ * @note        Time complexity: O(1)
+ */
+size_t fossil_tofu_cqueue_spsc_capacity(const fossil_tofu_cqueue_spsc_t* queue);
+
 #ifdef __cplusplus
 }
 #include <stdexcept>
@@ -264,6 +383,23 @@ namespace fossil {
             }
             }
 
+            /**
+             * @brief Create a new circular queue, optionally overwriting its oldest element when full.
+             *
+             * @param type      The type of data the queue will store as a string.
+             * @param capacity  The maximum number of elements the queue can hold.
+             * @param overwrite True to drop the front element when inserting into a full queue.
+             * @throws std::runtime_error If the queue creation fails.
+             */
+            CQueue(const std::string& type, size_t capacity, bool overwrite) {
+            queue = overwrite
+                ? fossil_tofu_cqueue_create_overwrite(const_cast<char*>(type.c_str()), capacity)
+                : fossil_tofu_cqueue_create_container(const_cast<char*>(type.c_str()), capacity);
+            if (queue == nullptr) {
+                throw std::runtime_error("Failed to create circular queue.");
+            }
+            }
+
             /**
              * @brief Create a new circular queue with default values.
              *
@@ -308,7 +444,7 @@ namespace fossil {
             /**
              * @brief Destructor. Destroys the circular queue and frees allocated memory.
              *
-             * Frees all memory associated with the queue, including all nodes and metadata.
+             * Frees all memory associated with the queue, including all slots and metadata.
              */
             ~CQueue() {
             fossil_tofu_cqueue_destroy(queue);
@@ -440,6 +576,15 @@ namespace fossil {
             fossil_tofu_cqueue_set_rear(queue, const_cast<char*>(element.c_str()));
             }
 
+            /**
+             * @brief Check if the circular queue is full.
+             *
+             * @return True if every slot holds an element, false otherwise.
+             */
+            bool is_full() const {
+            return fossil_tofu_cqueue_is_full(queue);
+            }
+
             /**
              * @brief Get the type of data the circular queue stores.
              *
@@ -469,6 +614,91 @@ namespace fossil {
             fossil_tofu_cqueue_t* queue;
         };
 
+        /**
+         * @class SpscCQueue
+         * @brief C++ wrapper for the single-producer/single-consumer circular queue.
+         *
+         * One thread may call try_push while another calls try_pop. The queue is neither
+         * copyable nor movable, because both threads hold on to it.
+         */
+        class SpscCQueue {
+        public:
+            /**
+             * @brief Create a lock-free queue with the specified data type and capacity.
+             *
+             * @param type     The type of data the queue will store as a string.
+             * @param capacity The maximum number of elements the queue can hold.
+             * @throws std::runtime_error If the queue creation fails.
+             */
+            SpscCQueue(const std::string& type, size_t capacity) {
+            queue = fossil_tofu_cqueue_create_spsc(const_cast<char*>(type.c_str()), capacity);
+            if (queue == nullptr) {
+                throw std::runtime_error("Failed to create single-producer/single-consumer queue.");
+            }
+            }
+
+            SpscCQueue(const SpscCQueue&) = delete;
+            SpscCQueue& operator=(const SpscCQueue&) = delete;
+
+            /**
+             * @brief Destructor. Destroys the queue and any elements still in it.
+             */
+            ~SpscCQueue() {
+            fossil_tofu_cqueue_spsc_destroy(queue);
+            }
+
+            /**
+             * @brief Push data onto the rear of the queue. Producer thread only.
+             *
+             * @param data The data to insert as a std::string.
+             * @return     True on success, false if the queue is full.
+             */
+            bool try_push(const std::string& data) {
+            return fossil_tofu_cqueue_spsc_try_push(queue, const_cast<char*>(data.c_str())) == FOSSIL_TOFU_SUCCESS;
+            }
+
+            /**
+             * @brief Pop the front element. Consumer thread only.
+             *
+             * @param out Receives the element's value as a std::string.
+             * @return    True on success, false if the queue is empty.
+             */
+            bool try_pop(std::string& out) {
+            fossil_tofu_t element;
+            if (fossil_tofu_cqueue_spsc_try_pop(queue, &element) != FOSSIL_TOFU_SUCCESS) {
+                return false;
+            }
+            char* value = fossil_tofu_get_value(&element);
+            out = value ? std::string(value) : std::string();
+            fossil_tofu_destroy(&element);
+            return true;
+            }
+
+            /**
+             * @brief Get the number of elements in the queue.
+             *
+             * @return A snapshot of the element count.
+             */
+            size_t size() const {
+            return fossil_tofu_cqueue_spsc_size(queue);
+            }
+
+            /**
+             * @brief Get the capacity of the queue.
+             *
+             * @return The maximum number of elements the queue can hold.
+             */
+            size_t capacity() const {
+            return fossil_tofu_cqueue_spsc_capacity(queue);
+            }
+
+        private:
+            /**
+             * @brief Pointer to the underlying C single-producer/single-consumer queue.
+             */
+            fossil_tofu_cqueue_spsc_t* queue;
+        };
+
     } // namespace tofu
 
 } // namespace fossil
@@ -26,6 +26,7 @@
 #define FOSSIL_TOFU_DOUBLYLIST_H
 
 #include "tofu.h"
+#include "pool.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -48,6 +49,8 @@ typedef struct fossil_tofu_dlist_t {
     fossil_tofu_dlist_node_t* head;
     fossil_tofu_dlist_node_t* tail;
     char* type;
+    fossil_tofu_type_t type_enum; // Resolved once from `type` at creation
+    fossil_tofu_pool_t pool;      // Slab pool the nodes are taken from
 } fossil_tofu_dlist_t;
 
 // *****************************************************************************
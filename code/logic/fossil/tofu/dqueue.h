@@ -35,20 +35,23 @@ extern "C" {
 // Type definitions
 // *****************************************************************************
 
-// Node structure for the double-ended queue
-typedef struct fossil_tofu_dqueue_node_t {
-    fossil_tofu_t data;
-    struct fossil_tofu_dqueue_node_t* prev;
-    struct fossil_tofu_dqueue_node_t* next;
-} fossil_tofu_dqueue_node_t;
-
-// Double-ended queue structure
+// Capacity of the ring on first insert; it doubles from there
+#define FOSSIL_TOFU_DQUEUE_INITIAL_CAPACITY 8
+
+// Double-ended queue structure, a ring buffer over one contiguous array
 typedef struct fossil_tofu_dqueue_t {
-    fossil_tofu_dqueue_node_t* front;
-    fossil_tofu_dqueue_node_t* rear;
+    fossil_tofu_t* buffer;        // Ring storage, NULL until the first insert
+    size_t capacity;              // Zero or a power of two
+    size_t head;                  // Slot holding the front element
+    size_t size;                  // Number of live elements
     char *type;
+    fossil_tofu_type_t type_enum; // Resolved once from `type` at creation
 } fossil_tofu_dqueue_t;
 
+// Work-stealing deque (Chase-Lev). Its indices and ring are atomics, so the
+// layout is private to dqueue.c and the type is only used by pointer.
+typedef struct fossil_tofu_dqueue_ws_t fossil_tofu_dqueue_ws_t;
+
 // *****************************************************************************
 // Function prototypes
 // *****************************************************************************
@@ -101,17 +104,19 @@ void fossil_tofu_dqueue_destroy(fossil_tofu_dqueue_t* dqueue);
 // *****************************************************************************
 
 /**
- * Insert data into the dynamic queue.
+ * Insert data at the back of the dynamic queue.
+ * Same as fossil_tofu_dqueue_push_back.
  *
  * @param dqueue The dynamic queue to insert data into.
  * @param data   The data to insert.
  * @return       The error code indicating the success or failure of the operation.
- * @note         Time complexity: O(1)
+ * @note         Time complexity: amortized O(1)
  */
 int32_t fossil_tofu_dqueue_insert(fossil_tofu_dqueue_t* dqueue, char *data);
 
 /**
- * Remove data from the dynamic queue.
+ * Remove data from the front of the dynamic queue.
+ * Same as fossil_tofu_dqueue_pop_front.
  *
  * @param dqueue The dynamic queue to remove data from.
  * @return       The error code indicating the success or failure of the operation.
@@ -119,6 +124,46 @@ int32_t fossil_tofu_dqueue_insert(fossil_tofu_dqueue_t* dqueue, char *data);
  */
 int32_t fossil_tofu_dqueue_remove(fossil_tofu_dqueue_t* dqueue);
 
+/**
+ * Insert data at the front of the dynamic queue. A full ring doubles its
+ * capacity, moving each element once.
+ *
+ * @param dqueue The dynamic queue to insert data into.
+ * @param data   The data to insert.
+ * @return       The error code indicating the success or failure of the operation.
+ * @note         Time complexity: amortized O(1)
+ */
+int32_t fossil_tofu_dqueue_push_front(fossil_tofu_dqueue_t* dqueue, char *data);
+
+/**
+ * Insert data at the back of the dynamic queue. A full ring doubles its
+ * capacity, moving each element once.
+ *
+ * @param dqueue The dynamic queue to insert data into.
+ * @param data   The data to insert.
+ * @return       The error code indicating the success or failure of the operation.
+ * @note         Time complexity: amortized O(1)
+ */
+int32_t fossil_tofu_dqueue_push_back(fossil_tofu_dqueue_t* dqueue, char *data);
+
+/**
+ * Remove the element at the front of the dynamic queue.
+ *
+ * @param dqueue The dynamic queue to remove data from.
+ * @return       FOSSIL_TOFU_FAILURE if the queue is empty.
+ * @note         Time complexity: O(1)
+ */
+int32_t fossil_tofu_dqueue_pop_front(fossil_tofu_dqueue_t* dqueue);
+
+/**
+ * Remove the element at the back of the dynamic queue.
+ *
+ * @param dqueue The dynamic queue to remove data from.
+ * @return       FOSSIL_TOFU_FAILURE if the queue is empty.
+ * @note         Time complexity: O(1)
+ */
+int32_t fossil_tofu_dqueue_pop_back(fossil_tofu_dqueue_t* dqueue);
+
 /**
  * Get the size of the dynamic queue.
  *
@@ -168,13 +213,18 @@ bool fossil_tofu_dqueue_is_cnullptr(const fossil_tofu_dqueue_t* dqueue);
 // Getter and setter functions
 // *****************************************************************************
 
+// The getters point into the ring buffer, where short text is kept inline. A
+// push may regrow the buffer and a pop, set or erase may reuse the slot, so the
+// string is only valid until the queue is next modified.
+
 /**
  * Get the element at the specified index in the double-ended queue.
  *
  * @param dqueue The double-ended queue from which to get the element.
- * @param index  The index of the element to get.
- * @return       The element at the specified index.
- * @note         Time complexity: O(n)
+ * @param index  The index of the element to get, counted from the front.
+ * @return       The element at the specified index, or NULL if out of range;
+ *               valid until the queue changes.
+ * @note         Time complexity: O(1)
  */
 char *fossil_tofu_dqueue_get(const fossil_tofu_dqueue_t* dqueue, size_t index);
 
@@ -182,7 +232,7 @@ char *fossil_tofu_dqueue_get(const fossil_tofu_dqueue_t* dqueue, size_t index);
  * Get the first element in the double-ended queue.
  *
  * @param dqueue The double-ended queue from which to get the first element.
- * @return       The first element in the double-ended queue.
+ * @return       The first element in the double-ended queue, valid until the queue changes.
  * @note         Time complexity: O(1)
  */
 char *fossil_tofu_dqueue_get_front(const fossil_tofu_dqueue_t* dqueue);
@@ -191,7 +241,7 @@ char *fossil_tofu_dqueue_get_front(const fossil_tofu_dqueue_t* dqueue);
  * Get the last element in the double-ended queue.
  *
  * @param dqueue The double-ended queue from which to get the last element.
- * @return       The last element in the double-ended queue.
+ * @return       The last element in the double-ended queue, valid until the queue changes.
  * @note         Time complexity: O(1)
  */
 char *fossil_tofu_dqueue_get_back(const fossil_tofu_dqueue_t* dqueue);
@@ -200,9 +250,9 @@ char *fossil_tofu_dqueue_get_back(const fossil_tofu_dqueue_t* dqueue);
  * Set the element at the specified index in the double-ended queue.
  *
  * @param dqueue  The double-ended queue in which to set the element.
- * @param index   The index at which to set the element.
+ * @param index   The index at which to set the element, counted from the front.
  * @param element The element to set.
- * @note         Time complexity: O(n)
+ * @note         Time complexity: O(1)
  */
 void fossil_tofu_dqueue_set(fossil_tofu_dqueue_t* dqueue, size_t index, char *element);
 
@@ -224,6 +274,81 @@ void fossil_tofu_dqueue_set_front(fossil_tofu_dqueue_t* dqueue, char *element);
  */
 void fossil_tofu_dqueue_set_back(fossil_tofu_dqueue_t* dqueue, char *element);
 
+// *****************************************************************************
+// Work-stealing functions
+// *****************************************************************************
+
+/**
+ * Create a work-stealing double-ended queue. One owner thread pushes and pops
+ * at the bottom without locks; any number of other threads may steal from
+ * the top.
+ *
+ * @param type     The type of data the queue will store.
+ * @param capacity The initial number of slots, rounded up to a power of two.
+ *                 The queue grows past it as needed.
+ * @return         The created queue, or NULL on failure.
+ * @note           Time complexity: O(1)
+ * @note           A stolen element is destroyed on the thief's thread although
+ *                 the owner created it, so thieves must use an allocator that
+ *                 can free the owner's blocks (see `fossil_tofu_set_thread_allocator`).
+ */
+fossil_tofu_dqueue_ws_t* fossil_tofu_dqueue_create_ws(char* type, size_t capacity);
+
+/**
+ * Destroy a work-stealing queue and any elements still in it. No other
+ * thread may be using the queue.
+ *
+ * @param dqueue The work-stealing queue to destroy.
+ * @note         Time complexity: O(n)
+ */
+void fossil_tofu_dqueue_ws_destroy(fossil_tofu_dqueue_ws_t* dqueue);
+
+/**
+ * Push data onto the bottom of the queue. Owner thread only.
+ *
+ * @param dqueue The work-stealing queue to push to.
+ * @param data   The data to push.
+ * @return       FOSSIL_TOFU_SUCCESS, or FOSSIL_TOFU_FAILURE if growing failed.
+ * @note         Time complexity: amortized O(1)
+ */
+int32_t fossil_tofu_dqueue_ws_push(fossil_tofu_dqueue_ws_t* dqueue, char *data);
+
+/**
+ * Pop the bottom element, the one pushed last. Owner thread only. This only
+ * synchronizes with thieves when one element is left.
+ *
+ * @param dqueue The work-stealing queue to pop from.
+ * @param out    Receives the element, which the caller then owns and must pass
+ *               to fossil_tofu_destroy. May be NULL to discard the element.
+ * @return       FOSSIL_TOFU_SUCCESS, or FOSSIL_TOFU_FAILURE if the queue is empty
+ *               or a thief took the last element.
+ * @note         Time complexity: O(1)
+ */
+int32_t fossil_tofu_dqueue_ws_pop(fossil_tofu_dqueue_ws_t* dqueue, fossil_tofu_t* out);
+
+/**
+ * Steal the top element, the oldest one. Any thread may call this. A steal
+ * that loses a race to another thread retries, so it only fails on an empty
+ * queue.
+ *
+ * @param dqueue The work-stealing queue to steal from.
+ * @param out    Receives the element, which the caller then owns and must pass
+ *               to fossil_tofu_destroy. May be NULL to discard the element.
+ * @return       FOSSIL_TOFU_SUCCESS, or FOSSIL_TOFU_FAILURE if the queue is empty.
+ * @note         Time complexity: O(1) per attempt, lock-free
+ */
+int32_t fossil_tofu_dqueue_ws_steal(fossil_tofu_dqueue_ws_t* dqueue, fossil_tofu_t* out);
+
+/**
+ * Get the number of elements in the work-stealing queue. While other threads
+ * are active this is only a snapshot.
+ *
+ * @param dqueue The work-stealing queue to inspect.
+ * @return       The number of elements in the queue.
+ * @note         Time complexity: O(1)
+ */
+size_t fossil_tofu_dqueue_ws_size(const fossil_tofu_dqueue_ws_t* dqueue);
+
 #ifdef __cplusplus
 }
 #include <stdexcept>
@@ -353,6 +478,52 @@ namespace fossil {
                 }
             }
 
+            /**
+             * Inserts data at the front of the queue.
+             * 
+             * @param data The data to insert.
+             * @throws std::runtime_error if the insertion fails.
+             */
+            void push_front(const std::string& data) {
+                if (fossil_tofu_dqueue_push_front(dqueue, const_cast<char*>(data.c_str())) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to push data to the front of the double-ended queue.");
+                }
+            }
+
+            /**
+             * Inserts data at the back of the queue.
+             * 
+             * @param data The data to insert.
+             * @throws std::runtime_error if the insertion fails.
+             */
+            void push_back(const std::string& data) {
+                if (fossil_tofu_dqueue_push_back(dqueue, const_cast<char*>(data.c_str())) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to push data to the back of the double-ended queue.");
+                }
+            }
+
+            /**
+             * Removes the element at the front of the queue.
+             * 
+             * @throws std::runtime_error if the queue is empty.
+             */
+            void pop_front() {
+                if (fossil_tofu_dqueue_pop_front(dqueue) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to pop from the front of the double-ended queue.");
+                }
+            }
+
+            /**
+             * Removes the element at the back of the queue.
+             * 
+             * @throws std::runtime_error if the queue is empty.
+             */
+            void pop_back() {
+                if (fossil_tofu_dqueue_pop_back(dqueue) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to pop from the back of the double-ended queue.");
+                }
+            }
+
             /**
              * Gets the size of the queue.
              * 
@@ -461,6 +632,94 @@ namespace fossil {
             fossil_tofu_dqueue_t* dqueue; /**< Pointer to the underlying C-style double-ended queue. */
         };
 
+        /**
+         * A C++ wrapper class for the work-stealing double-ended queue (fossil_tofu_dqueue_ws_t).
+         * The owning thread calls push and pop; other threads call steal. The queue is
+         * neither copyable nor movable, because those threads hold on to it.
+         */
+        class WorkStealingDQueue {
+        public:
+            /**
+             * Constructor with a specified data type and initial capacity.
+             * 
+             * @param type     The type of data the queue will store.
+             * @param capacity The initial number of slots.
+             * @throws std::runtime_error if the queue creation fails.
+             */
+            WorkStealingDQueue(const std::string& type, size_t capacity = FOSSIL_TOFU_DQUEUE_INITIAL_CAPACITY)
+                : dqueue(fossil_tofu_dqueue_create_ws(const_cast<char*>(type.c_str()), capacity)) {
+                if (dqueue == nullptr) {
+                    throw std::runtime_error("Failed to create a work-stealing double-ended queue with type: " + type);
+                }
+            }
+
+            WorkStealingDQueue(const WorkStealingDQueue&) = delete;
+            WorkStealingDQueue& operator=(const WorkStealingDQueue&) = delete;
+
+            /**
+             * Destructor.
+             * Destroys the queue and any elements still in it.
+             */
+            ~WorkStealingDQueue() {
+                fossil_tofu_dqueue_ws_destroy(dqueue);
+            }
+
+            /**
+             * Pushes data onto the bottom of the queue. Owner thread only.
+             * 
+             * @param data The data to push.
+             * @throws std::runtime_error if the queue could not grow.
+             */
+            void push(const std::string& data) {
+                if (fossil_tofu_dqueue_ws_push(dqueue, const_cast<char*>(data.c_str())) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to push data onto the work-stealing double-ended queue.");
+                }
+            }
+
+            /**
+             * Pops the most recently pushed element. Owner thread only.
+             * 
+             * @param out Receives the element's value.
+             * @return True on success, false if the queue is empty.
+             */
+            bool pop(std::string& out) {
+                return take(fossil_tofu_dqueue_ws_pop, out);
+            }
+
+            /**
+             * Steals the oldest element. Any thread.
+             * 
+             * @param out Receives the element's value.
+             * @return True on success, false if the queue is empty.
+             */
+            bool steal(std::string& out) {
+                return take(fossil_tofu_dqueue_ws_steal, out);
+            }
+
+            /**
+             * Gets the number of elements in the queue.
+             * 
+             * @return A snapshot of the element count.
+             */
+            size_t size() const {
+                return fossil_tofu_dqueue_ws_size(dqueue);
+            }
+
+        private:
+            bool take(int32_t (*op)(fossil_tofu_dqueue_ws_t*, fossil_tofu_t*), std::string& out) {
+                fossil_tofu_t element;
+                if (op(dqueue, &element) != FOSSIL_TOFU_SUCCESS) {
+                    return false;
+                }
+                char* value = fossil_tofu_get_value(&element);
+                out = value ? std::string(value) : std::string();
+                fossil_tofu_destroy(&element);
+                return true;
+            }
+
+            fossil_tofu_dqueue_ws_t* dqueue; /**< Pointer to the underlying C-style work-stealing queue. */
+        };
+
     } // namespace tofu
 
 } // namespace fossil
@@ -27,6 +27,8 @@
 
 // the main tofu type
 #include "tofu.h"
+#include "arena.h"
+#include "pool.h"
 
 // array family
 #include "vector.h"
@@ -54,5 +56,6 @@
 
 // tree family
 #include "tree.h"
+#include "btree.h"
 
 #endif /* FOSSIL_TOFU_FRAMEWORK_H */
@@ -26,6 +26,7 @@
 #define FOSSIL_TOFU_MAPOF_H
 
 #include "tofu.h"
+#include "arena.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -36,17 +37,30 @@ extern "C"
 // Type definitions
 // *****************************************************************************
 
-typedef struct fossil_tofu_mapof_node_t {
+#define FOSSIL_TOFU_MAPOF_MIN_CAPACITY 16 // Slots allocated by the first insert
+#define FOSSIL_TOFU_MAPOF_LOAD_NUM 7      // The table grows once size exceeds
+#define FOSSIL_TOFU_MAPOF_LOAD_DEN 8      // LOAD_NUM / LOAD_DEN of its capacity
+
+// A slot of the open-addressing table. The key's `value.hash` picks the home
+// slot, and `distance` records how far the entry sits from it.
+typedef struct fossil_tofu_mapof_entry_t {
     fossil_tofu_t key;
     fossil_tofu_t value;
-    struct fossil_tofu_mapof_node_t* next;
-} fossil_tofu_mapof_node_t;
+    uint32_t distance; // Probe distance plus one; 0 marks an empty slot
+} fossil_tofu_mapof_entry_t;
 
+// Robin Hood hash table: on insert an entry takes the slot of any resident
+// closer to its own home, which keeps probe sequences short and lets lookups
+// stop as soon as they pass an entry nearer home than the key would be.
 typedef struct fossil_tofu_mapof_t {
     char* key_type;
     char* value_type;
-    fossil_tofu_mapof_node_t* head;
+    fossil_tofu_type_t key_type_enum;   // Resolved once from `key_type` at creation
+    fossil_tofu_type_t value_type_enum; // Resolved once from `value_type` at creation
+    fossil_tofu_mapof_entry_t* entries; // Slot array, NULL until the first insert
+    size_t capacity;                    // Number of slots, zero or a power of two
     size_t size;
+    fossil_tofu_arena_t* arena;         // Arena holding the table and entries, or NULL for the heap
 } fossil_tofu_mapof_t;
 
 // *****************************************************************************
@@ -62,6 +76,19 @@ typedef struct fossil_tofu_mapof_t {
  */
 fossil_tofu_mapof_t* fossil_tofu_mapof_create_container(char* key_type, char* value_type);
 
+/**
+ * @brief Create a new map container whose nodes and entries are allocated from an arena.
+ *
+ * Destroying the map is a no-op; its memory is released in one step by
+ * `fossil_tofu_arena_reset` or `fossil_tofu_arena_destroy`.
+ *
+ * @param key_type The type of the keys.
+ * @param value_type The type of the values.
+ * @param arena The arena to allocate from.
+ * @return A pointer to the newly created map container, or NULL on failure.
+ */
+fossil_tofu_mapof_t* fossil_tofu_mapof_create_in_arena(char* key_type, char* value_type, fossil_tofu_arena_t* arena);
+
 /**
  * @brief Create a new map container with default key and value types.
  *
@@ -93,13 +120,13 @@ fossil_tofu_mapof_t* fossil_tofu_mapof_create_move(fossil_tofu_mapof_t* other);
 void fossil_tofu_mapof_destroy(fossil_tofu_mapof_t* map);
 
 /**
- * @brief Insert a key-value pair into the map.
+ * @brief Insert a key-value pair into the map, replacing the value if the key is present.
  *
  * @param map The map container.
  * @param key The key to insert.
  * @param value The value to insert.
  * @return 0 on success, non-zero on failure.
- * @note Time complexity: O(n)
+ * @note Time complexity: O(1) amortized
  */
 int32_t fossil_tofu_mapof_insert(fossil_tofu_mapof_t* map, char *key, char *value);
 
@@ -109,7 +136,7 @@ int32_t fossil_tofu_mapof_insert(fossil_tofu_mapof_t* map, char *key, char *valu
  * @param map The map container.
  * @param key The key to remove.
  * @return 0 on success, non-zero on failure.
- * @note Time complexity: O(n)
+ * @note Time complexity: O(1) average
  */
 int32_t fossil_tofu_mapof_remove(fossil_tofu_mapof_t* map, char *key);
 
@@ -119,17 +146,22 @@ int32_t fossil_tofu_mapof_remove(fossil_tofu_mapof_t* map, char *key);
  * @param map The map container.
  * @param key The key to check.
  * @return True if the key is found, false otherwise.
- * @note Time complexity: O(n)
+ * @note Time complexity: O(1) average
  */
 bool fossil_tofu_mapof_contains(const fossil_tofu_mapof_t* map, char *key);
 
 /**
  * @brief Get the value associated with a key in the map.
  *
+ * The result is a shallow copy that shares the entry's storage, so it must not
+ * be destroyed and must not be used once that key is set or removed or the map
+ * is destroyed. Short text is held inline in the copy itself, so a string read
+ * from it with `fossil_tofu_get_value` lives only as long as the copy does.
+ *
  * @param map The map container.
  * @param key The key to look up.
- * @return The value associated with the key.
- * @note Time complexity: O(n)
+ * @return The value associated with the key, or a zeroed object if it is absent.
+ * @note Time complexity: O(1) average
  */
 fossil_tofu_t fossil_tofu_mapof_get(const fossil_tofu_mapof_t* map, char *key);
 
@@ -140,7 +172,7 @@ fossil_tofu_t fossil_tofu_mapof_get(const fossil_tofu_mapof_t* map, char *key);
  * @param key The key to set.
  * @param value The value to set.
  * @return 0 on success, non-zero on failure.
- * @note Time complexity: O(n)
+ * @note Time complexity: O(1) average
  */
 int32_t fossil_tofu_mapof_set(fossil_tofu_mapof_t* map, char *key, char *value);
 
@@ -197,6 +229,20 @@ namespace fossil {
                 }
             }
 
+            /**
+             * @brief Construct a new MapOf object in an arena. The arena must outlive the map.
+             *
+             * @param key_type The type of the keys.
+             * @param value_type The type of the values.
+             * @param arena The arena to allocate from.
+             */
+            MapOf(const std::string& key_type, const std::string& value_type, Arena& arena) {
+                map = fossil_tofu_mapof_create_in_arena(const_cast<char*>(key_type.c_str()), const_cast<char*>(value_type.c_str()), arena.get());
+                if (map == nullptr) {
+                    throw std::runtime_error("Failed to create map container");
+                }
+            }
+
             /**
              * @brief Construct a new MapOf object with default key and value types.
              */
@@ -273,7 +319,8 @@ namespace fossil {
              * @brief Get the value associated with a key in the map.
              *
              * @param key The key to look up.
-             * @return The value associated with the key.
+             * @return The value associated with the key, a shallow copy with the
+             *         same lifetime rules as fossil_tofu_mapof_get.
              */
             fossil_tofu_t get(const std::string& key) {
                 return fossil_tofu_mapof_get(map, const_cast<char*>(key.c_str()));
@@ -0,0 +1,116 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TOFU_POOL_H
+#define FOSSIL_TOFU_POOL_H
+
+#include "tofu.h"
+
+#define FOSSIL_TOFU_POOL_FIRST_SLAB 16   // Objects in the first slab
+#define FOSSIL_TOFU_POOL_MAX_SLAB 1024   // Upper bound on objects per slab
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// Type definitions
+// *****************************************************************************
+
+typedef struct fossil_tofu_pool_slab_t {
+    struct fossil_tofu_pool_slab_t* next;
+} fossil_tofu_pool_slab_t;
+
+// A free-list pool of fixed-size objects carved from contiguous slabs. Each
+// linked container keeps one for its nodes, so insert/remove churn reuses
+// memory instead of going through the allocator, and nodes allocated together
+// sit next to each other. Slabs are taken from the allocator in effect at the
+// time and are only returned by `fossil_tofu_pool_clear`.
+typedef struct {
+    size_t object_size;               // Size of each object, rounded for alignment
+    size_t slab_objects;              // Number of objects in the next slab
+    void* free_list;                  // Released objects, linked through their first word
+    unsigned char* bump;              // Next never-used object in the newest slab
+    unsigned char* bump_end;          // End of the newest slab
+    fossil_tofu_pool_slab_t* slabs;   // All slabs, newest first
+} fossil_tofu_pool_t;
+
+// *****************************************************************************
+// Function prototypes
+// *****************************************************************************
+
+/**
+ * Initialize an empty pool. No memory is allocated until the first acquire.
+ *
+ * Time complexity: O(1)
+ *
+ * @param pool        The pool to initialize.
+ * @param object_size The size of each object in bytes.
+ */
+void fossil_tofu_pool_init(fossil_tofu_pool_t* pool, size_t object_size);
+
+/**
+ * Take an object from the pool, adding a slab if none is free.
+ *
+ * Time complexity: O(1) amortized
+ *
+ * @param pool The pool to take from.
+ * @return     The object, or NULL if a new slab could not be allocated.
+ */
+tofu_memory_t fossil_tofu_pool_acquire(fossil_tofu_pool_t* pool);
+
+/**
+ * Return an object to the pool for reuse.
+ *
+ * Time complexity: O(1)
+ *
+ * @param pool   The pool the object was acquired from.
+ * @param object The object to return, or NULL.
+ */
+void fossil_tofu_pool_release(fossil_tofu_pool_t* pool, tofu_memory_t object);
+
+/**
+ * Free every slab of the pool at once; all objects become invalid.
+ *
+ * Time complexity: O(s) in the number of slabs
+ *
+ * @param pool The pool to clear.
+ */
+void fossil_tofu_pool_clear(fossil_tofu_pool_t* pool);
+
+/**
+ * Transfer all slabs and free objects of `src` to `dest`, leaving `src` empty.
+ *
+ * Time complexity: O(1)
+ *
+ * @param dest The pool to receive the slabs; its previous slabs are freed.
+ * @param src  The pool to take the slabs from.
+ */
+void fossil_tofu_pool_move(fossil_tofu_pool_t* dest, fossil_tofu_pool_t* src);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FOSSIL_TOFU_POOL_H */
@@ -36,15 +36,40 @@ extern "C"
 // Type definitions
 // *****************************************************************************
 
+#define FOSSIL_TOFU_PQUEUE_ARITY 4          // Children per heap node
+#define FOSSIL_TOFU_PQUEUE_MIN_CAPACITY 16  // Entries allocated by the first insert
+#define FOSSIL_TOFU_PQUEUE_INVALID_HANDLE UINT64_MAX
+
+// Stable reference to one element: its slot index in the low 32 bits and the
+// slot's generation in the high 32 bits, so handles to removed elements are
+// rejected even after the slot is reused.
+typedef uint64_t fossil_tofu_pqueue_handle_t;
+
+// A heap entry. It only carries the priority and where the element lives, so
+// the four children of a node fit in one cache line while sifting.
 typedef struct fossil_tofu_pqueue_node_t {
-    fossil_tofu_t data;
     int32_t priority;
-    struct fossil_tofu_pqueue_node_t* next;
+    uint32_t slot;      // Index of the element in `slots`
 } fossil_tofu_pqueue_node_t;
 
+// Storage for one element; slots keep their index while the heap reorders.
+typedef struct fossil_tofu_pqueue_slot_t {
+    fossil_tofu_t data;
+    size_t position;     // Heap index of the element, or the next free slot when unused
+    uint32_t generation; // Bumped whenever the slot is freed
+} fossil_tofu_pqueue_slot_t;
+
+// Implicit 4-ary min-heap: the lowest priority number is at the front.
 typedef struct fossil_tofu_pqueue_t {
-    fossil_tofu_pqueue_node_t* front;
+    fossil_tofu_pqueue_node_t* heap;   // Heap entries, heap[0] is the front
+    fossil_tofu_pqueue_slot_t* slots;  // Element storage referenced by the heap
+    size_t size;                       // Number of elements
+    size_t capacity;                   // Entries allocated in both `heap` and `slots`
+    size_t slot_count;                 // Slots handed out so far, live or free
+    size_t free_slot;                  // First free slot, or SIZE_MAX if none
+    uint32_t fresh_generation;         // Generation of slots handed out for the first time
     char* type;
+    fossil_tofu_type_t type_enum; // Resolved once from `type` at creation
 } fossil_tofu_pqueue_t;
 
 // *****************************************************************************
@@ -82,7 +107,10 @@ fossil_tofu_pqueue_t* fossil_tofu_pqueue_create_copy(const fossil_tofu_pqueue_t*
 /**
  * Create a new priority queue by moving an existing priority queue.
  * 
- * Time complexity: O(1)
+ * Handles issued by `other` resolve on the new queue and stay stale on
+ * `other`, even after it is reused.
+ * 
+ * Time complexity: O(n) in the number of slots `other` has used
  *
  * @param other The priority queue to move.
  * @return      The created priority queue.
@@ -103,25 +131,114 @@ void fossil_tofu_pqueue_destroy(fossil_tofu_pqueue_t* pqueue);
 
 /**
  * Insert data into the priority queue with the specified priority.
+ * Lower numbers come first; the order among equal priorities is unspecified.
  *
  * @param pqueue   The priority queue to insert data into.
  * @param data     The data to insert.
  * @param priority The priority of the data.
  * @return         The error code indicating the success or failure of the operation.
- * @note           Time complexity: O(n)
+ * @note           Time complexity: O(log n)
  */
 int32_t fossil_tofu_pqueue_insert(fossil_tofu_pqueue_t* pqueue, char *data, int32_t priority);
 
 /**
- * Remove data from the priority queue.
+ * Insert data and return a handle that stays valid until the element is removed.
+ *
+ * Handles survive reordering of the heap and `fossil_tofu_pqueue_create_move`,
+ * but not `fossil_tofu_pqueue_create_copy`.
+ *
+ * @param pqueue   The priority queue to insert data into.
+ * @param data     The data to insert.
+ * @param priority The priority of the data.
+ * @return         The handle, or FOSSIL_TOFU_PQUEUE_INVALID_HANDLE on failure.
+ * @note           Time complexity: O(log n)
+ */
+fossil_tofu_pqueue_handle_t fossil_tofu_pqueue_insert_handle(fossil_tofu_pqueue_t* pqueue, char *data, int32_t priority);
+
+/**
+ * Change the priority of the element behind a handle and restore its place in the heap.
+ *
+ * @param pqueue   The priority queue holding the element.
+ * @param handle   The handle returned by `fossil_tofu_pqueue_insert_handle`.
+ * @param priority The new priority.
+ * @return         FOSSIL_TOFU_SUCCESS, or FOSSIL_TOFU_FAILURE if the handle is stale.
+ * @note           Time complexity: O(log n)
+ */
+int32_t fossil_tofu_pqueue_update_priority(fossil_tofu_pqueue_t* pqueue, fossil_tofu_pqueue_handle_t handle, int32_t priority);
+
+/**
+ * Remove the element behind a handle.
+ *
+ * @param pqueue The priority queue holding the element.
+ * @param handle The handle returned by `fossil_tofu_pqueue_insert_handle`.
+ * @return       FOSSIL_TOFU_SUCCESS, or FOSSIL_TOFU_FAILURE if the handle is stale.
+ * @note         Time complexity: O(log n)
+ */
+int32_t fossil_tofu_pqueue_remove_handle(fossil_tofu_pqueue_t* pqueue, fossil_tofu_pqueue_handle_t handle);
+
+/**
+ * Get the element behind a handle.
+ *
+ * @param pqueue The priority queue holding the element.
+ * @param handle The handle returned by `fossil_tofu_pqueue_insert_handle`.
+ * @return       The element, or NULL if the handle is stale; valid until the
+ *               queue changes (see the note on the getters below).
+ * @note         Time complexity: O(1)
+ */
+char *fossil_tofu_pqueue_get_handle(const fossil_tofu_pqueue_t* pqueue, fossil_tofu_pqueue_handle_t handle);
+
+/**
+ * Insert a batch of elements and restore the heap once, bottom-up.
+ *
+ * The elements are built with `fossil_tofu_create_batch`, so their payloads
+ * share one allocation.
+ *
+ * @param pqueue     The priority queue to insert data into.
+ * @param data       The data to insert.
+ * @param priorities The priority of each element.
+ * @param count      The number of elements.
+ * @return           FOSSIL_TOFU_SUCCESS on success, FOSSIL_TOFU_FAILURE otherwise.
+ * @note             Time complexity: O(n + count)
+ */
+int32_t fossil_tofu_pqueue_heapify(fossil_tofu_pqueue_t* pqueue, char **data, const int32_t *priorities, size_t count);
+
+/**
+ * Move every element of `src` into `dest`, leaving `src` empty but usable.
+ *
+ * No element data is copied. Handles issued by `dest` stay valid and handles
+ * issued by `src` go stale, on both queues. If `dest` has never held an
+ * element it takes over src's storage; otherwise src's entries are appended
+ * and the heap is restored by sifting them up or by rebuilding it, whichever
+ * is cheaper.
+ *
+ * @param dest The priority queue receiving the elements.
+ * @param src  The priority queue to drain.
+ * @return     FOSSIL_TOFU_SUCCESS, or FOSSIL_TOFU_FAILURE if the queues are the same,
+ *             hold different types, or memory could not be allocated.
+ * @note       Time complexity: O(m) into a queue that never held an element,
+ *             otherwise O(min(m log(n + m), n + m))
+ */
+int32_t fossil_tofu_pqueue_merge(fossil_tofu_pqueue_t* dest, fossil_tofu_pqueue_t* src);
+
+/**
+ * Remove an element with the given priority from the priority queue.
  *
  * @param pqueue   The priority queue to remove data from.
  * @param priority The priority of the data.
  * @return         The error code indicating the success or failure of the operation.
- * @note           Time complexity: O(1)
+ * @note           Time complexity: O(log n) for the front priority, O(n) otherwise
  */
 int32_t fossil_tofu_pqueue_remove(fossil_tofu_pqueue_t* pqueue, int32_t priority);
 
+/**
+ * Remove the element at the front of the priority queue.
+ *
+ * @param pqueue The priority queue to remove data from.
+ * @return       The error code indicating the success or failure of the operation.
+ * @note         Time complexity: O(log n)
+ */
+int32_t fossil_tofu_pqueue_pop(fossil_tofu_pqueue_t* pqueue);
+
 /**
  * Get the size of the priority queue.
  *
@@ -171,23 +288,28 @@ bool fossil_tofu_pqueue_is_cnullptr(const fossil_tofu_pqueue_t* pqueue);
 // Getter and setter functions
 // *****************************************************************************
 
+// Element getters, get_handle included, return text stored in the queue's slot
+// array, inline when short. Inserting may grow that array and move every slot,
+// and removing or setting replaces the text, so the string is only valid until
+// the queue is next modified.
+
 /**
  * Get the element with the highest priority in the priority queue.
  * 
  * Time complexity: O(1)
  *
  * @param pqueue The priority queue from which to get the element.
- * @return       The element with the highest priority.
+ * @return       The element with the highest priority, valid until the queue changes.
  */
 char *fossil_tofu_pqueue_get_front(const fossil_tofu_pqueue_t* pqueue);
 
 /**
  * Get the element with the lowest priority in the priority queue.
  * 
- * Time complexity: O(1)
+ * Time complexity: O(n)
  *
  * @param pqueue The priority queue from which to get the element.
- * @return       The element with the lowest priority.
+ * @return       The element with the lowest priority, valid until the queue changes.
  */
 char *fossil_tofu_pqueue_get_back(const fossil_tofu_pqueue_t* pqueue);
 
@@ -198,7 +320,7 @@ char *fossil_tofu_pqueue_get_back(const fossil_tofu_pqueue_t* pqueue);
  *
  * @param pqueue   The priority queue from which to get the element.
  * @param priority The priority of the element to get.
- * @return         The element at the specified priority.
+ * @return         The element at the specified priority, valid until the queue changes.
  */
 char *fossil_tofu_pqueue_get_at(const fossil_tofu_pqueue_t* pqueue, int32_t priority);
 
@@ -215,7 +337,7 @@ void fossil_tofu_pqueue_set_front(fossil_tofu_pqueue_t* pqueue, char *element);
 /**
  * Set the element with the lowest priority in the priority queue.
  * 
- * Time complexity: O(1)
+ * Time complexity: O(n)
  *
  * @param pqueue  The priority queue in which to set the element.
  * @param element The element to set.
@@ -237,6 +359,7 @@ void fossil_tofu_pqueue_set_at(fossil_tofu_pqueue_t* pqueue, int32_t priority, c
 }
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace fossil {
 
@@ -313,6 +436,98 @@ namespace fossil {
                 fossil_tofu_pqueue_remove(pqueue, priority);
             }
 
+            /**
+             * Insert a batch of elements and restore the heap once.
+             * Throws a runtime_error if the elements could not be added.
+             *
+             * @param data       The data to insert.
+             * @param priorities The priority of each element.
+             */
+            void heapify(const std::vector<std::string>& data, const std::vector<int32_t>& priorities) {
+                if (data.size() != priorities.size()) {
+                    throw std::runtime_error("Data and priorities differ in length.");
+                }
+                std::vector<char*> ptrs;
+                ptrs.reserve(data.size());
+                for (const auto& element : data) {
+                    ptrs.push_back(const_cast<char*>(element.c_str()));
+                }
+                if (fossil_tofu_pqueue_heapify(pqueue, ptrs.data(), priorities.data(), ptrs.size()) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to add elements to priority queue.");
+                }
+            }
+
+            /**
+             * Move every element of another priority queue into this one, leaving it empty.
+             * Throws a runtime_error if the queues hold different types.
+             *
+             * @param other The priority queue to drain.
+             */
+            void merge(PQueue& other) {
+                if (fossil_tofu_pqueue_merge(pqueue, other.pqueue) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to merge priority queues.");
+                }
+            }
+
+            /**
+             * Remove the element at the front of the priority queue.
+             */
+            void pop() {
+                fossil_tofu_pqueue_pop(pqueue);
+            }
+
+            /**
+             * Insert data and return a handle that stays valid until the element is removed.
+             * Throws a runtime_error if the element could not be added.
+             *
+             * @param data     The data to insert.
+             * @param priority The priority of the data.
+             * @return         The handle of the new element.
+             */
+            fossil_tofu_pqueue_handle_t insert_handle(const std::string& data, int32_t priority) {
+                fossil_tofu_pqueue_handle_t handle = fossil_tofu_pqueue_insert_handle(pqueue, const_cast<char*>(data.c_str()), priority);
+                if (handle == FOSSIL_TOFU_PQUEUE_INVALID_HANDLE) {
+                    throw std::runtime_error("Failed to insert into priority queue.");
+                }
+                return handle;
+            }
+
+            /**
+             * Change the priority of the element behind a handle.
+             * Throws a runtime_error if the handle is stale.
+             *
+             * @param handle   The handle of the element.
+             * @param priority The new priority.
+             */
+            void update_priority(fossil_tofu_pqueue_handle_t handle, int32_t priority) {
+                if (fossil_tofu_pqueue_update_priority(pqueue, handle, priority) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Invalid priority queue handle.");
+                }
+            }
+
+            /**
+             * Remove the element behind a handle.
+             * Throws a runtime_error if the handle is stale.
+             *
+             * @param handle The handle of the element.
+             */
+            void remove_handle(fossil_tofu_pqueue_handle_t handle) {
+                if (fossil_tofu_pqueue_remove_handle(pqueue, handle) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Invalid priority queue handle.");
+                }
+            }
+
+            /**
+             * Get the element behind a handle.
+             *
+             * @param handle The handle of the element.
+             * @return       The element, or an empty string if the handle is stale.
+             */
+            std::string get_handle(fossil_tofu_pqueue_handle_t handle) const {
+                char* result = fossil_tofu_pqueue_get_handle(pqueue, handle);
+                return result ? std::string(result) : std::string();
+            }
+
             /**
              * Get the size of the priority queue.
              *
@@ -26,6 +26,7 @@
 #define FOSSIL_TOFU_QUEUE_H
 
 #include "tofu.h"
+#include "pool.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -47,8 +48,14 @@ typedef struct fossil_tofu_queue_t {
     fossil_tofu_queue_node_t* front;
     fossil_tofu_queue_node_t* rear;
     char* type;
+    fossil_tofu_type_t type_enum; // Resolved once from `type` at creation
+    fossil_tofu_pool_t pool;      // Slab pool the nodes are taken from
 } fossil_tofu_queue_t;
 
+// Bounded multi-producer/multi-consumer queue. Its positions and per-slot
+// sequence numbers are atomics, so the layout is private to queue.c.
+typedef struct fossil_tofu_queue_mpmc_t fossil_tofu_queue_mpmc_t;
+
 // *****************************************************************************
 // Function prototypes
 // *****************************************************************************
@@ -211,6 +218,82 @@ void fossil_tofu_queue_set_front(fossil_tofu_queue_t* queue, char *element);
  */
 void fossil_tofu_queue_set_rear(fossil_tofu_queue_t* queue, char *element);
 
+// *****************************************************************************
+// Multi-producer/multi-consumer functions
+// *****************************************************************************
+
+/**
+ * Create a bounded lock-free queue that any number of threads may push to and
+ * pop from concurrently.
+ * 
+ * Time complexity: O(capacity)
+ *
+ * @param type     The type of data the queue will store.
+ * @param capacity The minimum number of elements the queue must hold; it is
+ *                 rounded up to a power of two.
+ * @return         The created queue, or NULL on failure.
+ * @note           An element is usually destroyed by a different thread than
+ *                 the one that pushed it, so no thread using the queue may
+ *                 have its own allocator installed unless every such allocator
+ *                 can free the others' blocks (see `fossil_tofu_set_thread_allocator`).
+ */
+fossil_tofu_queue_mpmc_t* fossil_tofu_queue_create_mpmc(char* type, size_t capacity);
+
+/**
+ * Destroy a multi-producer/multi-consumer queue and any elements still in it.
+ * No other thread may be using the queue.
+ * 
+ * Time complexity: O(n)
+ *
+ * @param queue The queue to destroy.
+ */
+void fossil_tofu_queue_mpmc_destroy(fossil_tofu_queue_mpmc_t* queue);
+
+/**
+ * Push data onto the rear of the queue. Producers claim slots with a
+ * compare-and-swap on the enqueue position, so no lock is taken.
+ * 
+ * Time complexity: O(1) expected
+ *
+ * @param queue The queue to push to.
+ * @param data  The data to push.
+ * @return      FOSSIL_TOFU_SUCCESS, or FOSSIL_TOFU_FAILURE if the queue is full.
+ */
+int32_t fossil_tofu_queue_mpmc_try_push(fossil_tofu_queue_mpmc_t* queue, char *data);
+
+/**
+ * Pop the front element of the queue.
+ * 
+ * Time complexity: O(1) expected
+ *
+ * @param queue The queue to pop from.
+ * @param out   Receives the element, which the caller then owns and must pass
+ *              to fossil_tofu_destroy. May be NULL to discard the element.
+ * @return      FOSSIL_TOFU_SUCCESS, or FOSSIL_TOFU_FAILURE if the queue is empty.
+ */
+int32_t fossil_tofu_queue_mpmc_try_pop(fossil_tofu_queue_mpmc_t* queue, fossil_tofu_t* out);
+
+/**
+ * Get the number of elements in the queue. While other threads are active
+ * this is only a snapshot.
+ * 
+ * Time complexity: O(1)
+ *
+ * @param queue The queue to inspect.
+ * @return      The number of elements in the queue.
+ */
+size_t fossil_tofu_queue_mpmc_size(const fossil_tofu_queue_mpmc_t* queue);
+
+/**
+ * Get the capacity of the queue after rounding.
+ * 
+ * Time complexity: O(1)
+ *
+ * @param queue The queue to inspect.
+ * @return      The maximum number of elements the queue can hold.
+ */
+size_t fossil_tofu_queue_mpmc_capacity(const fossil_tofu_queue_mpmc_t* queue);
+
 #ifdef __cplusplus
 }
 #include <stdexcept>
@@ -378,6 +461,85 @@ namespace fossil {
             fossil_tofu_queue_t* queue;
         };
 
+        /**
+         * Wrapper for the bounded multi-producer/multi-consumer queue. Any
+         * number of threads may call try_push and try_pop at once. It is
+         * neither copyable nor movable, because those threads hold on to it.
+         */
+        class MpmcQueue {
+        public:
+            /**
+             * Create a lock-free queue with the specified data type.
+             *
+             * @param type     The type of data the queue will store.
+             * @param capacity The minimum number of elements the queue must hold.
+             */
+            MpmcQueue(const std::string& type, size_t capacity) {
+                queue = fossil_tofu_queue_create_mpmc(const_cast<char*>(type.c_str()), capacity);
+                if (queue == nullptr) {
+                    throw std::runtime_error("Failed to create multi-producer/multi-consumer queue.");
+                }
+            }
+
+            MpmcQueue(const MpmcQueue&) = delete;
+            MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+            /**
+             * Destroy the queue and any elements still in it.
+             */
+            ~MpmcQueue() {
+                fossil_tofu_queue_mpmc_destroy(queue);
+            }
+
+            /**
+             * Push data onto the rear of the queue.
+             *
+             * @param data The data to push.
+             * @return     True on success, false if the queue is full.
+             */
+            bool try_push(const std::string& data) {
+                return fossil_tofu_queue_mpmc_try_push(queue, const_cast<char*>(data.c_str())) == FOSSIL_TOFU_SUCCESS;
+            }
+
+            /**
+             * Pop the front element of the queue.
+             *
+             * @param out Receives the element's value.
+             * @return    True on success, false if the queue is empty.
+             */
+            bool try_pop(std::string& out) {
+                fossil_tofu_t element;
+                if (fossil_tofu_queue_mpmc_try_pop(queue, &element) != FOSSIL_TOFU_SUCCESS) {
+                    return false;
+                }
+                char* value = fossil_tofu_get_value(&element);
+                out = value ? std::string(value) : std::string();
+                fossil_tofu_destroy(&element);
+                return true;
+            }
+
+            /**
+             * Get the number of elements in the queue.
+             *
+             * @return A snapshot of the element count.
+             */
+            size_t size() const {
+                return fossil_tofu_queue_mpmc_size(queue);
+            }
+
+            /**
+             * Get the capacity of the queue.
+             *
+             * @return The maximum number of elements the queue can hold.
+             */
+            size_t capacity() const {
+                return fossil_tofu_queue_mpmc_capacity(queue);
+            }
+
+        private:
+            fossil_tofu_queue_mpmc_t* queue;
+        };
+
     } // namespace tofu
 
 } // namespace fossil
@@ -36,15 +36,22 @@ extern "C"
 // Type definitions
 // *****************************************************************************
 
-// Set structure
-typedef struct fossil_tofu_setof_node_t {
-    fossil_tofu_t data; // Data stored in the set node
-    struct fossil_tofu_setof_node_t* next; // Pointer to the next node
-} fossil_tofu_setof_node_t;
+#define FOSSIL_TOFU_SETOF_MIN_CAPACITY 16 // Slots allocated by the first insert
+#define FOSSIL_TOFU_SETOF_LOAD_NUM 7      // The table grows once size exceeds
+#define FOSSIL_TOFU_SETOF_LOAD_DEN 8      // LOAD_NUM / LOAD_DEN of its capacity
 
+// A slot of the set's open-addressing table
+typedef struct fossil_tofu_setof_entry_t {
+    fossil_tofu_t data; // Element stored in the slot
+    uint32_t distance; // Probe distance plus one; 0 marks an empty slot
+} fossil_tofu_setof_entry_t;
+
+// Set structure: a Robin Hood hash table keyed by each element's `value.hash`
 typedef struct fossil_tofu_setof_t {
     char* type; // Type of the set
-    fossil_tofu_setof_node_t* head; // Pointer to the head node of the set
+    fossil_tofu_type_t type_enum; // Resolved once from `type` at creation
+    fossil_tofu_setof_entry_t* entries; // Slot array, NULL until the first insert
+    size_t capacity; // Number of slots, zero or a power of two
     size_t size; // Number of elements in the set
 } fossil_tofu_setof_t;
 
@@ -91,11 +98,12 @@ fossil_tofu_setof_t* fossil_tofu_setof_create_move(fossil_tofu_setof_t* other);
 void fossil_tofu_setof_destroy(fossil_tofu_setof_t* set);
 
 /**
- * @brief Inserts data into the set.
+ * @brief Inserts data into the set. Inserting an element already present leaves the set unchanged.
  *
  * @param set The set to insert data into.
  * @param data The data to insert.
  * @return An integer indicating success (0) or failure (non-zero).
+ * @note Time complexity: O(1) amortized
  */
 int32_t fossil_tofu_setof_insert(fossil_tofu_setof_t* set, char *data);
 
@@ -105,6 +113,7 @@ int32_t fossil_tofu_setof_insert(fossil_tofu_setof_t* set, char *data);
  * @param set The set to remove data from.
  * @param data The data to remove.
  * @return An integer indicating success (0) or failure (non-zero).
+ * @note Time complexity: O(1) average
  */
 int32_t fossil_tofu_setof_remove(fossil_tofu_setof_t* set, char *data);
 
@@ -114,6 +123,7 @@ int32_t fossil_tofu_setof_remove(fossil_tofu_setof_t* set, char *data);
  * @param set The set to check.
  * @param data The data to check for.
  * @return True if the set contains the data, false otherwise.
+ * @note Time complexity: O(1) average
  */
 bool fossil_tofu_setof_contains(const fossil_tofu_setof_t* set, char *data);
 
@@ -141,6 +151,46 @@ bool fossil_tofu_setof_not_empty(const fossil_tofu_setof_t* set);
  */
 bool fossil_tofu_setof_is_empty(const fossil_tofu_setof_t* set);
 
+/**
+ * @brief Creates a new set holding every element of either set.
+ *
+ * @param a The first set.
+ * @param b The second set, of the same type as `a`.
+ * @return A pointer to the new set, or NULL on failure or type mismatch.
+ * @note Time complexity: O(n + m)
+ */
+fossil_tofu_setof_t* fossil_tofu_setof_union(const fossil_tofu_setof_t* a, const fossil_tofu_setof_t* b);
+
+/**
+ * @brief Creates a new set holding the elements present in both sets.
+ *
+ * @param a The first set.
+ * @param b The second set, of the same type as `a`.
+ * @return A pointer to the new set, or NULL on failure or type mismatch.
+ * @note Time complexity: O(min(n, m)); the smaller set is probed against the larger
+ */
+fossil_tofu_setof_t* fossil_tofu_setof_intersection(const fossil_tofu_setof_t* a, const fossil_tofu_setof_t* b);
+
+/**
+ * @brief Creates a new set holding the elements of `a` that are not in `b`.
+ *
+ * @param a The set to take elements from.
+ * @param b The set of elements to leave out, of the same type as `a`.
+ * @return A pointer to the new set, or NULL on failure or type mismatch.
+ * @note Time complexity: O(n)
+ */
+fossil_tofu_setof_t* fossil_tofu_setof_difference(const fossil_tofu_setof_t* a, const fossil_tofu_setof_t* b);
+
+/**
+ * @brief Checks if every element of `a` is also in `b`.
+ *
+ * @param a The candidate subset.
+ * @param b The candidate superset.
+ * @return True if `a` is a subset of `b`, false otherwise or on type mismatch.
+ * @note Time complexity: O(n)
+ */
+bool fossil_tofu_setof_is_subset(const fossil_tofu_setof_t* a, const fossil_tofu_setof_t* b);
+
 #ifdef __cplusplus
 }
 #include <stdexcept>
@@ -237,7 +287,62 @@ namespace fossil {
                 return fossil_tofu_setof_is_empty(set_);
             }
 
+            /**
+             * @brief Creates a set holding every element of this set or the other.
+             * 
+             * @param other The set to unite with.
+             * @return The union of both sets.
+             * @throws std::runtime_error If the types differ or the set cannot be created.
+             */
+            SetOf set_union(const SetOf& other) const {
+                return SetOf(fossil_tofu_setof_union(set_, other.set_));
+            }
+
+            /**
+             * @brief Creates a set holding the elements present in both sets.
+             * 
+             * @param other The set to intersect with.
+             * @return The intersection of both sets.
+             * @throws std::runtime_error If the types differ or the set cannot be created.
+             */
+            SetOf intersection(const SetOf& other) const {
+                return SetOf(fossil_tofu_setof_intersection(set_, other.set_));
+            }
+
+            /**
+             * @brief Creates a set holding the elements of this set that are not in the other.
+             * 
+             * @param other The set of elements to leave out.
+             * @return The difference of both sets.
+             * @throws std::runtime_error If the types differ or the set cannot be created.
+             */
+            SetOf difference(const SetOf& other) const {
+                return SetOf(fossil_tofu_setof_difference(set_, other.set_));
+            }
+
+            /**
+             * @brief Checks if every element of this set is also in the other.
+             * 
+             * @param other The candidate superset.
+             * @return True if this set is a subset of the other, false otherwise.
+             */
+            bool is_subset(const SetOf& other) const {
+                return fossil_tofu_setof_is_subset(set_, other.set_);
+            }
+
         private:
+            /**
+             * @brief Takes ownership of a set created by the C API.
+             * 
+             * @param set The set to wrap.
+             * @throws std::runtime_error If `set` is NULL.
+             */
+            explicit SetOf(fossil_tofu_setof_t* set) : set_(set) {
+                if (!set_) {
+                    throw std::runtime_error("Failed to create set container.");
+                }
+            }
+
             fossil_tofu_setof_t* set_; /**< Pointer to the underlying C set structure. */
         };
 
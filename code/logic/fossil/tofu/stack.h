@@ -26,6 +26,7 @@
 #define FOSSIL_TOFU_STACK_H
 
 #include "tofu.h"
+#include "pool.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -44,7 +45,9 @@ typedef struct fossil_tofu_stack_node_t {
 
 typedef struct fossil_tofu_stack_t {
     char* type; // Type of the stack
+    fossil_tofu_type_t type_enum; // Resolved once from `type` at creation
     fossil_tofu_stack_node_t* top; // Pointer to the top node of the stack
+    fossil_tofu_pool_t pool; // Slab pool the nodes are taken from
 } fossil_tofu_stack_t;
 
 // *****************************************************************************
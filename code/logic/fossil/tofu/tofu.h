@@ -36,6 +36,7 @@
 #include <time.h>
 
 #define INITIAL_CAPACITY 10
+#define FOSSIL_TOFU_SMALL_CAPACITY 24 // Inline text buffer size, including the terminator
 
 #ifdef __cplusplus
 extern "C"
@@ -88,18 +89,41 @@ typedef enum {
     FOSSIL_TOFU_TYPE_CNULL      // Null pointer type
 } fossil_tofu_type_t;
 
+// Native in-place payload for numeric, boolean and character types.
+typedef union {
+    int64_t  i64;      // Signed integer types (i8..i64)
+    uint64_t u64;      // Unsigned integer types (u8..u64, size)
+    double   f64;      // Floating point types (f32, f64)
+    bool     b;        // Boolean type
+    char     c;        // Character type
+} fossil_tofu_native_t;
+
+// Short text payloads are kept inline in `small_data`; `data` then stays NULL,
+// so the text should always be read through `fossil_tofu_get_value`.
 typedef struct {
-    char *data;        // Pointer to the data
+    char *data;        // Heap text form (rendered at creation for native values)
     bool mutable_flag; // Whether the data is mutable_flag or immutable
-    uint64_t hash;     // Unique 64-bit hash value for the tofu
+    uint64_t hash;     // Hash of the current payload; equal values always hash alike
+    bool native;       // Whether the payload is stored in place in `as`
+    fossil_tofu_native_t as; // Native payload, valid when `native` is set
+    bool small;        // Whether the text form lives in `small_data`
+    bool shared;       // Whether `data` lives in a batch block shared with other values
+    size_t length;     // Length of the text form in bytes, excluding the terminator
+    union {
+        char small_data[FOSSIL_TOFU_SMALL_CAPACITY]; // Inline storage for short text
+        void *block;   // Batch block holding `data`, valid when `shared` is set
+    };
 } fossil_tofu_value_t;
 
-// Struct for tofu attributes
+// Struct for tofu attributes. By default the strings point at shared per-type
+// tables and must not be modified or freed; they are only allocated once a
+// custom attribute is set through `fossil_tofu_set_attribute`.
 typedef struct {
     char* name;          // Name of the attribute
     char* description;   // Description of the attribute
     char* id;            // Unique identifier for the attribute
     bool required;       // Whether this attribute must be set
+    bool owned;          // Whether the strings above are owned by this tofu
 } fossil_tofu_attribute_t;
 
 // Struct for tofu
@@ -116,6 +140,9 @@ typedef struct {
 /**
  * Function to create a `fossil_tofu_t` object based on type and value strings.
  *
+ * Numeric, boolean and character values given in canonical form (e.g. "42",
+ * "true", "x") are stored natively in place; any other text is kept as-is.
+ *
  * @param type The type string.
  * @param value The value string.
  * @return The created `fossil_tofu_t` object.
@@ -123,6 +150,53 @@ typedef struct {
  */
 fossil_tofu_t fossil_tofu_create(const char* type, const char* value);
 
+/**
+ * Function to create a `fossil_tofu_t` object from an already resolved type.
+ *
+ * Behaves like `fossil_tofu_create` but skips the type string lookup, so
+ * containers resolve their type once and use this on every insert.
+ *
+ * @param type The type of the value.
+ * @param value The value string.
+ * @return The created `fossil_tofu_t` object.
+ * @note O(1) - Constant time complexity.
+ */
+fossil_tofu_t fossil_tofu_create_typed(fossil_tofu_type_t type, const char* value);
+
+/**
+ * Function to build a read-only view of a value string for key lookups.
+ *
+ * The result hashes and compares equal to `fossil_tofu_create_typed(type, value)`
+ * but nothing is allocated: native types are parsed in place and other text is
+ * borrowed from `value`. The view must not outlive `value`, and must not be
+ * modified or destroyed.
+ *
+ * @param type The type of the value.
+ * @param value The value string.
+ * @return The view, or a zeroed `fossil_tofu_t` if `value` is NULL.
+ * @note O(n) - Linear time complexity based on the string length.
+ */
+fossil_tofu_t fossil_tofu_view_typed(fossil_tofu_type_t type, const char* value);
+
+/**
+ * Function to create `count` `fossil_tofu_t` objects of the same type at once.
+ *
+ * Values that are not stored natively or inline share a single backing
+ * allocation instead of one allocation each. Every created object still has
+ * to be destroyed with `fossil_tofu_destroy`; the shared block is released
+ * together with the last object using it, so a single surviving object keeps
+ * the whole block alive. The objects may be destroyed on different threads.
+ *
+ * @param type The type of the values.
+ * @param values Array of `count` value strings.
+ * @param count The number of values.
+ * @param out Array receiving the `count` created objects.
+ * @return `FOSSIL_TOFU_SUCCESS` on success, or an error code if an argument is
+ *         invalid or allocation fails (in which case nothing is created).
+ * @note O(n) - Linear time complexity based on the total size of the values.
+ */
+int fossil_tofu_create_batch(fossil_tofu_type_t type, const char *const *values, size_t count, fossil_tofu_t *out);
+
 /**
  * @brief Creates a new tofu with default values.
  *
@@ -183,12 +257,30 @@ int fossil_tofu_set_value(fossil_tofu_t *tofu, char *value);
 /**
  * Function to get the value of a `fossil_tofu_t` object as a string.
  *
+ * Every value carries its text form from creation, natively stored ones
+ * included, so this never modifies the object and is safe to call from
+ * several threads at once.
+ * Short strings are stored inline, so the returned pointer refers to storage
+ * inside the object: it is only valid while the object is neither moved nor
+ * changed, and containers that relocate their elements invalidate it.
+ *
  * @param tofu The `fossil_tofu_t` object.
  * @return The value string or `NULL` if the object is invalid.
  * @note O(1) - Constant time complexity.
  */
 char* fossil_tofu_get_value(const fossil_tofu_t *tofu);
 
+/**
+ * Function to get the length of the value string of a `fossil_tofu_t` object.
+ *
+ * The length is stored alongside the value, so no scan of the string is needed.
+ *
+ * @param tofu The `fossil_tofu_t` object.
+ * @return The length of the value string in bytes, or 0 if the object is invalid.
+ * @note O(1) - Constant time complexity.
+ */
+size_t fossil_tofu_get_length(const fossil_tofu_t *tofu);
+
 /**
  * Function to check if the `fossil_tofu_t` object is mutable_flag.
  *
@@ -252,8 +344,36 @@ void fossil_tofu_display(const fossil_tofu_t *tofu);
  */
 fossil_tofu_type_t fossil_tofu_validate_type(const char *type_str);
 
+/**
+ * Function to compute a seeded 64-bit hash of a buffer.
+ *
+ * The buffer is consumed in 32-byte stripes of little-endian 64-bit lanes, so
+ * the result is identical on every platform.
+ *
+ * @param data Pointer to the input buffer.
+ * @param len  Length of the input buffer in bytes.
+ * @param seed Seed for independent hash streams (0 for unseeded).
+ * @return The 64-bit hash, or 0 if `data` is NULL.
+ * @note O(n) - Linear time complexity based on the buffer length.
+ */
+uint64_t fossil_tofu_hash64_seed(const void *data, size_t len, uint64_t seed);
+
+/**
+ * Function to compute the unseeded 64-bit hash of a C string.
+ *
+ * The length is found while hashing, in a single pass over the string. The
+ * result equals `fossil_tofu_hash64_seed(data, strlen(data), 0)`.
+ *
+ * @param data The NUL-terminated string to hash.
+ * @return The 64-bit hash, or 0 if `data` is NULL.
+ * @note O(n) - Linear time complexity based on the string length.
+ */
+uint64_t fossil_tofu_hash64(const char *data);
+
 /**
  * Function to set an attribute for the `fossil_tofu_t` object.
+ * The strings are copied, so this is the only point where attributes allocate;
+ * on failure the previous attribute is left untouched.
  *
  * @param tofu Pointer to the `fossil_tofu_t` object.
  * @param name The attribute name.
@@ -276,6 +396,9 @@ const fossil_tofu_attribute_t* fossil_tofu_get_attribute(const fossil_tofu_t *to
 /**
  * Function to compare two `fossil_tofu_t` objects for equality.
  *
+ * Values whose cached hashes differ are rejected before their payloads are
+ * looked at, so most mismatches cost a single integer comparison.
+ *
  * @param tofu1 The first `fossil_tofu_t` object.
  * @param tofu2 The second `fossil_tofu_t` object.
  * @return `true` if the objects are equal, `false` otherwise.
@@ -298,7 +421,7 @@ int fossil_tofu_copy(fossil_tofu_t *dest, const fossil_tofu_t *src);
  *
  * @param tofu The tofu object to serialize.
  * @return A newly allocated string containing the serialized representation.
- *         Caller must free the string.
+ *         Caller must free the string with `fossil_tofu_free`.
  * @note O(n) - Linear complexity based on data size.
  */
 char* fossil_tofu_serialize(const fossil_tofu_t *tofu);
@@ -642,6 +765,73 @@ fossil_tofu_t fossil_tofu_from_any(void *data, size_t size);
  */
 typedef void * tofu_memory_t;
 
+/**
+ * @brief Allocator hooks used by `fossil_tofu_alloc`, `fossil_tofu_realloc` and
+ * `fossil_tofu_free`.
+ *
+ * Every callback receives `context` as its first argument, so one set of
+ * functions can serve several arenas or pools. All three callbacks are required.
+ * `realloc` follows the C library contract: a NULL `ptr` allocates and a
+ * failed call leaves `ptr` untouched.
+ */
+typedef struct {
+    tofu_memory_t (*alloc)(void *context, size_t size);
+    tofu_memory_t (*realloc)(void *context, tofu_memory_t ptr, size_t size);
+    void (*free)(void *context, tofu_memory_t ptr);
+    void *context;
+} fossil_tofu_allocator_t;
+
+/**
+ * @brief Install the allocator used by every thread without its own allocator.
+ *
+ * The hooks are copied, so `allocator` does not have to outlive the call.
+ * Passing NULL restores the default `malloc`/`realloc`/`free` allocator.
+ * Install the allocator before any tofu memory is allocated, and do not
+ * swap it while blocks from the previous allocator are still alive, since each
+ * block must be released by the allocator that produced it.
+ *
+ * @param allocator The allocator hooks, or NULL for the default allocator.
+ * @return FOSSIL_TOFU_SUCCESS, or FOSSIL_TOFU_ERROR_INVALID_ARGUMENT if a hook is missing.
+ * @note O(1) - Constant time complexity.
+ */
+int fossil_tofu_set_allocator(const fossil_tofu_allocator_t *allocator);
+
+/**
+ * @brief Install an allocator for the calling thread only.
+ *
+ * Takes precedence over the global allocator on this thread. Passing NULL
+ * makes the thread fall back to the global allocator again. The same lifetime
+ * rules as `fossil_tofu_set_allocator` apply.
+ *
+ * Blocks do not remember which allocator produced them: `fossil_tofu_free`
+ * always uses the allocator of the thread that calls it. A value created while
+ * a thread allocator is installed must therefore be destroyed on that thread,
+ * or on one with an allocator that can release the same blocks. Values passed
+ * between threads, for example through the concurrent queues, should be
+ * created under the global allocator.
+ *
+ * @param allocator The allocator hooks, or NULL to clear the thread allocator.
+ * @return FOSSIL_TOFU_SUCCESS, or FOSSIL_TOFU_ERROR_INVALID_ARGUMENT if a hook is missing.
+ * @note O(1) - Constant time complexity.
+ */
+int fossil_tofu_set_thread_allocator(const fossil_tofu_allocator_t *allocator);
+
+/**
+ * @brief Get the allocator in effect on the calling thread.
+ *
+ * @return The thread allocator if one is set, otherwise the global allocator.
+ * @note O(1) - Constant time complexity.
+ */
+const fossil_tofu_allocator_t *fossil_tofu_get_allocator(void);
+
+/**
+ * @brief Get the allocator installed for the calling thread only.
+ *
+ * @return The thread allocator, or NULL if the thread uses the global allocator.
+ * @note O(1) - Constant time complexity.
+ */
+const fossil_tofu_allocator_t *fossil_tofu_get_thread_allocator(void);
+
 /**
  * @brief Allocate memory.
  * 
@@ -664,6 +854,9 @@ tofu_memory_t fossil_tofu_realloc(tofu_memory_t ptr, size_t size);
 /**
  * @brief Free memory.
  * 
+ * The block goes back through the calling thread's allocator, which must be
+ * the one that allocated it.
+ * 
  * @param ptr Pointer to the memory to fossil_tofu_free.
  * @note O(1) - Constant time complexity.
  */
@@ -715,6 +908,13 @@ namespace fossil {
                 }
             }
 
+            /**
+             * @brief Constructs a new Tofu object from an already resolved type and a value.
+             */
+            Tofu(fossil_tofu_type_t type, const std::string& value) {
+                tofu_ = fossil_tofu_create_typed(type, value.c_str());
+            }
+
             /**
              * @brief Default constructor. Creates a Tofu object with default values.
              */
@@ -782,7 +982,14 @@ namespace fossil {
              */
             std::string get_value() const {
                 const char* value = fossil_tofu_get_value(&tofu_);
-                return value ? std::string(value) : std::string();
+                return value ? std::string(value, fossil_tofu_get_length(&tofu_)) : std::string();
+            }
+
+            /**
+             * @brief Gets the length of the value string without scanning it.
+             */
+            size_t get_length() const {
+                return fossil_tofu_get_length(&tofu_);
             }
 
             /**
@@ -26,6 +26,7 @@
 #define FOSSIL_TOFU_TREE_H
 
 #include "tofu.h"
+#include "pool.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -36,18 +37,35 @@ extern "C"
 // Type Definitions
 // *****************************************************************************
 
+// Upper bound on the height of a tree with SIZE_MAX nodes (1.44 * 64), used to
+// size the explicit stacks that replace recursion
+#define FOSSIL_TOFU_TREE_MAX_HEIGHT 96
+
+// The tree is kept AVL-balanced: the heights of any node's two subtrees differ
+// by at most one, so searches, inserts and removes stay O(log n) even when the
+// keys arrive in sorted order.
 typedef struct fossil_tofu_tree_node_t {
     fossil_tofu_t *value;
     struct fossil_tofu_tree_node_t *left;
     struct fossil_tofu_tree_node_t *right;
+    int height; // Height of the subtree rooted here, 1 for a leaf
+    size_t count; // Number of nodes in the subtree rooted here
 } fossil_tofu_tree_node_t;
 
 typedef struct {
     fossil_tofu_tree_node_t *root;
     char *type;
     size_t size;
+    fossil_tofu_pool_t pool; // Slab pool the nodes are taken from
 } fossil_tofu_tree_t;
 
+// In-order cursor over a tree. It holds the ancestors whose values are still
+// to come, so it needs no parent pointers; any insert or remove invalidates it.
+typedef struct {
+    fossil_tofu_tree_node_t *stack[FOSSIL_TOFU_TREE_MAX_HEIGHT]; // Pending nodes, the next one last
+    size_t depth; // Number of pending nodes
+} fossil_tofu_tree_iter_t;
+
 /**
  * -----------------------------------------------------------------------------
  * Tree Management Functions
@@ -105,6 +123,9 @@ void fossil_tofu_tree_destroy(fossil_tofu_tree_t *tree);
 /**
  * @brief Creates a new tree node with the given value.
  * 
+ * The node is allocated on its own and is owned by the caller; nodes made by
+ * `fossil_tofu_tree_insert` come from the tree's pool instead.
+ * 
  * @param value Pointer to the value to store in the node.
  * @return Pointer to the newly created fossil_tofu_tree_node_t structure.
  */
@@ -165,6 +186,8 @@ fossil_tofu_tree_node_t* fossil_tofu_tree_max(fossil_tofu_tree_t *tree);
 /**
  * @brief Gets the height of the tree.
  * 
+ * The tree is balanced, so the height stays within about 1.44 log2(n).
+ * 
  * @param tree Pointer to the tree.
  * @return Height of the tree.
  */
@@ -178,6 +201,45 @@ int fossil_tofu_tree_height(fossil_tofu_tree_t *tree);
  */
 int fossil_tofu_tree_is_empty(fossil_tofu_tree_t *tree);
 
+/**
+ * -----------------------------------------------------------------------------
+ * Order Statistics
+ * -----------------------------------------------------------------------------
+ */
+
+/**
+ * @brief Counts the values in the tree that are less than the given value.
+ * 
+ * This is the zero-based position the value has, or would have, in sorted order.
+ * 
+ * @param tree Pointer to the tree.
+ * @param value Pointer to the value to rank.
+ * @return Number of values less than `value`.
+ * @note Time complexity: O(log n)
+ */
+size_t fossil_tofu_tree_rank(fossil_tofu_tree_t *tree, const fossil_tofu_t *value);
+
+/**
+ * @brief Gets the node holding the k-th smallest value.
+ * 
+ * @param tree Pointer to the tree.
+ * @param k Zero-based position in sorted order.
+ * @return Pointer to the node, or NULL if `k` is not less than the tree's size.
+ * @note Time complexity: O(log n)
+ */
+fossil_tofu_tree_node_t* fossil_tofu_tree_select(fossil_tofu_tree_t *tree, size_t k);
+
+/**
+ * @brief Counts the values in the tree between `lo` and `hi`, both inclusive.
+ * 
+ * @param tree Pointer to the tree.
+ * @param lo Pointer to the lower bound.
+ * @param hi Pointer to the upper bound.
+ * @return Number of values in range, 0 if `lo` is greater than `hi`.
+ * @note Time complexity: O(log n)
+ */
+size_t fossil_tofu_tree_count_range(fossil_tofu_tree_t *tree, const fossil_tofu_t *lo, const fossil_tofu_t *hi);
+
 /**
  * -----------------------------------------------------------------------------
  * Traversal Functions
@@ -202,6 +264,10 @@ void fossil_tofu_tree_traverse(fossil_tofu_tree_t *tree, fossil_tofu_tree_visit_
 /**
  * @brief Performs an inorder traversal of the tree nodes.
  * 
+ * The walk uses a fixed stack of FOSSIL_TOFU_TREE_MAX_HEIGHT entries, which any
+ * subtree of a tree built by this API fits; a deeper hand-linked subtree stops
+ * the walk early instead of overflowing it.
+ * 
  * @param node Pointer to the current node.
  * @param visit Function to call for each node's value.
  */
@@ -210,6 +276,10 @@ void fossil_tofu_tree_traverse_inorder(fossil_tofu_tree_node_t *node, fossil_tof
 /**
  * @brief Performs a preorder traversal of the tree nodes.
  * 
+ * The walk uses a fixed stack of FOSSIL_TOFU_TREE_MAX_HEIGHT entries, which any
+ * subtree of a tree built by this API fits; a deeper hand-linked subtree stops
+ * the walk early instead of overflowing it.
+ * 
  * @param node Pointer to the current node.
  * @param visit Function to call for each node's value.
  */
@@ -218,11 +288,102 @@ void fossil_tofu_tree_traverse_preorder(fossil_tofu_tree_node_t *node, fossil_to
 /**
  * @brief Performs a postorder traversal of the tree nodes.
  * 
+ * The walk uses a fixed stack of FOSSIL_TOFU_TREE_MAX_HEIGHT entries, which any
+ * subtree of a tree built by this API fits; a deeper hand-linked subtree stops
+ * the walk early instead of overflowing it.
+ * 
  * @param node Pointer to the current node.
  * @param visit Function to call for each node's value.
  */
 void fossil_tofu_tree_traverse_postorder(fossil_tofu_tree_node_t *node, fossil_tofu_tree_visit_fn visit);
 
+/**
+ * @brief Function pointer type for visiting values with caller context.
+ * 
+ * @param value Pointer to the value in the node being visited.
+ * @param context The context pointer passed to the traversal.
+ * @return true to continue the traversal, false to stop it.
+ */
+typedef bool (*fossil_tofu_tree_visit_ctx_fn)(fossil_tofu_t *value, void *context);
+
+/**
+ * @brief Visits the tree's values in order, passing `context` along, until `visit` returns false.
+ * 
+ * @param tree Pointer to the tree to traverse.
+ * @param visit Function to call for each value.
+ * @param context Pointer passed to every call of `visit`.
+ * @return true if every value was visited, false if `visit` stopped the traversal.
+ */
+bool fossil_tofu_tree_traverse_ctx(fossil_tofu_tree_t *tree, fossil_tofu_tree_visit_ctx_fn visit, void *context);
+
+/**
+ * @brief Performs an inorder traversal with caller context and early exit.
+ * 
+ * @param node Pointer to the subtree root.
+ * @param visit Function to call for each value.
+ * @param context Pointer passed to every call of `visit`.
+ * @return true if every value was visited, false if `visit` stopped the traversal
+ *         or the subtree is too deep for the FOSSIL_TOFU_TREE_MAX_HEIGHT stack.
+ */
+bool fossil_tofu_tree_traverse_inorder_ctx(fossil_tofu_tree_node_t *node, fossil_tofu_tree_visit_ctx_fn visit, void *context);
+
+/**
+ * @brief Performs a preorder traversal with caller context and early exit.
+ * 
+ * @param node Pointer to the subtree root.
+ * @param visit Function to call for each value.
+ * @param context Pointer passed to every call of `visit`.
+ * @return true if every value was visited, false if `visit` stopped the traversal
+ *         or the subtree is too deep for the FOSSIL_TOFU_TREE_MAX_HEIGHT stack.
+ */
+bool fossil_tofu_tree_traverse_preorder_ctx(fossil_tofu_tree_node_t *node, fossil_tofu_tree_visit_ctx_fn visit, void *context);
+
+/**
+ * @brief Performs a postorder traversal with caller context and early exit.
+ * 
+ * @param node Pointer to the subtree root.
+ * @param visit Function to call for each value.
+ * @param context Pointer passed to every call of `visit`.
+ * @return true if every value was visited, false if `visit` stopped the traversal
+ *         or the subtree is too deep for the FOSSIL_TOFU_TREE_MAX_HEIGHT stack.
+ */
+bool fossil_tofu_tree_traverse_postorder_ctx(fossil_tofu_tree_node_t *node, fossil_tofu_tree_visit_ctx_fn visit, void *context);
+
+/**
+ * -----------------------------------------------------------------------------
+ * Cursor Functions
+ * -----------------------------------------------------------------------------
+ */
+
+/**
+ * @brief Positions a cursor before the smallest value in the tree.
+ * 
+ * @param tree Pointer to the tree.
+ * @param iter Pointer to the cursor to initialize.
+ * @note Time complexity: O(log n)
+ */
+void fossil_tofu_tree_iter_begin(fossil_tofu_tree_t *tree, fossil_tofu_tree_iter_t *iter);
+
+/**
+ * @brief Positions a cursor before the smallest value not less than `value`.
+ * 
+ * @param tree Pointer to the tree.
+ * @param iter Pointer to the cursor to initialize.
+ * @param value Pointer to the value to seek to.
+ * @return true if such a value exists, false if the cursor is at the end.
+ * @note Time complexity: O(log n)
+ */
+bool fossil_tofu_tree_iter_seek(fossil_tofu_tree_t *tree, fossil_tofu_tree_iter_t *iter, const fossil_tofu_t *value);
+
+/**
+ * @brief Returns the next node in order and advances the cursor past it.
+ * 
+ * @param iter Pointer to the cursor.
+ * @return Pointer to the node, or NULL once every value has been returned.
+ * @note Time complexity: O(1) amortized, O(log n) worst case
+ */
+fossil_tofu_tree_node_t* fossil_tofu_tree_iter_next(fossil_tofu_tree_iter_t *iter);
+
 /**
  * -----------------------------------------------------------------------------
  * Utility Functions
@@ -452,6 +613,34 @@ namespace fossil {
                 return !tree_ || tree_->size == 0;
             }
 
+            /**
+             * @brief Counts the values in the tree that are less than the given value.
+             * @param value The Tofu object to rank.
+             * @return Number of values less than `value`.
+             */
+            size_t rank(const Tofu& value) const {
+                return fossil_tofu_tree_rank(tree_, &value.get_c_struct());
+            }
+
+            /**
+             * @brief Gets the node holding the k-th smallest value.
+             * @param k Zero-based position in sorted order.
+             * @return Pointer to the node, or nullptr if `k` is out of range.
+             */
+            fossil_tofu_tree_node_t* select(size_t k) const {
+                return fossil_tofu_tree_select(tree_, k);
+            }
+
+            /**
+             * @brief Counts the values between two bounds, both inclusive.
+             * @param lo The lower bound.
+             * @param hi The upper bound.
+             * @return Number of values in range.
+             */
+            size_t count_range(const Tofu& lo, const Tofu& hi) const {
+                return fossil_tofu_tree_count_range(tree_, &lo.get_c_struct(), &hi.get_c_struct());
+            }
+
             /**
              * @brief Gets the number of nodes in the tree.
              * @return The number of nodes in the tree.
@@ -504,6 +693,19 @@ namespace fossil {
                 fossil_tofu_tree_traverse_postorder(tree_->root, visit);
             }
 
+            /**
+             * @brief Visits the values in order until the callable returns false.
+             * @param visit Callable taking a fossil_tofu_t* and returning bool; it may capture state.
+             * @return true if every value was visited, false if `visit` stopped the traversal.
+             */
+            template <typename Visit>
+            bool traverse_until(Visit visit) {
+                if (!tree_) return true;
+                return fossil_tofu_tree_traverse_ctx(tree_, [](fossil_tofu_t* value, void* context) -> bool {
+                    return (*static_cast<Visit*>(context))(value);
+                }, &visit);
+            }
+
             /**
              * @brief Clears all nodes from the tree, but does not destroy the tree itself.
              */
@@ -42,6 +42,7 @@ typedef struct {
     size_t element_count;     // Number of elements in the tuple
     size_t capacity;          // Capacity of the tuple
     char* type;               // Expected type of elements in the tuple
+    fossil_tofu_type_t type_enum; // Resolved once from `type` at creation
 } fossil_tofu_tuple_t;
 
 // *****************************************************************************
@@ -152,12 +153,16 @@ void fossil_tofu_tuple_clear(fossil_tofu_tuple_t *tuple);
 // Getter and setter functions
 // *****************************************************************************
 
+// The getters return text stored in the tuple's element array, inline when
+// short. Adding an element may reallocate that array and setting one replaces
+// its text, so the string is only valid until the tuple is next modified.
+
 /**
  * @brief Gets the element at the specified index in the tuple.
  * 
  * @param tuple The tuple from which to get the element.
  * @param index The index of the element to get.
- * @return The element at the specified index.
+ * @return The element at the specified index, valid until the tuple changes.
  * @note Time complexity: O(1)
  */
 char *fossil_tofu_tuple_get(fossil_tofu_tuple_t* tuple, size_t index);
@@ -166,7 +171,7 @@ char *fossil_tofu_tuple_get(fossil_tofu_tuple_t* tuple, size_t index);
  * @brief Gets the first element in the tuple.
  * 
  * @param tuple The tuple from which to get the first element.
- * @return The first element in the tuple.
+ * @return The first element in the tuple, valid until the tuple changes.
  * @note Time complexity: O(1)
  */
 char *fossil_tofu_tuple_get_front(const fossil_tofu_tuple_t* tuple);
@@ -175,7 +180,7 @@ char *fossil_tofu_tuple_get_front(const fossil_tofu_tuple_t* tuple);
  * @brief Gets the last element in the tuple.
  * 
  * @param tuple The tuple from which to get the last element.
- * @return The last element in the tuple.
+ * @return The last element in the tuple, valid until the tuple changes.
  * @note Time complexity: O(1)
  */
 char *fossil_tofu_tuple_get_back(const fossil_tofu_tuple_t* tuple);
@@ -26,6 +26,7 @@
 #define FOSSIL_TOFU_VECTOR_H
 
 #include "tofu.h"
+#include "arena.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -40,6 +41,8 @@ typedef struct {
     size_t size;
     size_t capacity;
     char* type;
+    fossil_tofu_type_t type_enum; // Resolved once from `type` at creation
+    fossil_tofu_arena_t* arena;   // Arena holding all memory, or NULL for the heap
 } fossil_tofu_vector_t;
 
 // *****************************************************************************
@@ -56,6 +59,20 @@ typedef struct {
  */
 fossil_tofu_vector_t* fossil_tofu_vector_create_container(char* type);
 
+/**
+ * Create a new vector whose storage and elements are allocated from an arena.
+ * 
+ * Destroying the vector is a no-op; its memory is released in one step by
+ * `fossil_tofu_arena_reset` or `fossil_tofu_arena_destroy`.
+ * 
+ * Time complexity: O(1)
+ *
+ * @param type  The expected type of elements in the vector.
+ * @param arena The arena to allocate from.
+ * @return      The created vector, or NULL on failure.
+ */
+fossil_tofu_vector_t* fossil_tofu_vector_create_in_arena(char* type, fossil_tofu_arena_t* arena);
+
 /**
  * Create a new vector with default values.
  * 
@@ -108,6 +125,21 @@ void fossil_tofu_vector_destroy(fossil_tofu_vector_t* vector);
  */
 void fossil_tofu_vector_push_back(fossil_tofu_vector_t* vector, char *element);
 
+/**
+ * Add several elements to the end of the vector.
+ * 
+ * Capacity is reserved once for the whole batch and the elements are built
+ * with `fossil_tofu_create_batch`, so their payloads share one allocation.
+ * 
+ * Time complexity: O(n) in the number of added elements
+ *
+ * @param vector   The vector to which the elements will be added.
+ * @param elements The elements to add.
+ * @param count    The number of elements.
+ * @return FOSSIL_TOFU_SUCCESS on success, FOSSIL_TOFU_FAILURE otherwise.
+ */
+int32_t fossil_tofu_vector_push_back_many(fossil_tofu_vector_t* vector, char **elements, size_t count);
+
 /**
  * Add an element to the front of the vector.
  * 
@@ -230,6 +262,10 @@ size_t fossil_tofu_vector_capacity(const fossil_tofu_vector_t* vector);
 // Getter and setter functions
 // *****************************************************************************
 
+// The getters return the element's text where it is stored. Short text lives
+// inside the element itself, so the pointer only stays valid until the vector
+// next adds, removes or sets an element; copy the string to keep it longer.
+
 /**
  * Get the element at the specified index in the vector.
  * 
@@ -237,7 +273,7 @@ size_t fossil_tofu_vector_capacity(const fossil_tofu_vector_t* vector);
  *
  * @param vector The vector from which to get the element.
  * @param index  The index of the element to get.
- * @return       The element at the specified index.
+ * @return       The element at the specified index, valid until the vector changes.
  */
 char *fossil_tofu_vector_get(const fossil_tofu_vector_t* vector, size_t index);
 
@@ -247,7 +283,7 @@ char *fossil_tofu_vector_get(const fossil_tofu_vector_t* vector, size_t index);
  * Time complexity: O(1)
  *
  * @param vector The vector from which to get the first element.
- * @return       The first element in the vector.
+ * @return       The first element in the vector, valid until the vector changes.
  */
 char *fossil_tofu_vector_get_front(const fossil_tofu_vector_t* vector);
 
@@ -257,7 +293,7 @@ char *fossil_tofu_vector_get_front(const fossil_tofu_vector_t* vector);
  * Time complexity: O(1)
  *
  * @param vector The vector from which to get the last element.
- * @return       The last element in the vector.
+ * @return       The last element in the vector, valid until the vector changes.
  */
 char *fossil_tofu_vector_get_back(const fossil_tofu_vector_t* vector);
 
@@ -268,7 +304,7 @@ char *fossil_tofu_vector_get_back(const fossil_tofu_vector_t* vector);
  *
  * @param vector The vector from which to get the element.
  * @param index  The index of the element to get.
- * @return       The element at the specified index.
+ * @return       The element at the specified index, valid until the vector changes.
  */
 char *fossil_tofu_vector_get_at(const fossil_tofu_vector_t* vector, size_t index);
 
@@ -318,6 +354,7 @@ void fossil_tofu_vector_set_at(fossil_tofu_vector_t* vector, size_t index, char
 }
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace fossil {
 
@@ -351,6 +388,20 @@ namespace fossil {
                 }
             }
 
+            /**
+             * Constructor that creates a new vector in an arena. The arena must
+             * outlive the vector.
+             * Throws a runtime_error if the vector creation fails.
+             *
+             * @param type The expected type of elements in the vector.
+             * @param arena The arena to allocate from.
+             */
+            Vector(const std::string& type, Arena& arena) : vector(fossil_tofu_vector_create_in_arena(const_cast<char*>(type.c_str()), arena.get())) {
+                if (fossil_tofu_vector_is_cnullptr(vector)) {
+                    throw std::runtime_error("Failed to create vector");
+                }
+            }
+
             /**
              * Copy constructor. Creates a new vector by copying an existing vector.
              * Throws a runtime_error if the vector creation fails.
@@ -391,6 +442,23 @@ namespace fossil {
                 fossil_tofu_vector_push_back(vector, const_cast<char*>(element.c_str()));
             }
 
+            /**
+             * Adds several elements to the end of the vector in one batch.
+             * Throws a runtime_error if the elements could not be added.
+             *
+             * @param elements The elements to add.
+             */
+            void push_back_many(const std::vector<std::string>& elements) {
+                std::vector<char*> ptrs;
+                ptrs.reserve(elements.size());
+                for (const auto& element : elements) {
+                    ptrs.push_back(const_cast<char*>(element.c_str()));
+                }
+                if (fossil_tofu_vector_push_back_many(vector, ptrs.data(), ptrs.size()) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to add elements");
+                }
+            }
+
             /**
              * Adds an element to the front of the vector.
              *
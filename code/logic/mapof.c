@@ -24,22 +24,114 @@
  */
 #include "fossil/tofu/mapof.h"
 
+// *****************************************************************************
+// Table helpers
+// *****************************************************************************
+
+#define FOSSIL_TOFU_MAPOF_NOT_FOUND ((size_t)-1)
+
+// Returns the slot holding `key`, or FOSSIL_TOFU_MAPOF_NOT_FOUND.
+static size_t fossil_tofu_mapof_find(const fossil_tofu_mapof_t* map, const fossil_tofu_t* key) {
+    if (map->capacity == 0) return FOSSIL_TOFU_MAPOF_NOT_FOUND;
+
+    size_t mask = map->capacity - 1;
+    size_t index = (size_t)key->value.hash & mask;
+    for (uint32_t distance = 1;; distance++) {
+        const fossil_tofu_mapof_entry_t* entry = &map->entries[index];
+        // An empty slot, or a resident nearer its home than the key would be,
+        // means the key was never placed beyond this point
+        if (entry->distance < distance) return FOSSIL_TOFU_MAPOF_NOT_FOUND;
+        if (entry->key.value.hash == key->value.hash && fossil_tofu_equals(&entry->key, key)) {
+            return index;
+        }
+        index = (index + 1) & mask;
+    }
+}
+
+// Places an entry whose key is known to be absent; the table must have a free slot.
+static void fossil_tofu_mapof_place(fossil_tofu_mapof_t* map, fossil_tofu_mapof_entry_t carry) {
+    size_t mask = map->capacity - 1;
+    size_t index = (size_t)carry.key.value.hash & mask;
+    carry.distance = 1;
+    for (;;) {
+        fossil_tofu_mapof_entry_t* entry = &map->entries[index];
+        if (entry->distance == 0) {
+            *entry = carry;
+            return;
+        }
+        // Take the slot from a resident that is closer to home, then carry it on
+        if (entry->distance < carry.distance) {
+            fossil_tofu_mapof_entry_t swap = *entry;
+            *entry = carry;
+            carry = swap;
+        }
+        index = (index + 1) & mask;
+        carry.distance++;
+    }
+}
+
+// Rehashes into a table of `capacity` slots. Called with the map's arena entered.
+static bool fossil_tofu_mapof_resize(fossil_tofu_mapof_t* map, size_t capacity) {
+    fossil_tofu_mapof_entry_t* entries = (fossil_tofu_mapof_entry_t*)fossil_tofu_alloc(capacity * sizeof(fossil_tofu_mapof_entry_t));
+    if (!entries) return false;
+    for (size_t i = 0; i < capacity; i++) {
+        entries[i].distance = 0;
+    }
+
+    fossil_tofu_mapof_entry_t* old_entries = map->entries;
+    size_t old_capacity = map->capacity;
+    map->entries = entries;
+    map->capacity = capacity;
+    for (size_t i = 0; i < old_capacity; i++) {
+        if (old_entries[i].distance != 0) {
+            fossil_tofu_mapof_place(map, old_entries[i]);
+        }
+    }
+    fossil_tofu_free(old_entries);
+    return true;
+}
+
 // *****************************************************************************
 // Function definitions
 // *****************************************************************************
 
+// Creates an empty map with already resolved types. Copies and moves use it
+// so they never re-parse type strings the source map may no longer own.
+static fossil_tofu_mapof_t* fossil_tofu_mapof_create_as(const fossil_tofu_mapof_t* like, fossil_tofu_arena_t* arena) {
+    fossil_tofu_arena_enter(arena);
+    fossil_tofu_mapof_t* map = (fossil_tofu_mapof_t*)fossil_tofu_alloc(sizeof(fossil_tofu_mapof_t));
+    fossil_tofu_arena_leave(arena);
+    if (!map) return NULL;
+    map->key_type = like->key_type;
+    map->value_type = like->value_type;
+    map->key_type_enum = like->key_type_enum;
+    map->value_type_enum = like->value_type_enum;
+    map->entries = NULL;
+    map->capacity = 0;
+    map->size = 0;
+    map->arena = arena;
+    return map;
+}
+
 fossil_tofu_mapof_t* fossil_tofu_mapof_create_container(char* key_type, char* value_type) {
     if (!key_type || !value_type) return NULL;
-    if (fossil_tofu_validate_type(key_type) == FOSSIL_TOFU_TYPE_CNULL ||
-        fossil_tofu_validate_type(value_type) == FOSSIL_TOFU_TYPE_CNULL)
+    fossil_tofu_mapof_t like;
+    like.key_type = key_type;
+    like.value_type = value_type;
+    like.key_type_enum = fossil_tofu_validate_type(key_type);
+    like.value_type_enum = fossil_tofu_validate_type(value_type);
+    if (like.key_type_enum == FOSSIL_TOFU_TYPE_CNULL ||
+        like.value_type_enum == FOSSIL_TOFU_TYPE_CNULL)
         return NULL;
+    return fossil_tofu_mapof_create_as(&like, NULL);
+}
 
-    fossil_tofu_mapof_t* map = (fossil_tofu_mapof_t*)fossil_tofu_alloc(sizeof(fossil_tofu_mapof_t));
-    if (!map) return NULL;
-    map->key_type = key_type;
-    map->value_type = value_type;
-    map->head = NULL;
-    map->size = 0;
+fossil_tofu_mapof_t* fossil_tofu_mapof_create_in_arena(char* key_type, char* value_type, fossil_tofu_arena_t* arena) {
+    if (!arena) return NULL;
+    fossil_tofu_arena_enter(arena);
+    fossil_tofu_mapof_t* map = fossil_tofu_mapof_create_container(key_type, value_type);
+    if (map) map->arena = arena;
+    fossil_tofu_arena_leave(arena);
     return map;
 }
 
@@ -50,19 +142,20 @@ fossil_tofu_mapof_t* fossil_tofu_mapof_create_default(void) {
 fossil_tofu_mapof_t* fossil_tofu_mapof_create_copy(const fossil_tofu_mapof_t* other) {
     if (!other) return NULL;
 
-    fossil_tofu_mapof_t* map = fossil_tofu_mapof_create_container(other->key_type, other->value_type);
+    // A copy of an arena-backed map lives in the same arena
+    fossil_tofu_mapof_t* map = fossil_tofu_mapof_create_as(other, other->arena);
     if (!map) return NULL;
 
-    fossil_tofu_mapof_node_t* current = other->head;
-    while (current) {
+    for (size_t i = 0; i < other->capacity; i++) {
+        const fossil_tofu_mapof_entry_t* entry = &other->entries[i];
+        if (entry->distance == 0) continue;
         // Check type match for key and value
-        if (fossil_tofu_get_type(&current->key) != fossil_tofu_validate_type(map->key_type) ||
-            fossil_tofu_get_type(&current->value) != fossil_tofu_validate_type(map->value_type)) {
+        if (fossil_tofu_get_type(&entry->key) != map->key_type_enum ||
+            fossil_tofu_get_type(&entry->value) != map->value_type_enum) {
             fossil_tofu_mapof_destroy(map);
             return NULL;
         }
-        fossil_tofu_mapof_insert(map, fossil_tofu_get_value(&current->key), fossil_tofu_get_value(&current->value));
-        current = current->next;
+        fossil_tofu_mapof_insert(map, fossil_tofu_get_value(&entry->key), fossil_tofu_get_value(&entry->value));
     }
     return map;
 }
@@ -70,41 +163,61 @@ fossil_tofu_mapof_t* fossil_tofu_mapof_create_copy(const fossil_tofu_mapof_t* ot
 fossil_tofu_mapof_t* fossil_tofu_mapof_create_move(fossil_tofu_mapof_t* other) {
     if (!other) return NULL;
 
-    fossil_tofu_mapof_t* map = fossil_tofu_mapof_create_container(other->key_type, other->value_type);
+    fossil_tofu_mapof_t* map = fossil_tofu_mapof_create_as(other, other->arena);
     if (!map) return NULL;
 
-    map->head = other->head;
+    map->entries = other->entries;
+    map->capacity = other->capacity;
     map->size = other->size;
-    other->head = NULL;
+    other->entries = NULL;
+    other->capacity = 0;
     other->size = 0;
 
     return map;
 }
 
 void fossil_tofu_mapof_destroy(fossil_tofu_mapof_t* map) {
-    if (!map) return;
-
-    while (map->head) {
-        fossil_tofu_mapof_node_t* temp = map->head;
-        map->head = map->head->next;
-        fossil_tofu_destroy(&temp->key);
-        fossil_tofu_destroy(&temp->value);
-        fossil_tofu_free(temp);
-    }
+    // Arena-backed maps are released together with their arena
+    if (!map || map->arena) return;
 
+    for (size_t i = 0; i < map->capacity; i++) {
+        if (map->entries[i].distance != 0) {
+            fossil_tofu_destroy(&map->entries[i].key);
+            fossil_tofu_destroy(&map->entries[i].value);
+        }
+    }
+    fossil_tofu_free(map->entries);
     fossil_tofu_free(map);
 }
 
 int32_t fossil_tofu_mapof_insert(fossil_tofu_mapof_t* map, char *key, char *value) {
     if (!map || !key || !value) return FOSSIL_TOFU_FAILURE;
 
-    fossil_tofu_mapof_node_t* node = (fossil_tofu_mapof_node_t*)fossil_tofu_alloc(sizeof(fossil_tofu_mapof_node_t));
-    if (!node) return FOSSIL_TOFU_FAILURE;
+    fossil_tofu_t view = fossil_tofu_view_typed(map->key_type_enum, key);
+    size_t index = fossil_tofu_mapof_find(map, &view);
+
+    fossil_tofu_arena_enter(map->arena);
+    // An existing key keeps its slot and takes the new value
+    if (index != FOSSIL_TOFU_MAPOF_NOT_FOUND) {
+        fossil_tofu_destroy(&map->entries[index].value);
+        map->entries[index].value = fossil_tofu_create_typed(map->value_type_enum, value);
+        fossil_tofu_arena_leave(map->arena);
+        return FOSSIL_TOFU_SUCCESS;
+    }
 
-    node->key = fossil_tofu_create(map->key_type, key);
-    node->value = fossil_tofu_create(map->value_type, value);
-    node->next = map->head;
-    map->head = node;
+    if ((map->size + 1) * FOSSIL_TOFU_MAPOF_LOAD_DEN > map->capacity * FOSSIL_TOFU_MAPOF_LOAD_NUM) {
+        size_t capacity = map->capacity ? map->capacity * 2 : FOSSIL_TOFU_MAPOF_MIN_CAPACITY;
+        if (!fossil_tofu_mapof_resize(map, capacity)) {
+            fossil_tofu_arena_leave(map->arena);
+            return FOSSIL_TOFU_FAILURE;
+        }
+    }
+
+    fossil_tofu_mapof_entry_t entry;
+    entry.key = fossil_tofu_create_typed(map->key_type_enum, key);
+    entry.value = fossil_tofu_create_typed(map->value_type_enum, value);
+    fossil_tofu_mapof_place(map, entry);
+    fossil_tofu_arena_leave(map->arena);
     map->size++;
 
     return FOSSIL_TOFU_SUCCESS;
@@ -113,69 +226,61 @@ int32_t fossil_tofu_mapof_insert(fossil_tofu_mapof_t* map, char *key, char *valu
 int32_t fossil_tofu_mapof_remove(fossil_tofu_mapof_t* map, char *key) {
     if (!map || !key) return FOSSIL_TOFU_FAILURE;
 
-    fossil_tofu_t temp_data = fossil_tofu_create(map->key_type, key);
-
-    fossil_tofu_mapof_node_t** current = &map->head;
-    while (*current) {
-        if (fossil_tofu_compare(&(*current)->key, &temp_data) == 0) {
-            fossil_tofu_mapof_node_t* temp = *current;
-            *current = (*current)->next;
-            fossil_tofu_destroy(&temp->key);
-            fossil_tofu_destroy(&temp->value);
-            fossil_tofu_free(temp);
-            map->size--;
-            return FOSSIL_TOFU_SUCCESS;
-        }
-        current = &(*current)->next;
+    fossil_tofu_t view = fossil_tofu_view_typed(map->key_type_enum, key);
+    size_t index = fossil_tofu_mapof_find(map, &view);
+    if (index == FOSSIL_TOFU_MAPOF_NOT_FOUND) return FOSSIL_TOFU_FAILURE;
+
+    fossil_tofu_arena_enter(map->arena);
+    fossil_tofu_destroy(&map->entries[index].key);
+    fossil_tofu_destroy(&map->entries[index].value);
+    fossil_tofu_arena_leave(map->arena);
+
+    // Backward-shift deletion: pull the following displaced entries one slot
+    // closer to home, so no tombstones are left behind
+    size_t mask = map->capacity - 1;
+    size_t next = (index + 1) & mask;
+    while (map->entries[next].distance > 1) {
+        map->entries[index] = map->entries[next];
+        map->entries[index].distance--;
+        index = next;
+        next = (next + 1) & mask;
     }
-    return FOSSIL_TOFU_FAILURE;
+    map->entries[index].distance = 0;
+    map->size--;
+    return FOSSIL_TOFU_SUCCESS;
 }
 
 bool fossil_tofu_mapof_contains(const fossil_tofu_mapof_t* map, char *key) {
     if (!map || !key) return false;
 
-    fossil_tofu_t temp_data = fossil_tofu_create(map->key_type, key);
-
-    fossil_tofu_mapof_node_t* current = map->head;
-    while (current) {
-        if (fossil_tofu_compare(&current->key, &temp_data) == 0) {
-            return true;
-        }
-        current = current->next;
-    }
-    return false;
+    fossil_tofu_t view = fossil_tofu_view_typed(map->key_type_enum, key);
+    size_t index = fossil_tofu_mapof_find(map, &view);
+    return index != FOSSIL_TOFU_MAPOF_NOT_FOUND;
 }
 
 fossil_tofu_t fossil_tofu_mapof_get(const fossil_tofu_mapof_t* map, char *key) {
-    if (!map || !key) return fossil_tofu_create(map->value_type, NULL);
+    if (!map || !key) return (fossil_tofu_t){0};
 
-    fossil_tofu_t temp_data = fossil_tofu_create(map->key_type, key);
-
-    fossil_tofu_mapof_node_t* current = map->head;
-    while (current) {
-        if (fossil_tofu_compare(&current->key, &temp_data) == 0) {
-            return current->value;
-        }
-        current = current->next;
+    fossil_tofu_t view = fossil_tofu_view_typed(map->key_type_enum, key);
+    size_t index = fossil_tofu_mapof_find(map, &view);
+    if (index != FOSSIL_TOFU_MAPOF_NOT_FOUND) {
+        return map->entries[index].value;
     }
-    return fossil_tofu_create(map->value_type, NULL);
+    return (fossil_tofu_t){0};
 }
 
 int32_t fossil_tofu_mapof_set(fossil_tofu_mapof_t* map, char *key, char *value) {
     if (!map || !key || !value) return FOSSIL_TOFU_FAILURE;
 
-    fossil_tofu_t temp_data = fossil_tofu_create(map->key_type, key);
+    fossil_tofu_t view = fossil_tofu_view_typed(map->key_type_enum, key);
+    size_t index = fossil_tofu_mapof_find(map, &view);
+    if (index == FOSSIL_TOFU_MAPOF_NOT_FOUND) return FOSSIL_TOFU_FAILURE;
 
-    fossil_tofu_mapof_node_t* current = map->head;
-    while (current) {
-        if (fossil_tofu_compare(&current->key, &temp_data) == 0) {
-            fossil_tofu_destroy(&current->value);
-            current->value = fossil_tofu_create(map->value_type, value);
-            return FOSSIL_TOFU_SUCCESS;
-        }
-        current = current->next;
-    }
-    return FOSSIL_TOFU_FAILURE;
+    fossil_tofu_arena_enter(map->arena);
+    fossil_tofu_destroy(&map->entries[index].value);
+    map->entries[index].value = fossil_tofu_create_typed(map->value_type_enum, value);
+    fossil_tofu_arena_leave(map->arena);
+    return FOSSIL_TOFU_SUCCESS;
 }
 
 size_t fossil_tofu_mapof_size(const fossil_tofu_mapof_t* map) {
@@ -183,9 +288,9 @@ size_t fossil_tofu_mapof_size(const fossil_tofu_mapof_t* map) {
 }
 
 bool fossil_tofu_mapof_not_empty(const fossil_tofu_mapof_t* map) {
-    return map && map->head != NULL;
+    return map && map->size != 0;
 }
 
 bool fossil_tofu_mapof_is_empty(const fossil_tofu_mapof_t* map) {
-    return !map || map->head == NULL;
+    return !map || map->size == 0;
 }
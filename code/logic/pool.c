@@ -0,0 +1,109 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/tofu/pool.h"
+
+#define FOSSIL_TOFU_POOL_ALIGN _Alignof(max_align_t)
+#define FOSSIL_TOFU_POOL_ROUND(n) (((n) + FOSSIL_TOFU_POOL_ALIGN - 1) & ~(size_t)(FOSSIL_TOFU_POOL_ALIGN - 1))
+#define FOSSIL_TOFU_POOL_SLAB_HEADER FOSSIL_TOFU_POOL_ROUND(sizeof(fossil_tofu_pool_slab_t))
+
+// *****************************************************************************
+// Function definitions
+// *****************************************************************************
+
+void fossil_tofu_pool_init(fossil_tofu_pool_t* pool, size_t object_size) {
+    if (pool == NULL) {
+        return;
+    }
+    // Free objects store the list link in place, so they must hold a pointer
+    if (object_size < sizeof(void*)) {
+        object_size = sizeof(void*);
+    }
+    pool->object_size = FOSSIL_TOFU_POOL_ROUND(object_size);
+    pool->slab_objects = FOSSIL_TOFU_POOL_FIRST_SLAB;
+    pool->free_list = NULL;
+    pool->bump = NULL;
+    pool->bump_end = NULL;
+    pool->slabs = NULL;
+}
+
+tofu_memory_t fossil_tofu_pool_acquire(fossil_tofu_pool_t* pool) {
+    if (pool == NULL) {
+        return NULL;
+    }
+    if (pool->free_list != NULL) {
+        void* object = pool->free_list;
+        memcpy(&pool->free_list, object, sizeof(void*));
+        return object;
+    }
+    if (pool->bump == pool->bump_end) {
+        // Slabs grow geometrically so small containers stay small
+        size_t count = pool->slab_objects;
+        fossil_tofu_pool_slab_t* slab = (fossil_tofu_pool_slab_t*)fossil_tofu_alloc(
+            FOSSIL_TOFU_POOL_SLAB_HEADER + count * pool->object_size);
+        if (slab == NULL) {
+            return NULL;
+        }
+        slab->next = pool->slabs;
+        pool->slabs = slab;
+        pool->bump = (unsigned char*)slab + FOSSIL_TOFU_POOL_SLAB_HEADER;
+        pool->bump_end = pool->bump + count * pool->object_size;
+        if (count < FOSSIL_TOFU_POOL_MAX_SLAB) {
+            pool->slab_objects = count * 2;
+        }
+    }
+    void* object = pool->bump;
+    pool->bump += pool->object_size;
+    return object;
+}
+
+void fossil_tofu_pool_release(fossil_tofu_pool_t* pool, tofu_memory_t object) {
+    if (pool == NULL || object == NULL) {
+        return;
+    }
+    memcpy(object, &pool->free_list, sizeof(void*));
+    pool->free_list = object;
+}
+
+void fossil_tofu_pool_clear(fossil_tofu_pool_t* pool) {
+    if (pool == NULL) {
+        return;
+    }
+    fossil_tofu_pool_slab_t* slab = pool->slabs;
+    while (slab != NULL) {
+        fossil_tofu_pool_slab_t* next = slab->next;
+        fossil_tofu_free(slab);
+        slab = next;
+    }
+    fossil_tofu_pool_init(pool, pool->object_size);
+}
+
+void fossil_tofu_pool_move(fossil_tofu_pool_t* dest, fossil_tofu_pool_t* src) {
+    if (dest == NULL || src == NULL || dest == src) {
+        return;
+    }
+    fossil_tofu_pool_clear(dest);
+    *dest = *src;
+    fossil_tofu_pool_init(src, src->object_size);
+}
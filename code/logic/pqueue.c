@@ -24,24 +24,195 @@
  */
 #include "fossil/tofu/pqueue.h"
 
+#define FOSSIL_TOFU_PQUEUE_NO_SLOT SIZE_MAX
+
 // *****************************************************************************
-// Function prototypes
+// Heap helpers
 // *****************************************************************************
 
-fossil_tofu_pqueue_t* fossil_tofu_pqueue_create_container(char* type) {
-    fossil_tofu_type_t t = fossil_tofu_validate_type(type);
-    if (t == FOSSIL_TOFU_TYPE_CNULL) {
-        return NULL;
+// Stores `node` at heap index `pos` and records the position in its slot.
+static inline void fossil_tofu_pqueue_put(fossil_tofu_pqueue_t* pqueue, size_t pos, fossil_tofu_pqueue_node_t node) {
+    pqueue->heap[pos] = node;
+    pqueue->slots[node.slot].position = pos;
+}
+
+// Moves the entry at `pos` towards the root. The entry is held aside and
+// parents are shifted down into the hole, so each level costs one store.
+static void fossil_tofu_pqueue_sift_up(fossil_tofu_pqueue_t* pqueue, size_t pos) {
+    fossil_tofu_pqueue_node_t node = pqueue->heap[pos];
+    while (pos > 0) {
+        size_t parent = (pos - 1) / FOSSIL_TOFU_PQUEUE_ARITY;
+        if (pqueue->heap[parent].priority <= node.priority) {
+            break;
+        }
+        fossil_tofu_pqueue_put(pqueue, pos, pqueue->heap[parent]);
+        pos = parent;
+    }
+    fossil_tofu_pqueue_put(pqueue, pos, node);
+}
+
+// Moves the entry at `pos` towards the leaves, following the smallest child.
+static void fossil_tofu_pqueue_sift_down(fossil_tofu_pqueue_t* pqueue, size_t pos) {
+    fossil_tofu_pqueue_node_t node = pqueue->heap[pos];
+    for (;;) {
+        size_t first = pos * FOSSIL_TOFU_PQUEUE_ARITY + 1;
+        if (first >= pqueue->size) {
+            break;
+        }
+        size_t last = first + FOSSIL_TOFU_PQUEUE_ARITY;
+        if (last > pqueue->size) {
+            last = pqueue->size;
+        }
+        size_t best = first;
+        for (size_t child = first + 1; child < last; child++) {
+            if (pqueue->heap[child].priority < pqueue->heap[best].priority) {
+                best = child;
+            }
+        }
+        if (pqueue->heap[best].priority >= node.priority) {
+            break;
+        }
+        fossil_tofu_pqueue_put(pqueue, pos, pqueue->heap[best]);
+        pos = best;
+    }
+    fossil_tofu_pqueue_put(pqueue, pos, node);
+}
+
+// Grows `heap` and `slots` so that `count` elements fit.
+static bool fossil_tofu_pqueue_reserve(fossil_tofu_pqueue_t* pqueue, size_t count) {
+    if (count <= pqueue->capacity) {
+        return true;
+    }
+    size_t capacity = pqueue->capacity ? pqueue->capacity : FOSSIL_TOFU_PQUEUE_MIN_CAPACITY;
+    while (capacity < count) {
+        capacity *= 2;
+    }
+    fossil_tofu_pqueue_node_t* heap = (fossil_tofu_pqueue_node_t*)fossil_tofu_realloc(pqueue->heap, capacity * sizeof(fossil_tofu_pqueue_node_t));
+    if (heap == NULL) {
+        return false;
+    }
+    pqueue->heap = heap;
+    fossil_tofu_pqueue_slot_t* slots = (fossil_tofu_pqueue_slot_t*)fossil_tofu_realloc(pqueue->slots, capacity * sizeof(fossil_tofu_pqueue_slot_t));
+    if (slots == NULL) {
+        return false;
+    }
+    pqueue->slots = slots;
+    pqueue->capacity = capacity;
+    return true;
+}
+
+// Takes a slot for a new element, reusing freed ones first.
+static uint32_t fossil_tofu_pqueue_acquire_slot(fossil_tofu_pqueue_t* pqueue) {
+    size_t slot = pqueue->free_slot;
+    if (slot != FOSSIL_TOFU_PQUEUE_NO_SLOT) {
+        pqueue->free_slot = pqueue->slots[slot].position;
+    } else {
+        slot = pqueue->slot_count++;
+        pqueue->slots[slot].generation = pqueue->fresh_generation;
+    }
+    return (uint32_t)slot;
+}
+
+// Returns the heap index of the element behind `handle`, or SIZE_MAX if it is stale.
+static size_t fossil_tofu_pqueue_resolve(const fossil_tofu_pqueue_t* pqueue, fossil_tofu_pqueue_handle_t handle) {
+    if (pqueue == NULL) {
+        return SIZE_MAX;
+    }
+    size_t slot = (size_t)(handle & UINT32_MAX);
+    if (slot >= pqueue->slot_count || pqueue->slots[slot].generation != (uint32_t)(handle >> 32)) {
+        return SIZE_MAX;
     }
+    // Free slots have moved on to a newer generation, so this one is live
+    return pqueue->slots[slot].position;
+}
+
+// Destroys the element at heap index `pos` and closes the gap it leaves.
+static void fossil_tofu_pqueue_remove_at(fossil_tofu_pqueue_t* pqueue, size_t pos) {
+    uint32_t slot = pqueue->heap[pos].slot;
+    fossil_tofu_destroy(&pqueue->slots[slot].data);
+    pqueue->slots[slot].position = pqueue->free_slot;
+    pqueue->slots[slot].generation++;
+    pqueue->free_slot = slot;
+
+    pqueue->size--;
+    if (pos == pqueue->size) {
+        return;
+    }
+    // The last entry fills the hole and may need to move either way
+    fossil_tofu_pqueue_put(pqueue, pos, pqueue->heap[pqueue->size]);
+    if (pos > 0 && pqueue->heap[pos].priority < pqueue->heap[(pos - 1) / FOSSIL_TOFU_PQUEUE_ARITY].priority) {
+        fossil_tofu_pqueue_sift_up(pqueue, pos);
+    } else {
+        fossil_tofu_pqueue_sift_down(pqueue, pos);
+    }
+}
+
+// Returns the heap index of an element with `priority`, or SIZE_MAX.
+static size_t fossil_tofu_pqueue_find(const fossil_tofu_pqueue_t* pqueue, int32_t priority) {
+    for (size_t i = 0; i < pqueue->size; i++) {
+        if (pqueue->heap[i].priority == priority) {
+            return i;
+        }
+    }
+    return SIZE_MAX;
+}
+
+// Returns the heap index of the element with the largest priority number.
+static size_t fossil_tofu_pqueue_find_back(const fossil_tofu_pqueue_t* pqueue) {
+    // The largest entry is always a leaf, and leaves start after the last parent
+    size_t back = pqueue->size > 1 ? (pqueue->size - 2) / FOSSIL_TOFU_PQUEUE_ARITY + 1 : 0;
+    for (size_t i = back + 1; i < pqueue->size; i++) {
+        if (pqueue->heap[i].priority > pqueue->heap[back].priority) {
+            back = i;
+        }
+    }
+    return back;
+}
+
+// Floyd's construction: sift every parent down, starting from the last one.
+static void fossil_tofu_pqueue_build(fossil_tofu_pqueue_t* pqueue) {
+    if (pqueue->size > 1) {
+        for (size_t pos = (pqueue->size - 2) / FOSSIL_TOFU_PQUEUE_ARITY + 1; pos-- > 0;) {
+            fossil_tofu_pqueue_sift_down(pqueue, pos);
+        }
+    }
+}
+
+static fossil_tofu_t* fossil_tofu_pqueue_data_at(const fossil_tofu_pqueue_t* pqueue, size_t pos) {
+    return &pqueue->slots[pqueue->heap[pos].slot].data;
+}
+
+// *****************************************************************************
+// Function prototypes
+// *****************************************************************************
+
+// Creates an empty queue with an already resolved type, so copies never
+// re-parse a type string the source queue may no longer own.
+static fossil_tofu_pqueue_t* fossil_tofu_pqueue_create_as(char* type, fossil_tofu_type_t t) {
     fossil_tofu_pqueue_t* pqueue = (fossil_tofu_pqueue_t*)fossil_tofu_alloc(sizeof(fossil_tofu_pqueue_t));
     if (pqueue == NULL) {
         return NULL;
     }
     pqueue->type = type;
-    pqueue->front = NULL;
+    pqueue->type_enum = t;
+    pqueue->heap = NULL;
+    pqueue->slots = NULL;
+    pqueue->size = 0;
+    pqueue->capacity = 0;
+    pqueue->slot_count = 0;
+    pqueue->free_slot = FOSSIL_TOFU_PQUEUE_NO_SLOT;
+    pqueue->fresh_generation = 0;
     return pqueue;
 }
 
+fossil_tofu_pqueue_t* fossil_tofu_pqueue_create_container(char* type) {
+    fossil_tofu_type_t t = fossil_tofu_validate_type(type);
+    if (t == FOSSIL_TOFU_TYPE_CNULL) {
+        return NULL;
+    }
+    return fossil_tofu_pqueue_create_as(type, t);
+}
+
 fossil_tofu_pqueue_t* fossil_tofu_pqueue_create_default(void) {
     return fossil_tofu_pqueue_create_container("any");
 }
@@ -50,27 +221,29 @@ fossil_tofu_pqueue_t* fossil_tofu_pqueue_create_copy(const fossil_tofu_pqueue_t*
     if (other == NULL) {
         return NULL;
     }
-    fossil_tofu_pqueue_t* pqueue = (fossil_tofu_pqueue_t*)fossil_tofu_alloc(sizeof(fossil_tofu_pqueue_t));
+    fossil_tofu_pqueue_t* pqueue = fossil_tofu_pqueue_create_as(other->type, other->type_enum);
     if (pqueue == NULL) {
         return NULL;
     }
-    pqueue->type = other->type;
-    pqueue->front = NULL;
-    fossil_tofu_type_t t1 = fossil_tofu_validate_type(pqueue->type);
-    fossil_tofu_type_t t2 = fossil_tofu_validate_type(other->type);
-    if (t1 != t2) {
-        fossil_tofu_free(pqueue);
+    if (!fossil_tofu_pqueue_reserve(pqueue, other->size)) {
+        fossil_tofu_pqueue_destroy(pqueue);
         return NULL;
     }
-    fossil_tofu_pqueue_node_t* current = other->front;
-    while (current != NULL) {
-        fossil_tofu_type_t node_type = fossil_tofu_get_type(&current->data);
-        if (node_type != t1 && t1 != FOSSIL_TOFU_TYPE_CNULL) {
+    // Same priorities at the same heap positions, with the slots packed
+    for (size_t i = 0; i < other->size; i++) {
+        fossil_tofu_pqueue_slot_t* slot = &pqueue->slots[i];
+        memset(&slot->data, 0, sizeof(slot->data));
+        if (fossil_tofu_copy(&slot->data, fossil_tofu_pqueue_data_at(other, i)) != FOSSIL_TOFU_SUCCESS) {
+            fossil_tofu_destroy(&slot->data);
             fossil_tofu_pqueue_destroy(pqueue);
             return NULL;
         }
-        fossil_tofu_pqueue_insert(pqueue, current->data.value.data, current->priority);
-        current = current->next;
+        pqueue->heap[i].priority = other->heap[i].priority;
+        pqueue->heap[i].slot = (uint32_t)i;
+        slot->position = i;
+        slot->generation = 0;
+        pqueue->size = i + 1;
+        pqueue->slot_count = i + 1;
     }
     return pqueue;
 }
@@ -79,17 +252,30 @@ fossil_tofu_pqueue_t* fossil_tofu_pqueue_create_move(fossil_tofu_pqueue_t* other
     if (other == NULL) {
         return NULL;
     }
-    fossil_tofu_type_t t = fossil_tofu_validate_type(other->type);
-    if (t == FOSSIL_TOFU_TYPE_CNULL) {
+    if (other->type_enum == FOSSIL_TOFU_TYPE_CNULL) {
         return NULL;
     }
     fossil_tofu_pqueue_t* pqueue = (fossil_tofu_pqueue_t*)fossil_tofu_alloc(sizeof(fossil_tofu_pqueue_t));
     if (pqueue == NULL) {
         return NULL;
     }
-    pqueue->type = other->type;
-    pqueue->front = other->front;
-    other->front = NULL;
+    *pqueue = *other;
+    // The moved slots keep their generations, so handles now resolve on the
+    // new queue; the old one must start past all of them or a later insert
+    // there would bring a moved handle back to life
+    uint32_t newest = other->fresh_generation;
+    for (size_t i = 0; i < other->slot_count; i++) {
+        if (other->slots[i].generation > newest) {
+            newest = other->slots[i].generation;
+        }
+    }
+    other->fresh_generation = newest + 1;
+    other->heap = NULL;
+    other->slots = NULL;
+    other->size = 0;
+    other->capacity = 0;
+    other->slot_count = 0;
+    other->free_slot = FOSSIL_TOFU_PQUEUE_NO_SLOT;
     return pqueue;
 }
 
@@ -97,12 +283,11 @@ void fossil_tofu_pqueue_destroy(fossil_tofu_pqueue_t* pqueue) {
     if (pqueue == NULL) {
         return;
     }
-    while (pqueue->front != NULL) {
-        fossil_tofu_pqueue_node_t* temp = pqueue->front;
-        pqueue->front = pqueue->front->next;
-        fossil_tofu_destroy(&temp->data);
-        fossil_tofu_free(temp);
+    for (size_t i = 0; i < pqueue->size; i++) {
+        fossil_tofu_destroy(fossil_tofu_pqueue_data_at(pqueue, i));
     }
+    fossil_tofu_free(pqueue->heap);
+    fossil_tofu_free(pqueue->slots);
     fossil_tofu_free(pqueue);
 }
 
@@ -111,71 +296,186 @@ void fossil_tofu_pqueue_destroy(fossil_tofu_pqueue_t* pqueue) {
 // *****************************************************************************
 
 int32_t fossil_tofu_pqueue_insert(fossil_tofu_pqueue_t* pqueue, char *data, int32_t priority) {
-    if (pqueue == NULL) {
+    return fossil_tofu_pqueue_insert_handle(pqueue, data, priority) == FOSSIL_TOFU_PQUEUE_INVALID_HANDLE
+        ? FOSSIL_TOFU_FAILURE : FOSSIL_TOFU_SUCCESS;
+}
+
+fossil_tofu_pqueue_handle_t fossil_tofu_pqueue_insert_handle(fossil_tofu_pqueue_t* pqueue, char *data, int32_t priority) {
+    if (pqueue == NULL || data == NULL) {
+        return FOSSIL_TOFU_PQUEUE_INVALID_HANDLE;
+    }
+    if (pqueue->size >= UINT32_MAX || !fossil_tofu_pqueue_reserve(pqueue, pqueue->size + 1)) {
+        return FOSSIL_TOFU_PQUEUE_INVALID_HANDLE;
+    }
+    uint32_t slot = fossil_tofu_pqueue_acquire_slot(pqueue);
+    pqueue->slots[slot].data = fossil_tofu_create_typed(pqueue->type_enum, data);
+    pqueue->heap[pqueue->size].priority = priority;
+    pqueue->heap[pqueue->size].slot = slot;
+    pqueue->size++;
+    fossil_tofu_pqueue_sift_up(pqueue, pqueue->size - 1);
+    return ((fossil_tofu_pqueue_handle_t)pqueue->slots[slot].generation << 32) | slot;
+}
+
+int32_t fossil_tofu_pqueue_update_priority(fossil_tofu_pqueue_t* pqueue, fossil_tofu_pqueue_handle_t handle, int32_t priority) {
+    size_t pos = fossil_tofu_pqueue_resolve(pqueue, handle);
+    if (pos == SIZE_MAX) {
         return FOSSIL_TOFU_FAILURE;
     }
-    fossil_tofu_pqueue_node_t* node = (fossil_tofu_pqueue_node_t*)fossil_tofu_alloc(sizeof(fossil_tofu_pqueue_node_t));
-    if (node == NULL) {
+    int32_t previous = pqueue->heap[pos].priority;
+    pqueue->heap[pos].priority = priority;
+    if (priority < previous) {
+        fossil_tofu_pqueue_sift_up(pqueue, pos);
+    } else if (priority > previous) {
+        fossil_tofu_pqueue_sift_down(pqueue, pos);
+    }
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_pqueue_remove_handle(fossil_tofu_pqueue_t* pqueue, fossil_tofu_pqueue_handle_t handle) {
+    size_t pos = fossil_tofu_pqueue_resolve(pqueue, handle);
+    if (pos == SIZE_MAX) {
         return FOSSIL_TOFU_FAILURE;
     }
-    node->data = fossil_tofu_create(pqueue->type, data);
-    node->priority = priority;
-    node->next = NULL;
-    if (pqueue->front == NULL) {
-        pqueue->front = node;
-    } else {
-        fossil_tofu_pqueue_node_t* current = pqueue->front;
-        fossil_tofu_pqueue_node_t* prev = NULL;
-        while (current != NULL && current->priority < priority) {
-            prev = current;
-            current = current->next;
+    fossil_tofu_pqueue_remove_at(pqueue, pos);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+char *fossil_tofu_pqueue_get_handle(const fossil_tofu_pqueue_t* pqueue, fossil_tofu_pqueue_handle_t handle) {
+    size_t pos = fossil_tofu_pqueue_resolve(pqueue, handle);
+    return pos == SIZE_MAX ? NULL : fossil_tofu_get_value(fossil_tofu_pqueue_data_at(pqueue, pos));
+}
+
+int32_t fossil_tofu_pqueue_heapify(fossil_tofu_pqueue_t* pqueue, char **data, const int32_t *priorities, size_t count) {
+    if (pqueue == NULL || data == NULL || priorities == NULL) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    if (count == 0) {
+        return FOSSIL_TOFU_SUCCESS;
+    }
+    if (!fossil_tofu_pqueue_reserve(pqueue, pqueue->size + count)) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    fossil_tofu_t* batch = (fossil_tofu_t*)fossil_tofu_alloc(count * sizeof(fossil_tofu_t));
+    if (batch == NULL) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    if (fossil_tofu_create_batch(pqueue->type_enum, (const char *const *)data, count, batch) != FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_free(batch);
+        return FOSSIL_TOFU_FAILURE;
+    }
+    for (size_t i = 0; i < count; i++) {
+        uint32_t slot = fossil_tofu_pqueue_acquire_slot(pqueue);
+        pqueue->slots[slot].data = batch[i];
+        pqueue->heap[pqueue->size].priority = priorities[i];
+        pqueue->heap[pqueue->size].slot = slot;
+        pqueue->slots[slot].position = pqueue->size;
+        pqueue->size++;
+    }
+    fossil_tofu_free(batch);
+    fossil_tofu_pqueue_build(pqueue);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_pqueue_merge(fossil_tofu_pqueue_t* dest, fossil_tofu_pqueue_t* src) {
+    if (dest == NULL || src == NULL || dest == src || dest->type_enum != src->type_enum) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    if (src->size == 0) {
+        return FOSSIL_TOFU_SUCCESS;
+    }
+    if (dest->slot_count == 0) {
+        // dest has never issued a handle, so it can take src's arrays whole.
+        // Every slot moves on a generation so src's handles go stale here,
+        // and src's future slots start past all of them.
+        uint32_t newest = src->fresh_generation;
+        for (size_t i = 0; i < src->slot_count; i++) {
+            src->slots[i].generation++;
+            if (src->slots[i].generation > newest) {
+                newest = src->slots[i].generation;
+            }
         }
-        if (prev == NULL) {
-            node->next = pqueue->front;
-            pqueue->front = node;
-        } else {
-            prev->next = node;
-            node->next = current;
+        fossil_tofu_free(dest->heap);
+        fossil_tofu_free(dest->slots);
+        dest->heap = src->heap;
+        dest->slots = src->slots;
+        dest->size = src->size;
+        dest->capacity = src->capacity;
+        dest->slot_count = src->slot_count;
+        dest->free_slot = src->free_slot;
+        dest->fresh_generation = newest;
+        src->fresh_generation = newest;
+        src->heap = NULL;
+        src->slots = NULL;
+        src->size = 0;
+        src->capacity = 0;
+        src->slot_count = 0;
+        src->free_slot = FOSSIL_TOFU_PQUEUE_NO_SLOT;
+        return FOSSIL_TOFU_SUCCESS;
+    }
+    if (!fossil_tofu_pqueue_reserve(dest, dest->size + src->size)) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+
+    // Sifting each appended entry up costs about m * depth, rebuilding the
+    // whole heap about n + m; pick whichever is cheaper
+    size_t appended = src->size;
+    size_t total = dest->size + appended;
+    size_t depth = 1;
+    for (size_t level = total; level >= FOSSIL_TOFU_PQUEUE_ARITY; level /= FOSSIL_TOFU_PQUEUE_ARITY) {
+        depth++;
+    }
+    bool rebuild = appended * depth >= total;
+
+    for (size_t i = 0; i < appended; i++) {
+        uint32_t from = src->heap[i].slot;
+        uint32_t slot = fossil_tofu_pqueue_acquire_slot(dest);
+        dest->slots[slot].data = src->slots[from].data;
+        dest->heap[dest->size].priority = src->heap[i].priority;
+        dest->heap[dest->size].slot = slot;
+        dest->slots[slot].position = dest->size;
+        dest->size++;
+        if (!rebuild) {
+            fossil_tofu_pqueue_sift_up(dest, dest->size - 1);
         }
+
+        // The element now lives in dest; retire its old slot so src's handles go stale
+        src->slots[from].position = src->free_slot;
+        src->slots[from].generation++;
+        src->free_slot = from;
+    }
+    src->size = 0;
+    if (rebuild) {
+        fossil_tofu_pqueue_build(dest);
     }
     return FOSSIL_TOFU_SUCCESS;
 }
 
 int32_t fossil_tofu_pqueue_remove(fossil_tofu_pqueue_t* pqueue, int32_t priority) {
-    if (pqueue == NULL || pqueue->front == NULL) {
+    if (pqueue == NULL || pqueue->size == 0) {
         return FOSSIL_TOFU_FAILURE;
     }
-    fossil_tofu_pqueue_node_t* current = pqueue->front;
-    fossil_tofu_pqueue_node_t* prev = NULL;
-    while (current != NULL && current->priority != priority) {
-        prev = current;
-        current = current->next;
-    }
-    if (current == NULL) {
+    size_t pos = fossil_tofu_pqueue_find(pqueue, priority);
+    if (pos == SIZE_MAX) {
         return FOSSIL_TOFU_FAILURE; // Node with the given priority not found
     }
-    if (prev == NULL) {
-        pqueue->front = current->next;
-    } else {
-        prev->next = current->next;
+    fossil_tofu_pqueue_remove_at(pqueue, pos);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_pqueue_pop(fossil_tofu_pqueue_t* pqueue) {
+    if (pqueue == NULL || pqueue->size == 0) {
+        return FOSSIL_TOFU_FAILURE;
     }
-    fossil_tofu_destroy(&current->data);
-    fossil_tofu_free(current);
+    fossil_tofu_pqueue_remove_at(pqueue, 0);
     return FOSSIL_TOFU_SUCCESS;
 }
 
 size_t fossil_tofu_pqueue_size(const fossil_tofu_pqueue_t* pqueue) {
-    size_t size = 0;
-    fossil_tofu_pqueue_node_t* current = pqueue->front;
-    while (current != NULL) {
-        size++;
-        current = current->next;
-    }
-    return size;
+    return pqueue == NULL ? 0 : pqueue->size;
 }
 
 bool fossil_tofu_pqueue_not_empty(const fossil_tofu_pqueue_t* pqueue) {
-    return pqueue != NULL && pqueue->front != NULL;
+    return pqueue != NULL && pqueue->size != 0;
 }
 
 bool fossil_tofu_pqueue_not_cnullptr(const fossil_tofu_pqueue_t* pqueue) {
@@ -183,7 +483,7 @@ bool fossil_tofu_pqueue_not_cnullptr(const fossil_tofu_pqueue_t* pqueue) {
 }
 
 bool fossil_tofu_pqueue_is_empty(const fossil_tofu_pqueue_t* pqueue) {
-    return pqueue == NULL || pqueue->front == NULL;
+    return pqueue == NULL || pqueue->size == 0;
 }
 
 bool fossil_tofu_pqueue_is_cnullptr(const fossil_tofu_pqueue_t* pqueue) {
@@ -195,58 +495,44 @@ bool fossil_tofu_pqueue_is_cnullptr(const fossil_tofu_pqueue_t* pqueue) {
 // *****************************************************************************
 
 char *fossil_tofu_pqueue_get_front(const fossil_tofu_pqueue_t* pqueue) {
-    return pqueue == NULL || pqueue->front == NULL ? NULL : pqueue->front->data.value.data;
+    return pqueue == NULL || pqueue->size == 0 ? NULL : fossil_tofu_get_value(fossil_tofu_pqueue_data_at(pqueue, 0));
 }
 
 char *fossil_tofu_pqueue_get_back(const fossil_tofu_pqueue_t* pqueue) {
-    if (pqueue == NULL || pqueue->front == NULL) {
+    if (pqueue == NULL || pqueue->size == 0) {
         return NULL;
     }
-    fossil_tofu_pqueue_node_t* current = pqueue->front;
-    while (current->next != NULL) {
-        current = current->next;
-    }
-    return current->data.value.data;
+    return fossil_tofu_get_value(fossil_tofu_pqueue_data_at(pqueue, fossil_tofu_pqueue_find_back(pqueue)));
 }
 
 char *fossil_tofu_pqueue_get_at(const fossil_tofu_pqueue_t* pqueue, int32_t priority) {
-    if (pqueue == NULL || pqueue->front == NULL) {
+    if (pqueue == NULL || pqueue->size == 0) {
         return NULL;
     }
-    fossil_tofu_pqueue_node_t* current = pqueue->front;
-    while (current != NULL && current->priority != priority) {
-        current = current->next;
-    }
-    return current == NULL ? NULL : current->data.value.data;
+    size_t pos = fossil_tofu_pqueue_find(pqueue, priority);
+    return pos == SIZE_MAX ? NULL : fossil_tofu_get_value(fossil_tofu_pqueue_data_at(pqueue, pos));
 }
 
 void fossil_tofu_pqueue_set_front(fossil_tofu_pqueue_t* pqueue, char *element) {
-    if (pqueue == NULL || pqueue->front == NULL) {
+    if (pqueue == NULL || pqueue->size == 0) {
         return;
     }
-    fossil_tofu_set_value(&pqueue->front->data, element);
+    fossil_tofu_set_value(fossil_tofu_pqueue_data_at(pqueue, 0), element);
 }
 
 void fossil_tofu_pqueue_set_back(fossil_tofu_pqueue_t* pqueue, char *element) {
-    if (pqueue == NULL || pqueue->front == NULL) {
+    if (pqueue == NULL || pqueue->size == 0) {
         return;
     }
-    fossil_tofu_pqueue_node_t* current = pqueue->front;
-    while (current->next != NULL) {
-        current = current->next;
-    }
-    fossil_tofu_set_value(&current->data, element);
+    fossil_tofu_set_value(fossil_tofu_pqueue_data_at(pqueue, fossil_tofu_pqueue_find_back(pqueue)), element);
 }
 
 void fossil_tofu_pqueue_set_at(fossil_tofu_pqueue_t* pqueue, int32_t priority, char *element) {
-    if (pqueue == NULL || pqueue->front == NULL) {
+    if (pqueue == NULL || pqueue->size == 0) {
         return;
     }
-    fossil_tofu_pqueue_node_t* current = pqueue->front;
-    while (current != NULL && current->priority != priority) {
-        current = current->next;
-    }
-    if (current != NULL) {
-        fossil_tofu_set_value(&current->data, element);
+    size_t pos = fossil_tofu_pqueue_find(pqueue, priority);
+    if (pos != SIZE_MAX) {
+        fossil_tofu_set_value(fossil_tofu_pqueue_data_at(pqueue, pos), element);
     }
 }
@@ -23,6 +23,32 @@
  * -----------------------------------------------------------------------------
  */
 #include "fossil/tofu/queue.h"
+#include <stdatomic.h>
+
+// Padding that keeps the enqueue and dequeue positions on different cache lines
+#define FOSSIL_TOFU_QUEUE_CACHE_LINE 64
+
+// A slot of the bounded queue. `sequence` equals the enqueue position that may
+// fill the slot next, or that position plus one once it holds an element.
+typedef struct fossil_tofu_queue_mpmc_cell_t {
+    atomic_size_t sequence;
+    fossil_tofu_t data;
+} fossil_tofu_queue_mpmc_cell_t;
+
+struct fossil_tofu_queue_mpmc_t {
+    // Fixed at creation, read by every thread
+    fossil_tofu_queue_mpmc_cell_t* cells;
+    size_t mask;                  // Slot count minus one; the slot count is a power of two
+    char* type;
+    fossil_tofu_type_t type_enum;
+    char pad0[FOSSIL_TOFU_QUEUE_CACHE_LINE];
+
+    atomic_size_t enqueue_pos;    // Claimed by producers, never wrapped
+    char pad1[FOSSIL_TOFU_QUEUE_CACHE_LINE];
+
+    atomic_size_t dequeue_pos;    // Claimed by consumers, never wrapped
+    char pad2[FOSSIL_TOFU_QUEUE_CACHE_LINE];
+};
 
 // *****************************************************************************
 // Function prototypes
@@ -34,8 +60,10 @@ fossil_tofu_queue_t* fossil_tofu_queue_create_container(char* type) {
         return NULL;
     }
     queue->type = type;
+    queue->type_enum = fossil_tofu_validate_type(type);
     queue->front = NULL;
     queue->rear = NULL;
+    fossil_tofu_pool_init(&queue->pool, sizeof(fossil_tofu_queue_node_t));
     return queue;
 }
 
@@ -49,11 +77,13 @@ fossil_tofu_queue_t* fossil_tofu_queue_create_copy(const fossil_tofu_queue_t* ot
         return NULL;
     }
     queue->type = other->type;
+    queue->type_enum = other->type_enum;
     queue->front = NULL;
     queue->rear = NULL;
+    fossil_tofu_pool_init(&queue->pool, sizeof(fossil_tofu_queue_node_t));
     fossil_tofu_queue_node_t* current = other->front;
     while (current != NULL) {
-        fossil_tofu_queue_insert(queue, current->data.value.data);
+        fossil_tofu_queue_insert(queue, fossil_tofu_get_value(&current->data));
         current = current->next;
     }
     return queue;
@@ -65,8 +95,11 @@ fossil_tofu_queue_t* fossil_tofu_queue_create_move(fossil_tofu_queue_t* other) {
         return NULL;
     }
     queue->type = other->type;
+    queue->type_enum = other->type_enum;
     queue->front = other->front;
     queue->rear = other->rear;
+    fossil_tofu_pool_init(&queue->pool, sizeof(fossil_tofu_queue_node_t));
+    fossil_tofu_pool_move(&queue->pool, &other->pool);
     other->front = NULL;
     other->rear = NULL;
     return queue;
@@ -76,12 +109,11 @@ void fossil_tofu_queue_destroy(fossil_tofu_queue_t* queue) {
     if (queue == NULL) {
         return;
     }
-    while (queue->front != NULL) {
-        fossil_tofu_queue_node_t* temp = queue->front;
-        queue->front = queue->front->next;
-        fossil_tofu_destroy(&temp->data);
-        fossil_tofu_free(temp);
+    for (fossil_tofu_queue_node_t* current = queue->front; current != NULL; current = current->next) {
+        fossil_tofu_destroy(&current->data);
     }
+    // Nodes are released with their slabs
+    fossil_tofu_pool_clear(&queue->pool);
     fossil_tofu_free(queue);
 }
 
@@ -93,11 +125,11 @@ int32_t fossil_tofu_queue_insert(fossil_tofu_queue_t* queue, char *data) {
     if (queue == NULL) {
         return FOSSIL_TOFU_FAILURE;
     }
-    fossil_tofu_queue_node_t* node = (fossil_tofu_queue_node_t*)fossil_tofu_alloc(sizeof(fossil_tofu_queue_node_t));
+    fossil_tofu_queue_node_t* node = (fossil_tofu_queue_node_t*)fossil_tofu_pool_acquire(&queue->pool);
     if (node == NULL) {
         return FOSSIL_TOFU_FAILURE;
     }
-    node->data = fossil_tofu_create(queue->type, data);
+    node->data = fossil_tofu_create_typed(queue->type_enum, data);
     node->next = NULL;
     if (queue->front == NULL) {
         queue->front = node;
@@ -115,7 +147,7 @@ int32_t fossil_tofu_queue_remove(fossil_tofu_queue_t* queue) {
     fossil_tofu_queue_node_t* temp = queue->front;
     queue->front = queue->front->next;
     fossil_tofu_destroy(&temp->data);
-    fossil_tofu_free(temp);
+    fossil_tofu_pool_release(&queue->pool, temp);
     return FOSSIL_TOFU_SUCCESS;
 }
 
@@ -150,11 +182,11 @@ bool fossil_tofu_queue_is_cnullptr(const fossil_tofu_queue_t* queue) {
 // *****************************************************************************
 
 char *fossil_tofu_queue_get_front(const fossil_tofu_queue_t* queue) {
-    return queue == NULL || queue->front == NULL ? NULL : queue->front->data.value.data;
+    return queue == NULL || queue->front == NULL ? NULL : fossil_tofu_get_value(&queue->front->data);
 }
 
 char *fossil_tofu_queue_get_rear(const fossil_tofu_queue_t* queue) {
-    return queue == NULL || queue->rear == NULL ? NULL : queue->rear->data.value.data;
+    return queue == NULL || queue->rear == NULL ? NULL : fossil_tofu_get_value(&queue->rear->data);
 }
 
 void fossil_tofu_queue_set_front(fossil_tofu_queue_t* queue, char *element) {
@@ -170,3 +202,133 @@ void fossil_tofu_queue_set_rear(fossil_tofu_queue_t* queue, char *element) {
     }
     fossil_tofu_set_value(&queue->rear->data, element);
 }
+
+// *****************************************************************************
+// Multi-producer/multi-consumer functions
+// *****************************************************************************
+
+fossil_tofu_queue_mpmc_t* fossil_tofu_queue_create_mpmc(char* type, size_t capacity) {
+    if (type == NULL || capacity == 0) {
+        return NULL;
+    }
+    fossil_tofu_type_t type_enum = fossil_tofu_validate_type(type);
+    if (type_enum == FOSSIL_TOFU_TYPE_CNULL) {
+        return NULL;
+    }
+    // At least two slots: with one, a filled slot's sequence (pos + 1) would
+    // also read as free to the producer claiming the next position
+    size_t slots = 2;
+    while (slots < capacity) {
+        if (slots > SIZE_MAX / 2 / sizeof(fossil_tofu_queue_mpmc_cell_t)) {
+            return NULL;
+        }
+        slots *= 2;
+    }
+    fossil_tofu_queue_mpmc_t* queue = (fossil_tofu_queue_mpmc_t*)fossil_tofu_alloc(sizeof(fossil_tofu_queue_mpmc_t));
+    if (queue == NULL) {
+        return NULL;
+    }
+    queue->cells = (fossil_tofu_queue_mpmc_cell_t*)fossil_tofu_alloc(slots * sizeof(fossil_tofu_queue_mpmc_cell_t));
+    queue->type = fossil_tofu_strdup(type);
+    if (queue->cells == NULL || queue->type == NULL) {
+        fossil_tofu_free(queue->cells);
+        fossil_tofu_free(queue->type);
+        fossil_tofu_free(queue);
+        return NULL;
+    }
+    for (size_t i = 0; i < slots; i++) {
+        atomic_init(&queue->cells[i].sequence, i);
+    }
+    queue->mask = slots - 1;
+    queue->type_enum = type_enum;
+    atomic_init(&queue->enqueue_pos, 0);
+    atomic_init(&queue->dequeue_pos, 0);
+    return queue;
+}
+
+void fossil_tofu_queue_mpmc_destroy(fossil_tofu_queue_mpmc_t* queue) {
+    if (queue == NULL) {
+        return;
+    }
+    size_t end = atomic_load_explicit(&queue->enqueue_pos, memory_order_acquire);
+    for (size_t pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_acquire); pos != end; pos++) {
+        fossil_tofu_destroy(&queue->cells[pos & queue->mask].data);
+    }
+    fossil_tofu_free(queue->cells);
+    fossil_tofu_free(queue->type);
+    fossil_tofu_free(queue);
+}
+
+int32_t fossil_tofu_queue_mpmc_try_push(fossil_tofu_queue_mpmc_t* queue, char *data) {
+    if (queue == NULL || data == NULL) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    size_t pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+    fossil_tofu_queue_mpmc_cell_t* cell;
+    for (;;) {
+        cell = &queue->cells[pos & queue->mask];
+        size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+        if (diff == 0) {
+            // The slot is free for this round; claim the position
+            if (atomic_compare_exchange_weak_explicit(&queue->enqueue_pos, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return FOSSIL_TOFU_FAILURE;  // Queue is full
+        } else {
+            pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+        }
+    }
+    cell->data = fossil_tofu_create_typed(queue->type_enum, data);
+    atomic_store_explicit(&cell->sequence, pos + 1, memory_order_release);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_queue_mpmc_try_pop(fossil_tofu_queue_mpmc_t* queue, fossil_tofu_t* out) {
+    if (queue == NULL) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    size_t pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+    fossil_tofu_queue_mpmc_cell_t* cell;
+    for (;;) {
+        cell = &queue->cells[pos & queue->mask];
+        size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t)sequence - (intptr_t)(pos + 1);
+        if (diff == 0) {
+            // The slot holds this round's element; claim the position
+            if (atomic_compare_exchange_weak_explicit(&queue->dequeue_pos, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return FOSSIL_TOFU_FAILURE;  // Queue is empty
+        } else {
+            pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+        }
+    }
+    if (out != NULL) {
+        *out = cell->data;  // The element is relocatable, so the caller takes it over
+    } else {
+        fossil_tofu_destroy(&cell->data);
+    }
+    // Hand the slot to the producer one lap ahead
+    atomic_store_explicit(&cell->sequence, pos + queue->mask + 1, memory_order_release);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+size_t fossil_tofu_queue_mpmc_size(const fossil_tofu_queue_mpmc_t* queue) {
+    if (queue == NULL) {
+        return 0;
+    }
+    fossil_tofu_queue_mpmc_t* shared = (fossil_tofu_queue_mpmc_t*)queue;
+    // Load the dequeue position first; consumers never pass producers
+    size_t head = atomic_load_explicit(&shared->dequeue_pos, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&shared->enqueue_pos, memory_order_acquire);
+    return tail - head;
+}
+
+size_t fossil_tofu_queue_mpmc_capacity(const fossil_tofu_queue_mpmc_t* queue) {
+    return queue == NULL ? 0 : queue->mask + 1;
+}
@@ -24,46 +24,168 @@
  */
 #include "fossil/tofu/setof.h"
 
+// *****************************************************************************
+// Table helpers
+// *****************************************************************************
+
+#define FOSSIL_TOFU_SETOF_NOT_FOUND ((size_t)-1)
+
+// Returns the slot holding `data`, or FOSSIL_TOFU_SETOF_NOT_FOUND.
+static size_t fossil_tofu_setof_find(const fossil_tofu_setof_t* set, const fossil_tofu_t* data) {
+    if (set->capacity == 0) {
+        return FOSSIL_TOFU_SETOF_NOT_FOUND;
+    }
+    size_t mask = set->capacity - 1;
+    size_t index = (size_t)data->value.hash & mask;
+    for (uint32_t distance = 1;; distance++) {
+        const fossil_tofu_setof_entry_t* entry = &set->entries[index];
+        // Past an empty slot or a resident nearer its home, the element cannot be further on
+        if (entry->distance < distance) {
+            return FOSSIL_TOFU_SETOF_NOT_FOUND;
+        }
+        if (entry->data.value.hash == data->value.hash && fossil_tofu_equals(&entry->data, data)) {
+            return index;
+        }
+        index = (index + 1) & mask;
+    }
+}
+
+// Places an element known to be absent; the table must have a free slot.
+static void fossil_tofu_setof_place(fossil_tofu_setof_t* set, fossil_tofu_setof_entry_t carry) {
+    size_t mask = set->capacity - 1;
+    size_t index = (size_t)carry.data.value.hash & mask;
+    carry.distance = 1;
+    for (;;) {
+        fossil_tofu_setof_entry_t* entry = &set->entries[index];
+        if (entry->distance == 0) {
+            *entry = carry;
+            return;
+        }
+        // Robin Hood: the entry further from home keeps the slot
+        if (entry->distance < carry.distance) {
+            fossil_tofu_setof_entry_t swap = *entry;
+            *entry = carry;
+            carry = swap;
+        }
+        index = (index + 1) & mask;
+        carry.distance++;
+    }
+}
+
+// Grows the table until `count` elements fit under the load factor.
+static bool fossil_tofu_setof_reserve(fossil_tofu_setof_t* set, size_t count) {
+    size_t capacity = set->capacity ? set->capacity : FOSSIL_TOFU_SETOF_MIN_CAPACITY;
+    while (count * FOSSIL_TOFU_SETOF_LOAD_DEN > capacity * FOSSIL_TOFU_SETOF_LOAD_NUM) {
+        capacity *= 2;
+    }
+    if (capacity == set->capacity) {
+        return true;
+    }
+
+    fossil_tofu_setof_entry_t* entries = (fossil_tofu_setof_entry_t*)fossil_tofu_alloc(capacity * sizeof(fossil_tofu_setof_entry_t));
+    if (entries == NULL) {
+        return false;
+    }
+    for (size_t i = 0; i < capacity; i++) {
+        entries[i].distance = 0;
+    }
+
+    fossil_tofu_setof_entry_t* old_entries = set->entries;
+    size_t old_capacity = set->capacity;
+    set->entries = entries;
+    set->capacity = capacity;
+    for (size_t i = 0; i < old_capacity; i++) {
+        if (old_entries[i].distance != 0) {
+            fossil_tofu_setof_place(set, old_entries[i]);
+        }
+    }
+    fossil_tofu_free(old_entries);
+    return true;
+}
+
+// Adds a copy of an element taken from another set of the same type.
+static int32_t fossil_tofu_setof_add(fossil_tofu_setof_t* set, const fossil_tofu_t* data) {
+    if (fossil_tofu_setof_find(set, data) != FOSSIL_TOFU_SETOF_NOT_FOUND) {
+        return FOSSIL_TOFU_SUCCESS;
+    }
+    if (!fossil_tofu_setof_reserve(set, set->size + 1)) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    fossil_tofu_setof_entry_t entry = {0};
+    if (fossil_tofu_copy(&entry.data, data) != FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_destroy(&entry.data);
+        return FOSSIL_TOFU_FAILURE;
+    }
+    fossil_tofu_setof_place(set, entry);
+    set->size++;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
 // *****************************************************************************
 // Function prototypes
 // *****************************************************************************
 
-fossil_tofu_setof_t* fossil_tofu_setof_create_container(char* type) {
+// Creates an empty set from an already resolved type, so derived sets never
+// re-parse a type string the caller may no longer own.
+static fossil_tofu_setof_t* fossil_tofu_setof_create_as(const char* type, fossil_tofu_type_t type_enum) {
     fossil_tofu_setof_t* set = (fossil_tofu_setof_t*)fossil_tofu_alloc(sizeof(fossil_tofu_setof_t));
     if (set == NULL) {
         return NULL;
     }
-    set->type = type;
-    set->head = NULL;
+    set->type = type ? fossil_tofu_strdup(type) : NULL;
+    if (type != NULL && set->type == NULL) {
+        fossil_tofu_free(set);
+        return NULL;
+    }
+    set->type_enum = type_enum;
+    set->entries = NULL;
+    set->capacity = 0;
     set->size = 0;
     return set;
 }
 
+// Adds copies of every element of `other`, which has the same type as `set`.
+static int32_t fossil_tofu_setof_add_all(fossil_tofu_setof_t* set, const fossil_tofu_setof_t* other) {
+    for (size_t i = 0; i < other->capacity; i++) {
+        if (other->entries[i].distance != 0 &&
+            fossil_tofu_setof_add(set, &other->entries[i].data) != FOSSIL_TOFU_SUCCESS) {
+            return FOSSIL_TOFU_FAILURE;
+        }
+    }
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+fossil_tofu_setof_t* fossil_tofu_setof_create_container(char* type) {
+    return fossil_tofu_setof_create_as(type, fossil_tofu_validate_type(type));
+}
+
 fossil_tofu_setof_t* fossil_tofu_setof_create_default(void) {
     return fossil_tofu_setof_create_container("any");
 }
 
 fossil_tofu_setof_t* fossil_tofu_setof_create_copy(const fossil_tofu_setof_t* other) {
-    fossil_tofu_setof_t* set = fossil_tofu_setof_create_container(other->type);
+    fossil_tofu_setof_t* set = fossil_tofu_setof_create_as(other->type, other->type_enum);
     if (set == NULL) {
         return NULL;
     }
-    fossil_tofu_setof_node_t* current = other->head;
-    while (current != NULL) {
-        fossil_tofu_setof_insert(set, fossil_tofu_get_value(&current->data));
-        current = current->next;
+    if (!fossil_tofu_setof_reserve(set, other->size) ||
+        fossil_tofu_setof_add_all(set, other) != FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_setof_destroy(set);
+        return NULL;
     }
     return set;
 }
 
 fossil_tofu_setof_t* fossil_tofu_setof_create_move(fossil_tofu_setof_t* other) {
-    fossil_tofu_setof_t* set = fossil_tofu_setof_create_container(other->type);
+    fossil_tofu_setof_t* set = fossil_tofu_setof_create_as(other->type, other->type_enum);
     if (set == NULL) {
         return NULL;
     }
-    set->head = other->head;
-    other->head = NULL;
+    set->entries = other->entries;
+    set->capacity = other->capacity;
     set->size = other->size;
+    other->entries = NULL;
+    other->capacity = 0;
     other->size = 0;
     return set;
 }
@@ -72,12 +194,13 @@ void fossil_tofu_setof_destroy(fossil_tofu_setof_t* set) {
     if (set == NULL) {
         return;
     }
-    while (set->head != NULL) {
-        fossil_tofu_setof_node_t* temp = set->head;
-        set->head = set->head->next;
-        fossil_tofu_destroy(&temp->data);
-        fossil_tofu_free(temp);
+    for (size_t i = 0; i < set->capacity; i++) {
+        if (set->entries[i].distance != 0) {
+            fossil_tofu_destroy(&set->entries[i].data);
+        }
     }
+    fossil_tofu_free(set->entries);
+    fossil_tofu_free(set->type);
     fossil_tofu_free(set);
 }
 
@@ -85,13 +208,16 @@ int32_t fossil_tofu_setof_insert(fossil_tofu_setof_t* set, char *data) {
     if (set == NULL || data == NULL) {
         return FOSSIL_TOFU_FAILURE;
     }
-    fossil_tofu_setof_node_t* node = (fossil_tofu_setof_node_t*)fossil_tofu_alloc(sizeof(fossil_tofu_setof_node_t));
-    if (node == NULL) {
+    fossil_tofu_t view = fossil_tofu_view_typed(set->type_enum, data);
+    if (fossil_tofu_setof_find(set, &view) != FOSSIL_TOFU_SETOF_NOT_FOUND) {
+        return FOSSIL_TOFU_SUCCESS; // Already a member
+    }
+    if (!fossil_tofu_setof_reserve(set, set->size + 1)) {
         return FOSSIL_TOFU_FAILURE;
     }
-    node->data = fossil_tofu_create(set->type, data);
-    node->next = set->head;
-    set->head = node;
+    fossil_tofu_setof_entry_t entry;
+    entry.data = fossil_tofu_create_typed(set->type_enum, data);
+    fossil_tofu_setof_place(set, entry);
     set->size++;
     return FOSSIL_TOFU_SUCCESS;
 }
@@ -101,24 +227,25 @@ int32_t fossil_tofu_setof_remove(fossil_tofu_setof_t* set, char *data) {
         return FOSSIL_TOFU_FAILURE;
     }
 
-    fossil_tofu_t temp_data = fossil_tofu_create(set->type, data);
-    fossil_tofu_setof_node_t** current = &set->head;
-
-    while (*current) {
-        if (fossil_tofu_compare(&(*current)->data, &temp_data) == 0) {
-            fossil_tofu_setof_node_t* temp = *current;
-            *current = (*current)->next;
-            fossil_tofu_destroy(&temp->data);
-            fossil_tofu_free(temp);
-            set->size--;
-            fossil_tofu_destroy(&temp_data);
-            return FOSSIL_TOFU_SUCCESS;
-        }
-        current = &((*current)->next);
+    fossil_tofu_t view = fossil_tofu_view_typed(set->type_enum, data);
+    size_t index = fossil_tofu_setof_find(set, &view);
+    if (index == FOSSIL_TOFU_SETOF_NOT_FOUND) {
+        return FOSSIL_TOFU_FAILURE;
     }
+    fossil_tofu_destroy(&set->entries[index].data);
 
-    fossil_tofu_destroy(&temp_data);
-    return FOSSIL_TOFU_FAILURE;
+    // Backward-shift deletion keeps probe sequences free of tombstones
+    size_t mask = set->capacity - 1;
+    size_t next = (index + 1) & mask;
+    while (set->entries[next].distance > 1) {
+        set->entries[index] = set->entries[next];
+        set->entries[index].distance--;
+        index = next;
+        next = (next + 1) & mask;
+    }
+    set->entries[index].distance = 0;
+    set->size--;
+    return FOSSIL_TOFU_SUCCESS;
 }
 
 bool fossil_tofu_setof_contains(const fossil_tofu_setof_t* set, char *data) {
@@ -126,19 +253,8 @@ bool fossil_tofu_setof_contains(const fossil_tofu_setof_t* set, char *data) {
         return false;
     }
 
-    fossil_tofu_t temp_data = fossil_tofu_create(set->type, data);
-    fossil_tofu_setof_node_t* current = set->head;
-
-    while (current) {
-        if (fossil_tofu_compare(&current->data, &temp_data) == 0) {
-            fossil_tofu_destroy(&temp_data);
-            return true;
-        }
-        current = current->next;
-    }
-
-    fossil_tofu_destroy(&temp_data);
-    return false;
+    fossil_tofu_t view = fossil_tofu_view_typed(set->type_enum, data);
+    return fossil_tofu_setof_find(set, &view) != FOSSIL_TOFU_SETOF_NOT_FOUND;
 }
 
 size_t fossil_tofu_setof_size(const fossil_tofu_setof_t* set) {
@@ -152,3 +268,80 @@ bool fossil_tofu_setof_not_empty(const fossil_tofu_setof_t* set) {
 bool fossil_tofu_setof_is_empty(const fossil_tofu_setof_t* set) {
     return set == NULL || set->size == 0;
 }
+
+// *****************************************************************************
+// Set algebra
+// *****************************************************************************
+
+fossil_tofu_setof_t* fossil_tofu_setof_union(const fossil_tofu_setof_t* a, const fossil_tofu_setof_t* b) {
+    if (a == NULL || b == NULL || a->type_enum != b->type_enum) {
+        return NULL;
+    }
+    fossil_tofu_setof_t* set = fossil_tofu_setof_create_as(a->type, a->type_enum);
+    if (set == NULL) {
+        return NULL;
+    }
+    // Sized for both up front so the table never rehashes while filling
+    if (!fossil_tofu_setof_reserve(set, a->size + b->size) ||
+        fossil_tofu_setof_add_all(set, a) != FOSSIL_TOFU_SUCCESS ||
+        fossil_tofu_setof_add_all(set, b) != FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_setof_destroy(set);
+        return NULL;
+    }
+    return set;
+}
+
+fossil_tofu_setof_t* fossil_tofu_setof_intersection(const fossil_tofu_setof_t* a, const fossil_tofu_setof_t* b) {
+    if (a == NULL || b == NULL || a->type_enum != b->type_enum) {
+        return NULL;
+    }
+    const fossil_tofu_setof_t* large = a->size >= b->size ? a : b;
+    const fossil_tofu_setof_t* small = large == a ? b : a;
+    fossil_tofu_setof_t* set = fossil_tofu_setof_create_as(a->type, a->type_enum);
+    if (set == NULL) {
+        return NULL;
+    }
+    for (size_t i = 0; i < small->capacity; i++) {
+        const fossil_tofu_t* data = &small->entries[i].data;
+        if (small->entries[i].distance != 0 &&
+            fossil_tofu_setof_find(large, data) != FOSSIL_TOFU_SETOF_NOT_FOUND &&
+            fossil_tofu_setof_add(set, data) != FOSSIL_TOFU_SUCCESS) {
+            fossil_tofu_setof_destroy(set);
+            return NULL;
+        }
+    }
+    return set;
+}
+
+fossil_tofu_setof_t* fossil_tofu_setof_difference(const fossil_tofu_setof_t* a, const fossil_tofu_setof_t* b) {
+    if (a == NULL || b == NULL || a->type_enum != b->type_enum) {
+        return NULL;
+    }
+    fossil_tofu_setof_t* set = fossil_tofu_setof_create_as(a->type, a->type_enum);
+    if (set == NULL) {
+        return NULL;
+    }
+    for (size_t i = 0; i < a->capacity; i++) {
+        const fossil_tofu_t* data = &a->entries[i].data;
+        if (a->entries[i].distance != 0 &&
+            fossil_tofu_setof_find(b, data) == FOSSIL_TOFU_SETOF_NOT_FOUND &&
+            fossil_tofu_setof_add(set, data) != FOSSIL_TOFU_SUCCESS) {
+            fossil_tofu_setof_destroy(set);
+            return NULL;
+        }
+    }
+    return set;
+}
+
+bool fossil_tofu_setof_is_subset(const fossil_tofu_setof_t* a, const fossil_tofu_setof_t* b) {
+    if (a == NULL || b == NULL || a->type_enum != b->type_enum || a->size > b->size) {
+        return false;
+    }
+    for (size_t i = 0; i < a->capacity; i++) {
+        if (a->entries[i].distance != 0 &&
+            fossil_tofu_setof_find(b, &a->entries[i].data) == FOSSIL_TOFU_SETOF_NOT_FOUND) {
+            return false;
+        }
+    }
+    return true;
+}
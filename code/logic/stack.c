@@ -25,7 +25,7 @@
 #include "fossil/tofu/stack.h"
 
 fossil_tofu_stack_t* fossil_tofu_stack_create_container(char* type) {
-    fossil_tofu_stack_t* stack = (fossil_tofu_stack_t*)malloc(sizeof(fossil_tofu_stack_t));
+    fossil_tofu_stack_t* stack = (fossil_tofu_stack_t*)fossil_tofu_alloc(sizeof(fossil_tofu_stack_t));
     if (!stack) {
         return NULL; // Memory allocation failed
     }
@@ -34,7 +34,9 @@ fossil_tofu_stack_t* fossil_tofu_stack_create_container(char* type) {
         fossil_tofu_free(stack);
         return NULL; // Memory allocation failed
     }
+    stack->type_enum = fossil_tofu_validate_type(type);
     stack->top = NULL; // Initialize the top pointer to NULL
+    fossil_tofu_pool_init(&stack->pool, sizeof(fossil_tofu_stack_node_t));
     return stack;
 }
 
@@ -77,10 +79,14 @@ fossil_tofu_stack_t* fossil_tofu_stack_create_move(fossil_tofu_stack_t* other) {
     }
 
     new_stack->type = other->type;
+    new_stack->type_enum = other->type_enum;
     new_stack->top = other->top;
+    fossil_tofu_pool_init(&new_stack->pool, sizeof(fossil_tofu_stack_node_t));
+    fossil_tofu_pool_move(&new_stack->pool, &other->pool);
 
     // Invalidate the original stack
     other->type = NULL;
+    other->type_enum = FOSSIL_TOFU_TYPE_CNULL;
     other->top = NULL;
 
     return new_stack;
@@ -94,13 +100,8 @@ void fossil_tofu_stack_destroy(fossil_tofu_stack_t* stack) {
     // Free the type string
     fossil_tofu_free(stack->type);
 
-    // Free the stack nodes
-    fossil_tofu_stack_node_t* current = stack->top;
-    while (current) {
-        fossil_tofu_stack_node_t* next = current->next;
-        fossil_tofu_free(current);
-        current = next;
-    }
+    // Free the stack nodes along with their slabs
+    fossil_tofu_pool_clear(&stack->pool);
 
     // Free the stack structure
     fossil_tofu_free(stack);
@@ -112,13 +113,13 @@ int32_t fossil_tofu_stack_insert(fossil_tofu_stack_t* stack, char* data) {
     }
 
     // Create a new stack node
-    fossil_tofu_stack_node_t* new_node = (fossil_tofu_stack_node_t*)malloc(sizeof(fossil_tofu_stack_node_t));
+    fossil_tofu_stack_node_t* new_node = (fossil_tofu_stack_node_t*)fossil_tofu_pool_acquire(&stack->pool);
     if (!new_node) {
         return FOSSIL_TOFU_FAILURE; // Memory allocation failed
     }
 
     // Use the stack's type to create the tofu object
-    new_node->data = fossil_tofu_create(stack->type, data);
+    new_node->data = fossil_tofu_create_typed(stack->type_enum, data);
     new_node->next = stack->top;
     stack->top = new_node;
 
@@ -133,7 +134,7 @@ int32_t fossil_tofu_stack_remove(fossil_tofu_stack_t* stack) {
     // Remove the top node
     fossil_tofu_stack_node_t* temp = stack->top;
     stack->top = stack->top->next;
-    fossil_tofu_free(temp);
+    fossil_tofu_pool_release(&stack->pool, temp);
 
     return FOSSIL_TOFU_SUCCESS; // Removal successful
 }
@@ -170,14 +171,14 @@ bool fossil_tofu_stack_is_cnullptr(const fossil_tofu_stack_t* stack) {
 
 fossil_tofu_t fossil_tofu_stack_top(fossil_tofu_stack_t* stack) {
     if (!stack || !stack->top) {
-        return fossil_tofu_create("any", ""); // Return default value if empty
+        return fossil_tofu_create_typed(FOSSIL_TOFU_TYPE_ANY, ""); // Return default value if empty
     }
     return stack->top->data;
 }
 
 fossil_tofu_t fossil_tofu_stack_get(const fossil_tofu_stack_t* stack, size_t index) {
     if (!stack) {
-        return fossil_tofu_create("any", ""); // Return default value if stack is null
+        return fossil_tofu_create_typed(FOSSIL_TOFU_TYPE_ANY, ""); // Return default value if stack is null
     }
 
     fossil_tofu_stack_node_t* current = stack->top;
@@ -189,7 +190,7 @@ fossil_tofu_t fossil_tofu_stack_get(const fossil_tofu_stack_t* stack, size_t ind
         current = current->next;
         current_index++;
     }
-    return fossil_tofu_create("any", ""); // Return default value if index is out of bounds
+    return fossil_tofu_create_typed(FOSSIL_TOFU_TYPE_ANY, ""); // Return default value if index is out of bounds
 }
 
 void fossil_tofu_stack_set(fossil_tofu_stack_t* stack, size_t index, fossil_tofu_t element) {
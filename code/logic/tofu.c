@@ -23,6 +23,7 @@
  * -----------------------------------------------------------------------------
  */
 #include "fossil/tofu/tofu.h"
+#include <stdatomic.h>
 
 // Lookup table for valid strings corresponding to each tofu type.
 static char *_TOFU_TYPE_ID[] = {
@@ -112,26 +113,28 @@ fossil_tofu_type_t fossil_tofu_validate_type(const char *type_str) {
 /**
  * @brief Computes a 64-bit hash of arbitrary data with optional seeding.
  *
- * This function implements a high-quality, parallelized 64-bit hash algorithm
- * designed for speed, low collision rate, and good avalanche properties.
+ * This function implements a word-at-a-time 64-bit hash algorithm designed for
+ * speed, low collision rate, and good avalanche properties.
  *
  * ## Algorithm Overview
  * - **Seed Mixing:** The user-provided seed is diffused through a SplitMix64 step
  *   to maximize entropy even for small or predictable seeds.
- * - **Parallel Accumulators:** Two independent 64-bit accumulators (`v1` and `v2`)
- *   are initialized with different constants and updated in parallel. This improves
- *   mixing and reduces hash clustering for large inputs.
- * - **Chunk Processing:** Data is processed in 16-byte chunks whenever possible,
- *   with each 64-bit lane mixed into a different accumulator. Each accumulator uses
- *   a unique prime multiplier and a left-rotate step for diffusion.
- * - **Tail Handling:** Remaining bytes (<16) are handled carefully to ensure every
- *   bit affects the final result.
- * - **Finalization:** The two accumulators are merged using a mix function and
- *   passed through `mix64()`, a SplitMix64-style avalanche function, producing the
- *   final hash value.
+ * - **Parallel Accumulators:** Four independent 64-bit accumulators are
+ *   initialized with different constants and updated in parallel. Their
+ *   multiply chains do not depend on each other, so the CPU can overlap them.
+ * - **Chunk Processing:** Data is processed in 32-byte stripes, with each 64-bit
+ *   lane mixed into its own accumulator using a prime multiplier and a
+ *   left-rotate step for diffusion.
+ * - **Tail Handling:** Remaining 8-byte words are folded in one at a time and the
+ *   last (<8) bytes are packed into a final partial word, so every bit affects
+ *   the result.
+ * - **Finalization:** The accumulators are merged, combined with the input
+ *   length and passed through `mix64()`, a SplitMix64-style avalanche function,
+ *   producing the final hash value.
  *
  * ## Properties
  * - **Deterministic:** Same input and seed will always produce the same result.
+ *   Lanes are always read as little-endian, so results match across platforms.
  * - **Seedable:** A nonzero seed can be used to create independent hash streams.
  * - **Good Avalanche:** Small changes in input produce large, unpredictable
  *   differences in output.
@@ -148,6 +151,12 @@ fossil_tofu_type_t fossil_tofu_validate_type(const char *type_str) {
  *       hash (e.g., SHA-256) if resistance to deliberate collisions is required.
  */
 
+#define FOSSIL_TOFU_HASH_PRIME1 0x9e3779b185ebca87ULL
+#define FOSSIL_TOFU_HASH_PRIME2 0xc2b2ae3d27d4eb4fULL
+#define FOSSIL_TOFU_HASH_PRIME3 0x165667b19e3779f9ULL
+#define FOSSIL_TOFU_HASH_PRIME4 0x85ebca77c2b2ae63ULL
+#define FOSSIL_TOFU_HASH_STRIPE 32
+
 static inline uint64_t mix64(uint64_t x) {
     x ^= x >> 30;
     x *= 0xbf58476d1ce4e5b9ULL;
@@ -157,30 +166,471 @@ static inline uint64_t mix64(uint64_t x) {
     return x;
 }
 
+static inline uint64_t rotl64(uint64_t x, unsigned r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+// Compilers turn this into a single load on little-endian targets.
+static inline uint64_t read64_le(const uint8_t *p) {
+    return (uint64_t)p[0]         | ((uint64_t)p[1] << 8)  |
+           ((uint64_t)p[2] << 16) | ((uint64_t)p[3] << 24) |
+           ((uint64_t)p[4] << 32) | ((uint64_t)p[5] << 40) |
+           ((uint64_t)p[6] << 48) | ((uint64_t)p[7] << 56);
+}
+
+static inline uint64_t hash_round(uint64_t acc, uint64_t lane) {
+    acc += lane * FOSSIL_TOFU_HASH_PRIME2;
+    acc = rotl64(acc, 31);
+    return acc * FOSSIL_TOFU_HASH_PRIME1;
+}
+
+typedef struct {
+    uint64_t v[4];
+} fossil_tofu_hash_state_t;
+
+static inline void hash_init(fossil_tofu_hash_state_t *state, uint64_t seed) {
+    uint64_t s = mix64(seed + FOSSIL_TOFU_HASH_PRIME3);
+    state->v[0] = s + FOSSIL_TOFU_HASH_PRIME1 + FOSSIL_TOFU_HASH_PRIME2;
+    state->v[1] = s + FOSSIL_TOFU_HASH_PRIME2;
+    state->v[2] = s;
+    state->v[3] = s - FOSSIL_TOFU_HASH_PRIME1;
+}
+
+static inline void hash_stripe(fossil_tofu_hash_state_t *state, const uint8_t *p) {
+    state->v[0] = hash_round(state->v[0], read64_le(p));
+    state->v[1] = hash_round(state->v[1], read64_le(p + 8));
+    state->v[2] = hash_round(state->v[2], read64_le(p + 16));
+    state->v[3] = hash_round(state->v[3], read64_le(p + 24));
+}
+
+// Merges the accumulators and hashes the final `rem` (< 32) bytes at `p`.
+static uint64_t hash_finish(const fossil_tofu_hash_state_t *state, const uint8_t *p,
+                            size_t rem, size_t len) {
+    uint64_t h = rotl64(state->v[0], 1) + rotl64(state->v[1], 7) +
+                 rotl64(state->v[2], 12) + rotl64(state->v[3], 18);
+    for (size_t i = 0; i < 4; i++) {
+        h ^= hash_round(0, state->v[i]);
+        h = h * FOSSIL_TOFU_HASH_PRIME1 + FOSSIL_TOFU_HASH_PRIME4;
+    }
+    h += (uint64_t)len;
+
+    while (rem >= 8) {
+        h ^= hash_round(0, read64_le(p));
+        h = rotl64(h, 27) * FOSSIL_TOFU_HASH_PRIME1 + FOSSIL_TOFU_HASH_PRIME4;
+        p += 8;
+        rem -= 8;
+    }
+    if (rem > 0) {
+        uint64_t word = 0;
+        for (size_t i = 0; i < rem; i++) {
+            word |= (uint64_t)p[i] << (i * 8);
+        }
+        h ^= (word ^ ((uint64_t)rem << 56)) * FOSSIL_TOFU_HASH_PRIME1;
+        h = rotl64(h, 23) * FOSSIL_TOFU_HASH_PRIME2 + FOSSIL_TOFU_HASH_PRIME3;
+    }
+
+    // Stronger finalization (SplitMix64)
+    return mix64(h);
+}
+
 uint64_t fossil_tofu_hash64_seed(const void *data, size_t len, uint64_t seed) {
     if (!data) return 0;
     const uint8_t *ptr = (const uint8_t *)data;
 
-    // FNV-1a base but seeded
-    uint64_t hash = seed ^ 14695981039346656037ULL;
+    fossil_tofu_hash_state_t state;
+    hash_init(&state, seed);
 
-    for (size_t i = 0; i < len; i++) {
-        hash ^= ptr[i];
-        hash *= 1099511628211ULL;
-        hash ^= (hash >> 47);
-        hash += (hash << 13);
-        hash ^= (hash >> 31);
+    size_t offset = 0;
+    for (; offset + FOSSIL_TOFU_HASH_STRIPE <= len; offset += FOSSIL_TOFU_HASH_STRIPE) {
+        hash_stripe(&state, ptr + offset);
     }
+    return hash_finish(&state, ptr + offset, len - offset, len);
+}
 
-    // Stronger finalization (SplitMix64)
-    return mix64(hash);
+/**
+ * Hashes a NUL-terminated string in a single pass: each stripe is scanned for
+ * the terminator and then hashed while it is still in cache, instead of walking
+ * the string once for its length and again for the hash. Produces the same
+ * value as `fossil_tofu_hash64_seed(data, strlen(data), 0)` and stores the
+ * length found along the way in `*length`.
+ */
+static uint64_t fossil_tofu_hash64_measure(const char *data, size_t *length) {
+    const uint8_t *ptr = (const uint8_t *)data;
+
+    fossil_tofu_hash_state_t state;
+    hash_init(&state, 0);
+
+    size_t offset = 0;
+    for (;;) {
+        size_t n = 0;
+        while (n < FOSSIL_TOFU_HASH_STRIPE && ptr[offset + n]) n++;
+        if (n < FOSSIL_TOFU_HASH_STRIPE) {
+            *length = offset + n;
+            return hash_finish(&state, ptr + offset, n, offset + n);
+        }
+        hash_stripe(&state, ptr + offset);
+        offset += FOSSIL_TOFU_HASH_STRIPE;
+    }
 }
 
 uint64_t fossil_tofu_hash64(const char *data) {
     if (!data) return 0;
+    size_t length;
+    return fossil_tofu_hash64_measure(data, &length);
+}
+
+// *****************************************************************************
+// Native value helpers
+// *****************************************************************************
+
+static inline bool fossil_tofu_is_signed_type(fossil_tofu_type_t type) {
+    return type >= FOSSIL_TOFU_TYPE_I8 && type <= FOSSIL_TOFU_TYPE_I64;
+}
+
+static inline bool fossil_tofu_is_unsigned_type(fossil_tofu_type_t type) {
+    return (type >= FOSSIL_TOFU_TYPE_U8 && type <= FOSSIL_TOFU_TYPE_U64) || type == FOSSIL_TOFU_TYPE_SIZE;
+}
+
+static inline bool fossil_tofu_is_float_type(fossil_tofu_type_t type) {
+    return type == FOSSIL_TOFU_TYPE_F32 || type == FOSSIL_TOFU_TYPE_F64;
+}
+
+// Returns the stored text form, inline or on the heap.
+static inline const char *fossil_tofu_text(const fossil_tofu_t *tofu) {
+    return tofu->value.small ? tofu->value.small_data : tofu->value.data;
+}
+
+static inline bool fossil_tofu_has_payload(const fossil_tofu_t *tofu) {
+    return tofu->value.native || fossil_tofu_text(tofu) != NULL;
+}
+
+// Backing block for the long payloads of a batch, freed with its last user.
+// The count is atomic because the values may be destroyed on different threads.
+typedef struct {
+    atomic_size_t refs;
+    char bytes[];
+} fossil_tofu_batch_block_t;
+
+// Releases the text form, whether it lives inline, on the heap or in a batch block.
+static void fossil_tofu_release_text(fossil_tofu_t *tofu) {
+    if (tofu->value.shared) {
+        fossil_tofu_batch_block_t *block = (fossil_tofu_batch_block_t *)tofu->value.block;
+        // The thread that drops the last reference sees every other thread's
+        // use of the block before freeing it
+        if (atomic_fetch_sub_explicit(&block->refs, 1, memory_order_acq_rel) == 1) {
+            fossil_tofu_free(block);
+        }
+        tofu->value.shared = false;
+    } else {
+        fossil_tofu_free(tofu->value.data);
+    }
+    tofu->value.data = NULL;
+    tofu->value.small = false;
+    tofu->value.length = 0;
+}
+
+// Stores `len` bytes of `text` as the text form, inline when it fits.
+static bool fossil_tofu_assign_text(fossil_tofu_t *tofu, const char *text, size_t len) {
+    fossil_tofu_release_text(tofu);
+    if (len < FOSSIL_TOFU_SMALL_CAPACITY) {
+        memcpy(tofu->value.small_data, text, len);
+        tofu->value.small_data[len] = '\0';
+        tofu->value.small = true;
+    } else {
+        tofu->value.data = (char *)fossil_tofu_alloc(len + 1);
+        if (!tofu->value.data) return false;
+        memcpy(tofu->value.data, text, len);
+        tofu->value.data[len] = '\0';
+    }
+    tofu->value.length = len;
+    return true;
+}
+
+// Copies the text form of `src` into `dest`, which must not hold any text yet.
+static bool fossil_tofu_copy_text(fossil_tofu_t *dest, const fossil_tofu_t *src) {
+    dest->value.data = NULL;
+    dest->value.small = false;
+    dest->value.shared = false;
+    dest->value.length = 0;
+    const char *text = fossil_tofu_text(src);
+    if (!text) return true;
+    return fossil_tofu_assign_text(dest, text, src->value.length);
+}
+
+// Parses a canonical decimal integer: optional '-', no leading zeros, no "-0".
+static bool fossil_tofu_parse_decimal(const char *str, bool *negative, uint64_t *magnitude) {
+    const char *p = str;
+    *negative = false;
+    if (*p == '-') {
+        *negative = true;
+        p++;
+    }
+    if (*p < '0' || *p > '9') return false;
+    if (*p == '0' && (p[1] != '\0' || *negative)) return false;
+
+    uint64_t acc = 0;
+    for (; *p; p++) {
+        if (*p < '0' || *p > '9') return false;
+        uint64_t digit = (uint64_t)(*p - '0');
+        if (acc > (UINT64_MAX - digit) / 10) return false;
+        acc = acc * 10 + digit;
+    }
+    *magnitude = acc;
+    return true;
+}
+
+static bool fossil_tofu_parse_signed(fossil_tofu_type_t type, const char *str, int64_t *out) {
+    static const int64_t limits[][2] = {
+        { INT8_MIN,  INT8_MAX  },
+        { INT16_MIN, INT16_MAX },
+        { INT32_MIN, INT32_MAX },
+        { INT64_MIN, INT64_MAX }
+    };
+    bool negative;
+    uint64_t magnitude;
+    if (!fossil_tofu_parse_decimal(str, &negative, &magnitude)) return false;
+
+    int64_t value;
+    if (negative) {
+        if (magnitude > (uint64_t)INT64_MAX + 1) return false;
+        value = magnitude == (uint64_t)INT64_MAX + 1 ? INT64_MIN : -(int64_t)magnitude;
+    } else {
+        if (magnitude > (uint64_t)INT64_MAX) return false;
+        value = (int64_t)magnitude;
+    }
+
+    size_t index = (size_t)(type - FOSSIL_TOFU_TYPE_I8);
+    if (value < limits[index][0] || value > limits[index][1]) return false;
+    *out = value;
+    return true;
+}
+
+static bool fossil_tofu_parse_unsigned(fossil_tofu_type_t type, const char *str, uint64_t *out) {
+    uint64_t limit;
+    switch (type) {
+        case FOSSIL_TOFU_TYPE_U8:   limit = UINT8_MAX;  break;
+        case FOSSIL_TOFU_TYPE_U16:  limit = UINT16_MAX; break;
+        case FOSSIL_TOFU_TYPE_U32:  limit = UINT32_MAX; break;
+        case FOSSIL_TOFU_TYPE_SIZE: limit = SIZE_MAX;   break;
+        default:                    limit = UINT64_MAX; break;
+    }
+    bool negative;
+    uint64_t magnitude;
+    if (!fossil_tofu_parse_decimal(str, &negative, &magnitude)) return false;
+    if (negative || magnitude > limit) return false;
+    *out = magnitude;
+    return true;
+}
+
+/**
+ * Attempts to store `str` natively in `value`. Integers, booleans and chars
+ * are only taken when the text is canonical, so rendering them back yields
+ * the exact same string. Floats keep their original text alongside the
+ * parsed value, so the caller still has to store `str`.
+ */
+static bool fossil_tofu_parse_native(fossil_tofu_type_t type, const char *str, fossil_tofu_value_t *value) {
+    value->as.u64 = 0;
+    value->native = false;
+
+    if (fossil_tofu_is_signed_type(type)) {
+        value->native = fossil_tofu_parse_signed(type, str, &value->as.i64);
+    } else if (fossil_tofu_is_unsigned_type(type)) {
+        value->native = fossil_tofu_parse_unsigned(type, str, &value->as.u64);
+    } else if (fossil_tofu_is_float_type(type)) {
+        char *end = NULL;
+        double parsed = strtod(str, &end);
+        if (type == FOSSIL_TOFU_TYPE_F32) {
+            // Round like fossil_tofu_from_f32 so both spellings hash and compare alike
+            parsed = (double)(float)parsed;
+        }
+        if (end != str && *end == '\0') {
+            value->as.f64 = parsed;
+            value->native = true;
+        }
+    } else if (type == FOSSIL_TOFU_TYPE_BOOL) {
+        if (strcmp(str, "true") == 0 || strcmp(str, "false") == 0) {
+            value->as.b = str[0] == 't';
+            value->native = true;
+        }
+    } else if (type == FOSSIL_TOFU_TYPE_CCHAR) {
+        if (str[0] != '\0' && str[1] == '\0') {
+            value->as.c = str[0];
+            value->native = true;
+        }
+    }
+    return value->native;
+}
+
+// Writes a decimal integer into `buf`, which must hold at least 21 bytes.
+static int fossil_tofu_render_decimal(bool negative, uint64_t magnitude, char *buf) {
+    char digits[20];
+    size_t count = 0;
+    do {
+        digits[count++] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude != 0);
+
     size_t len = 0;
-    while (data[len]) len++;
-    return fossil_tofu_hash64_seed(data, len, 0);
+    if (negative) buf[len++] = '-';
+    while (count > 0) buf[len++] = digits[--count];
+    buf[len] = '\0';
+    return (int)len;
+}
+
+// Renders a native payload into `buf` using the same formats as the from_* helpers.
+// Only floats go through snprintf; `size` must be at least 21 bytes.
+static int fossil_tofu_render_native(const fossil_tofu_t *tofu, char *buf, size_t size) {
+    const fossil_tofu_native_t *as = &tofu->value.as;
+    switch (tofu->type) {
+        case FOSSIL_TOFU_TYPE_I8:
+        case FOSSIL_TOFU_TYPE_I16:
+        case FOSSIL_TOFU_TYPE_I32:
+        case FOSSIL_TOFU_TYPE_I64:
+            // Negate in unsigned arithmetic so INT64_MIN is well defined
+            return fossil_tofu_render_decimal(as->i64 < 0, as->i64 < 0 ? 0 - (uint64_t)as->i64 : (uint64_t)as->i64, buf);
+        case FOSSIL_TOFU_TYPE_U8:
+        case FOSSIL_TOFU_TYPE_U16:
+        case FOSSIL_TOFU_TYPE_U32:
+        case FOSSIL_TOFU_TYPE_U64:
+        case FOSSIL_TOFU_TYPE_SIZE:
+            return fossil_tofu_render_decimal(false, as->u64, buf);
+        case FOSSIL_TOFU_TYPE_F32:
+        case FOSSIL_TOFU_TYPE_F64:
+            return snprintf(buf, size, "%f", as->f64);
+        case FOSSIL_TOFU_TYPE_BOOL:
+            strcpy(buf, as->b ? "true" : "false");
+            return as->b ? 4 : 5;
+        case FOSSIL_TOFU_TYPE_CCHAR:
+            buf[0] = as->c;
+            buf[1] = '\0';
+            return 1;
+        default:
+            buf[0] = '\0';
+            return 0;
+    }
+}
+
+// Hashes the native payload as a fixed little-endian word so results do not depend on host byte order.
+static uint64_t fossil_tofu_hash_native(const fossil_tofu_t *tofu) {
+    const fossil_tofu_native_t *as = &tofu->value.as;
+    uint64_t word;
+    if (fossil_tofu_is_float_type(tofu->type)) {
+        double normalized = as->f64 == 0.0 ? 0.0 : as->f64;
+        memcpy(&word, &normalized, sizeof(word));
+    } else if (tofu->type == FOSSIL_TOFU_TYPE_BOOL) {
+        word = as->b ? 1u : 0u;
+    } else if (tofu->type == FOSSIL_TOFU_TYPE_CCHAR) {
+        word = (unsigned char)as->c;
+    } else {
+        word = as->u64;
+    }
+
+    uint8_t bytes[8];
+    for (size_t i = 0; i < sizeof(bytes); i++) {
+        bytes[i] = (uint8_t)(word >> (i * 8));
+    }
+    return fossil_tofu_hash64_seed(bytes, sizeof(bytes), (uint64_t)tofu->type);
+}
+
+static uint64_t fossil_tofu_hash_value(const fossil_tofu_t *tofu) {
+    if (tofu->value.native) return fossil_tofu_hash_native(tofu);
+    const char *text = fossil_tofu_text(tofu);
+    return text ? fossil_tofu_hash64_seed(text, tofu->value.length, 0) : 0;
+}
+
+/**
+ * Stores `text` into `tofu` as its payload, choosing native storage when
+ * possible. Any previous text is released and `value.hash` is refreshed, so the
+ * hash always describes the current payload. Returns false on allocation failure.
+ */
+static bool fossil_tofu_store_text(fossil_tofu_t *tofu, const char *text) {
+    fossil_tofu_release_text(tofu);
+
+    // Native values keep their text too, so reading it never writes to the
+    // object; canonical integers, booleans and chars always fit inline
+    fossil_tofu_parse_native(tofu->type, text, &tofu->value);
+    if (!fossil_tofu_assign_text(tofu, text, strlen(text))) {
+        tofu->value.native = false;
+        tofu->value.hash = 0;
+        return false;
+    }
+    tofu->value.hash = fossil_tofu_hash_value(tofu);
+    return true;
+}
+
+// Points the attributes at the shared per-type tables; nothing is allocated.
+static void fossil_tofu_init_attribute(fossil_tofu_t *tofu) {
+    tofu->attribute.name = _TOFU_TYPE_NAME[tofu->type];
+    tofu->attribute.description = _TOFU_TYPE_INFO[tofu->type];
+    tofu->attribute.id = _TOFU_TYPE_ID[tofu->type];
+    tofu->attribute.required = false;
+    tofu->attribute.owned = false;
+}
+
+// Frees the attribute strings if this tofu owns them and resets them to NULL.
+static void fossil_tofu_release_attribute(fossil_tofu_t *tofu) {
+    if (tofu->attribute.owned) {
+        fossil_tofu_free(tofu->attribute.name);
+        fossil_tofu_free(tofu->attribute.description);
+        fossil_tofu_free(tofu->attribute.id);
+    }
+    tofu->attribute.name = NULL;
+    tofu->attribute.description = NULL;
+    tofu->attribute.id = NULL;
+    tofu->attribute.owned = false;
+}
+
+/**
+ * Copies the attributes of `src` into `dest`. Shared table strings are
+ * shared again; only custom (owned) strings are duplicated. `dest` must not
+ * hold owned strings. Returns false on allocation failure.
+ */
+static bool fossil_tofu_copy_attribute(fossil_tofu_t *dest, const fossil_tofu_t *src) {
+    dest->attribute.required = src->attribute.required;
+    if (!src->attribute.owned) {
+        dest->attribute.name = src->attribute.name;
+        dest->attribute.description = src->attribute.description;
+        dest->attribute.id = src->attribute.id;
+        dest->attribute.owned = false;
+        return true;
+    }
+
+    dest->attribute.name = src->attribute.name ? fossil_tofu_strdup(src->attribute.name) : NULL;
+    dest->attribute.description = src->attribute.description ? fossil_tofu_strdup(src->attribute.description) : NULL;
+    dest->attribute.id = src->attribute.id ? fossil_tofu_strdup(src->attribute.id) : NULL;
+    dest->attribute.owned = true;
+    if ((src->attribute.name && !dest->attribute.name) ||
+        (src->attribute.description && !dest->attribute.description) ||
+        (src->attribute.id && !dest->attribute.id)) {
+        fossil_tofu_release_attribute(dest);
+        return false;
+    }
+    return true;
+}
+
+// Builds a tofu from an already native payload and renders its text form up
+// front, so reading the text later never writes to the object.
+static fossil_tofu_t fossil_tofu_create_native(fossil_tofu_type_t type, fossil_tofu_native_t payload) {
+    fossil_tofu_t tofu = {0};
+    tofu.type = type;
+    fossil_tofu_init_attribute(&tofu);
+    tofu.value.as = payload;
+    tofu.value.native = true;
+    tofu.value.mutable_flag = true;
+    tofu.value.hash = fossil_tofu_hash_native(&tofu);
+
+    // The text is made here rather than on first read: get_value takes a const
+    // object that concurrent readers may share, so it must never write to it.
+    // Everything but a float renders without snprintf and always fits inline.
+    char buf[512];
+    int len = fossil_tofu_render_native(&tofu, buf, sizeof(buf));
+    if (len >= 0) {
+        size_t n = (size_t)len < sizeof(buf) ? (size_t)len : sizeof(buf) - 1;
+        if (!fossil_tofu_assign_text(&tofu, buf, n)) {
+            fprintf(stderr, "Memory allocation failed for value.data\n");
+        }
+    }
+    return tofu;
 }
 
 // *****************************************************************************
@@ -199,58 +649,103 @@ fossil_tofu_t fossil_tofu_create(const char* type, const char* value) {
         type_enum = FOSSIL_TOFU_TYPE_ANY;
     }
 
+    return fossil_tofu_create_typed(type_enum, value);
+}
+
+int fossil_tofu_create_batch(fossil_tofu_type_t type, const char *const *values, size_t count, fossil_tofu_t *out) {
+    if (!values || !out) return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    for (size_t i = 0; i < count; i++) {
+        if (!values[i]) return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
+    }
+    if (type < FOSSIL_TOFU_TYPE_I8 || type > FOSSIL_TOFU_TYPE_ANY) {
+        fprintf(stderr, "Invalid type: %d\n", (int)type);
+        type = FOSSIL_TOFU_TYPE_ANY;
+    }
+
+    // First pass: native and inline payloads, and the size of everything else
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++) {
+        fossil_tofu_t *tofu = &out[i];
+        *tofu = (fossil_tofu_t){0};
+        tofu->type = type;
+        fossil_tofu_parse_native(type, values[i], &tofu->value);
+        size_t len = strlen(values[i]);
+        if (len < FOSSIL_TOFU_SMALL_CAPACITY) {
+            fossil_tofu_assign_text(tofu, values[i], len);
+        } else {
+            tofu->value.length = len;
+            total += len + 1;
+        }
+    }
+
+    // Second pass: copy the long payloads into one shared block
+    fossil_tofu_batch_block_t *block = NULL;
+    if (total > 0) {
+        block = (fossil_tofu_batch_block_t *)fossil_tofu_alloc(sizeof(fossil_tofu_batch_block_t) + total);
+        if (!block) return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    }
+    char *cursor = block ? block->bytes : NULL;
+    size_t refs = 0;
+    for (size_t i = 0; i < count; i++) {
+        fossil_tofu_t *tofu = &out[i];
+        if (tofu->value.length >= FOSSIL_TOFU_SMALL_CAPACITY) {
+            memcpy(cursor, values[i], tofu->value.length + 1);
+            tofu->value.data = cursor;
+            tofu->value.shared = true;
+            tofu->value.block = block;
+            refs++;
+            cursor += tofu->value.length + 1;
+        }
+        tofu->value.mutable_flag = true;
+        tofu->value.hash = fossil_tofu_hash_value(tofu);
+        fossil_tofu_init_attribute(tofu);
+    }
+    if (block) atomic_init(&block->refs, refs);
+
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+fossil_tofu_t fossil_tofu_create_typed(fossil_tofu_type_t type, const char* value) {
+    if (!value) {
+        fprintf(stderr, "Error: NULL argument passed to fossil_tofu_create_typed\n");
+        return (fossil_tofu_t){0};
+    }
+
+    if (type < FOSSIL_TOFU_TYPE_I8 || type > FOSSIL_TOFU_TYPE_ANY) {
+        fprintf(stderr, "Invalid type: %d\n", (int)type);
+        type = FOSSIL_TOFU_TYPE_ANY;
+    }
+
     fossil_tofu_t tofu = {0};
-    tofu.type = type_enum;
-    tofu.value.data = fossil_tofu_strdup(value);
-    if (!tofu.value.data) {
+    tofu.type = type;
+    if (!fossil_tofu_store_text(&tofu, value)) {
         fprintf(stderr, "Memory allocation failed for value.data\n");
-        tofu.value.data = NULL;
-        tofu.attribute.name = NULL;
-        tofu.attribute.description = NULL;
-        tofu.attribute.id = NULL;
         return tofu;
     }
     tofu.value.mutable_flag = true;
-    tofu.value.hash = fossil_tofu_hash64(value);
-
-    tofu.attribute.name = fossil_tofu_strdup(_TOFU_TYPE_NAME[tofu.type]);
-    if (!tofu.attribute.name) {
-        fprintf(stderr, "Memory allocation failed for attribute.name\n");
-        fossil_tofu_free(tofu.value.data);
-        tofu.value.data = NULL;
-        tofu.attribute.name = NULL;
-        tofu.attribute.description = NULL;
-        tofu.attribute.id = NULL;
-        return tofu;
-    }
+    fossil_tofu_init_attribute(&tofu);
 
-    tofu.attribute.description = fossil_tofu_strdup(_TOFU_TYPE_INFO[tofu.type]);
-    if (!tofu.attribute.description) {
-        fprintf(stderr, "Memory allocation failed for attribute.description\n");
-        fossil_tofu_free(tofu.attribute.name);
-        fossil_tofu_free(tofu.value.data);
-        tofu.value.data = NULL;
-        tofu.attribute.name = NULL;
-        tofu.attribute.description = NULL;
-        tofu.attribute.id = NULL;
-        return tofu;
+    return tofu;
+}
+
+fossil_tofu_t fossil_tofu_view_typed(fossil_tofu_type_t type, const char* value) {
+    fossil_tofu_t tofu = {0};
+    if (!value) return tofu;
+    if (type < FOSSIL_TOFU_TYPE_I8 || type > FOSSIL_TOFU_TYPE_ANY) {
+        type = FOSSIL_TOFU_TYPE_ANY;
     }
 
-    tofu.attribute.id = fossil_tofu_strdup(_TOFU_TYPE_ID[tofu.type]);
-    if (!tofu.attribute.id) {
-        fprintf(stderr, "Memory allocation failed for attribute.id\n");
-        fossil_tofu_free(tofu.attribute.description);
-        fossil_tofu_free(tofu.attribute.name);
-        fossil_tofu_free(tofu.value.data);
-        tofu.value.data = NULL;
-        tofu.attribute.name = NULL;
-        tofu.attribute.description = NULL;
-        tofu.attribute.id = NULL;
+    tofu.type = type;
+    fossil_tofu_init_attribute(&tofu);
+    // Parsed the same way as `fossil_tofu_store_text`, so the view hashes and
+    // compares like a stored tofu; the text is borrowed either way
+    tofu.value.data = (char *)value;
+    if (fossil_tofu_parse_native(type, value, &tofu.value)) {
+        tofu.value.hash = fossil_tofu_hash_native(&tofu);
+        tofu.value.length = strlen(value);
         return tofu;
     }
-
-    tofu.attribute.required = false;
-
+    tofu.value.hash = fossil_tofu_hash64_measure(value, &tofu.value.length);
     return tofu;
 }
 
@@ -259,36 +754,14 @@ fossil_tofu_t* fossil_tofu_create_default(void) {
     if (tofu == NULL) return NULL;
 
     tofu->type = FOSSIL_TOFU_TYPE_ANY;
-    tofu->value.data = fossil_tofu_strdup("");
-    if (!tofu->value.data) {
-        fossil_tofu_free(tofu);
-        return NULL;
-    }
+    tofu->value.data = NULL;
+    tofu->value.shared = false;
+    fossil_tofu_assign_text(tofu, "", 0); // Always fits inline
+    tofu->value.native = false;
+    tofu->value.as.u64 = 0;
     tofu->value.mutable_flag = true;
-    tofu->value.hash = fossil_tofu_hash64(tofu->value.data);
-
-    tofu->attribute.name = fossil_tofu_strdup(_TOFU_TYPE_NAME[FOSSIL_TOFU_TYPE_ANY]);
-    if (!tofu->attribute.name) {
-        fossil_tofu_free(tofu->value.data);
-        fossil_tofu_free(tofu);
-        return NULL;
-    }
-    tofu->attribute.description = fossil_tofu_strdup(_TOFU_TYPE_INFO[FOSSIL_TOFU_TYPE_ANY]);
-    if (!tofu->attribute.description) {
-        fossil_tofu_free(tofu->attribute.name);
-        fossil_tofu_free(tofu->value.data);
-        fossil_tofu_free(tofu);
-        return NULL;
-    }
-    tofu->attribute.id = fossil_tofu_strdup(_TOFU_TYPE_ID[FOSSIL_TOFU_TYPE_ANY]);
-    if (!tofu->attribute.id) {
-        fossil_tofu_free(tofu->attribute.description);
-        fossil_tofu_free(tofu->attribute.name);
-        fossil_tofu_free(tofu->value.data);
-        fossil_tofu_free(tofu);
-        return NULL;
-    }
-    tofu->attribute.required = false;
+    tofu->value.hash = fossil_tofu_hash_value(tofu);
+    fossil_tofu_init_attribute(tofu);
 
     return tofu;
 }
@@ -300,43 +773,22 @@ fossil_tofu_t* fossil_tofu_create_copy(const fossil_tofu_t* other) {
     if (tofu == NULL) return NULL;
 
     tofu->type = other->type;
-    tofu->value.data = fossil_tofu_strdup(other->value.data);
-    if (!tofu->value.data) {
-        tofu->attribute.name = NULL;
-        tofu->attribute.description = NULL;
-        tofu->attribute.id = NULL;
+    tofu->value.native = other->value.native;
+    tofu->value.as = other->value.as;
+    if (!fossil_tofu_copy_text(tofu, other) || !fossil_tofu_has_payload(tofu)) {
+        fossil_tofu_free(tofu->value.data);
         fossil_tofu_free(tofu);
         return NULL;
     }
     tofu->value.mutable_flag = other->value.mutable_flag;
     // Recompute hash for safety in case value/data changes
-    tofu->value.hash = fossil_tofu_hash64(tofu->value.data);
+    tofu->value.hash = fossil_tofu_hash_value(tofu);
 
-    tofu->attribute.name = fossil_tofu_strdup(other->attribute.name);
-    if (!tofu->attribute.name) {
-        fossil_tofu_free(tofu->value.data);
-        tofu->attribute.description = NULL;
-        tofu->attribute.id = NULL;
-        fossil_tofu_free(tofu);
-        return NULL;
-    }
-    tofu->attribute.description = fossil_tofu_strdup(other->attribute.description);
-    if (!tofu->attribute.description) {
-        fossil_tofu_free(tofu->attribute.name);
+    if (!fossil_tofu_copy_attribute(tofu, other)) {
         fossil_tofu_free(tofu->value.data);
-        tofu->attribute.id = NULL;
         fossil_tofu_free(tofu);
         return NULL;
     }
-    tofu->attribute.id = fossil_tofu_strdup(other->attribute.id);
-    if (!tofu->attribute.id) {
-        fossil_tofu_free(tofu->attribute.description);
-        fossil_tofu_free(tofu->attribute.name);
-        fossil_tofu_free(tofu->value.data);
-        fossil_tofu_free(tofu);
-        return NULL;
-    }
-    tofu->attribute.required = other->attribute.required;
 
     return tofu;
 }
@@ -352,45 +804,45 @@ fossil_tofu_t* fossil_tofu_create_move(fossil_tofu_t* other) {
     tofu->value.data = other->value.data;
     tofu->value.mutable_flag = other->value.mutable_flag;
     tofu->value.hash = other->value.hash;
+    tofu->value.native = other->value.native;
+    tofu->value.as = other->value.as;
+    tofu->value.small = other->value.small;
+    tofu->value.shared = other->value.shared;
+    tofu->value.length = other->value.length;
+    memcpy(tofu->value.small_data, other->value.small_data, sizeof(tofu->value.small_data)); // Also carries `block`
 
     // Move attribute fields
     tofu->attribute.name = other->attribute.name;
     tofu->attribute.description = other->attribute.description;
     tofu->attribute.id = other->attribute.id;
     tofu->attribute.required = other->attribute.required;
+    tofu->attribute.owned = other->attribute.owned;
 
     // Invalidate the source object (zero out pointers and fields)
     other->type = FOSSIL_TOFU_TYPE_ANY;
     other->value.data = NULL;
     other->value.mutable_flag = false;
     other->value.hash = 0;
+    other->value.native = false;
+    other->value.as.u64 = 0;
+    other->value.small = false;
+    other->value.shared = false;
+    other->value.length = 0;
 
     other->attribute.name = NULL;
     other->attribute.description = NULL;
     other->attribute.id = NULL;
     other->attribute.required = false;
+    other->attribute.owned = false;
 
     return tofu;
 }
 
 void fossil_tofu_destroy(fossil_tofu_t *tofu) {
     if (tofu == NULL) return;
-    if (tofu->value.data) {
-        fossil_tofu_free(tofu->value.data);
-        tofu->value.data = NULL;
-    }
-    if (tofu->attribute.name) {
-        fossil_tofu_free(tofu->attribute.name);
-        tofu->attribute.name = NULL;
-    }
-    if (tofu->attribute.description) {
-        fossil_tofu_free(tofu->attribute.description);
-        tofu->attribute.description = NULL;
-    }
-    if (tofu->attribute.id) {
-        fossil_tofu_free(tofu->attribute.id);
-        tofu->attribute.id = NULL;
-    }
+    fossil_tofu_release_text(tofu);
+    tofu->value.native = false;
+    fossil_tofu_release_attribute(tofu);
 }
 
 // *****************************************************************************
@@ -398,13 +850,40 @@ void fossil_tofu_destroy(fossil_tofu_t *tofu) {
 // *****************************************************************************
 
 int fossil_tofu_compare(const fossil_tofu_t *tofu1, const fossil_tofu_t *tofu2) {
-    if (tofu1 == NULL || tofu2 == NULL || tofu1->value.data == NULL || tofu2->value.data == NULL)
+    if (tofu1 == NULL || tofu2 == NULL || !fossil_tofu_has_payload(tofu1) || !fossil_tofu_has_payload(tofu2))
         return 0;
 
     if (tofu1->type != tofu2->type) {
         return (int)tofu1->type - (int)tofu2->type;
     }
 
+    // Both payloads stored in place: compare without parsing
+    if (tofu1->value.native && tofu2->value.native) {
+        const fossil_tofu_native_t *a = &tofu1->value.as;
+        const fossil_tofu_native_t *b = &tofu2->value.as;
+        if (fossil_tofu_is_signed_type(tofu1->type)) {
+            return (a->i64 > b->i64) - (a->i64 < b->i64);
+        }
+        if (fossil_tofu_is_unsigned_type(tofu1->type)) {
+            return (a->u64 > b->u64) - (a->u64 < b->u64);
+        }
+        if (fossil_tofu_is_float_type(tofu1->type)) {
+            return (a->f64 > b->f64) - (a->f64 < b->f64);
+        }
+        if (tofu1->type == FOSSIL_TOFU_TYPE_BOOL) {
+            // Matches the textual ordering of "false" < "true"
+            return (int)a->b - (int)b->b;
+        }
+        if (tofu1->type == FOSSIL_TOFU_TYPE_CCHAR) {
+            return (int)(unsigned char)a->c - (int)(unsigned char)b->c;
+        }
+    }
+
+    const char *text1 = fossil_tofu_get_value(tofu1);
+    const char *text2 = fossil_tofu_get_value(tofu2);
+    if (text1 == NULL || text2 == NULL)
+        return 0;
+
     // Numeric comparison for integer types
     switch (tofu1->type) {
         case FOSSIL_TOFU_TYPE_I8:
@@ -416,20 +895,16 @@ int fossil_tofu_compare(const fossil_tofu_t *tofu1, const fossil_tofu_t *tofu2)
         case FOSSIL_TOFU_TYPE_U32:
         case FOSSIL_TOFU_TYPE_U64: {
             // Use strtoll/strtoull for signed/unsigned
-            int is_signed =
-                tofu1->type == FOSSIL_TOFU_TYPE_I8 ||
-                tofu1->type == FOSSIL_TOFU_TYPE_I16 ||
-                tofu1->type == FOSSIL_TOFU_TYPE_I32 ||
-                tofu1->type == FOSSIL_TOFU_TYPE_I64;
+            int is_signed = fossil_tofu_is_signed_type(tofu1->type);
             if (is_signed) {
-                long long v1 = strtoll(tofu1->value.data, NULL, 10);
-                long long v2 = strtoll(tofu2->value.data, NULL, 10);
+                long long v1 = strtoll(text1, NULL, 10);
+                long long v2 = strtoll(text2, NULL, 10);
                 if (v1 < v2) return -1;
                 if (v1 > v2) return 1;
                 return 0;
             } else {
-                unsigned long long v1 = strtoull(tofu1->value.data, NULL, 10);
-                unsigned long long v2 = strtoull(tofu2->value.data, NULL, 10);
+                unsigned long long v1 = strtoull(text1, NULL, 10);
+                unsigned long long v2 = strtoull(text2, NULL, 10);
                 if (v1 < v2) return -1;
                 if (v1 > v2) return 1;
                 return 0;
@@ -437,15 +912,15 @@ int fossil_tofu_compare(const fossil_tofu_t *tofu1, const fossil_tofu_t *tofu2)
         }
         case FOSSIL_TOFU_TYPE_F32:
         case FOSSIL_TOFU_TYPE_F64: {
-            double v1 = strtod(tofu1->value.data, NULL);
-            double v2 = strtod(tofu2->value.data, NULL);
+            double v1 = strtod(text1, NULL);
+            double v2 = strtod(text2, NULL);
             if (v1 < v2) return -1;
             if (v1 > v2) return 1;
             return 0;
         }
         default:
             // Fallback to string comparison
-            return strcmp(tofu1->value.data, tofu2->value.data);
+            return strcmp(text1, text2);
     }
 }
 
@@ -454,15 +929,19 @@ int fossil_tofu_set_value(fossil_tofu_t *tofu, char *value) {
     if (!tofu->value.mutable_flag) return FOSSIL_TOFU_ERROR_IMMUTABLE;
     if (value == NULL) return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
 
-    fossil_tofu_free(tofu->value.data);
-    tofu->value.data = fossil_tofu_strdup(value);
-    if (!tofu->value.data) return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    if (!fossil_tofu_store_text(tofu, value)) return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
     return FOSSIL_TOFU_SUCCESS;
 }
 
 char *fossil_tofu_get_value(const fossil_tofu_t *tofu) {
     if (tofu == NULL) return NULL;
-    return tofu->value.data;
+    // Every payload carries its text form from creation, so this only reads
+    return (char *)fossil_tofu_text(tofu);
+}
+
+size_t fossil_tofu_get_length(const fossil_tofu_t *tofu) {
+    if (fossil_tofu_get_value(tofu) == NULL) return 0;
+    return tofu->value.length;
 }
 
 bool fossil_tofu_is_mutable(const fossil_tofu_t *tofu) {
@@ -496,8 +975,9 @@ const char* fossil_tofu_type_info(fossil_tofu_type_t type) {
 void fossil_tofu_display(const fossil_tofu_t *tofu) {
     if (tofu == NULL) return;
 
+    const char *value = fossil_tofu_get_value(tofu);
     printf("Type: %s\n", fossil_tofu_type_name(tofu->type));
-    printf("Value: %s\n", tofu->value.data ? tofu->value.data : "(null)");
+    printf("Value: %s\n", value ? value : "(null)");
     printf("Attribute Name: %s\n", tofu->attribute.name ? tofu->attribute.name : "(null)");
     printf("Description: %s\n", tofu->attribute.description ? tofu->attribute.description : "(null)");
     printf("ID: %s\n", tofu->attribute.id ? tofu->attribute.id : "(null)");
@@ -506,16 +986,24 @@ void fossil_tofu_display(const fossil_tofu_t *tofu) {
 int fossil_tofu_set_attribute(fossil_tofu_t *tofu, const char *name, const char *description, const char *id) {
     if (tofu == NULL) return FOSSIL_TOFU_ERROR_NULL_POINTER;
 
-    fossil_tofu_free(tofu->attribute.name);
-    fossil_tofu_free(tofu->attribute.description);
-    fossil_tofu_free(tofu->attribute.id);
+    // Custom attributes are the only ones that allocate (copy-on-write)
+    char *new_name = fossil_tofu_strdup(name);
+    char *new_description = fossil_tofu_strdup(description);
+    char *new_id = fossil_tofu_strdup(id);
+    if (!new_name || !new_description || !new_id) {
+        fossil_tofu_free(new_name);
+        fossil_tofu_free(new_description);
+        fossil_tofu_free(new_id);
+        return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    }
 
-    tofu->attribute.name = fossil_tofu_strdup(name);
-    if (!tofu->attribute.name) return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
-    tofu->attribute.description = fossil_tofu_strdup(description);
-    if (!tofu->attribute.description) return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
-    tofu->attribute.id = fossil_tofu_strdup(id);
-    if (!tofu->attribute.id) return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    bool required = tofu->attribute.required;
+    fossil_tofu_release_attribute(tofu);
+    tofu->attribute.name = new_name;
+    tofu->attribute.description = new_description;
+    tofu->attribute.id = new_id;
+    tofu->attribute.required = required;
+    tofu->attribute.owned = true;
 
     return FOSSIL_TOFU_SUCCESS;
 }
@@ -527,38 +1015,41 @@ const fossil_tofu_attribute_t* fossil_tofu_get_attribute(const fossil_tofu_t *to
 bool fossil_tofu_equals(const fossil_tofu_t *tofu1, const fossil_tofu_t *tofu2) {
     if (tofu1 == NULL || tofu2 == NULL) return false;
 
-    return tofu1->type == tofu2->type &&
-           strcmp(tofu1->value.data, tofu2->value.data) == 0;
+    if (tofu1->type != tofu2->type) return false;
+    // Equal payloads always hash alike, so a mismatch rejects without touching them
+    if (tofu1->value.hash != tofu2->value.hash) return false;
+    if (tofu1->value.native != tofu2->value.native) return false;
+    if (tofu1->value.native) {
+        return fossil_tofu_compare(tofu1, tofu2) == 0;
+    }
+    const char *text1 = fossil_tofu_text(tofu1);
+    const char *text2 = fossil_tofu_text(tofu2);
+    if (text1 == NULL || text2 == NULL) {
+        return text1 == text2;
+    }
+    return tofu1->value.length == tofu2->value.length &&
+           memcmp(text1, text2, tofu1->value.length) == 0;
 }
 
 int fossil_tofu_copy(fossil_tofu_t *dest, const fossil_tofu_t *src) {
     if (dest == NULL || src == NULL) return FOSSIL_TOFU_ERROR_NULL_POINTER;
 
     // Free existing strings in dest to avoid memory leaks
-    fossil_tofu_free(dest->value.data);
-    fossil_tofu_free(dest->attribute.name);
-    fossil_tofu_free(dest->attribute.description);
-    fossil_tofu_free(dest->attribute.id);
+    fossil_tofu_release_text(dest);
+    fossil_tofu_release_attribute(dest);
 
     dest->type = src->type;
 
-    dest->value.data = fossil_tofu_strdup(src->value.data);
-    if (!dest->value.data && src->value.data)
+    dest->value.native = src->value.native;
+    dest->value.as = src->value.as;
+    if (!fossil_tofu_copy_text(dest, src))
         return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
     dest->value.mutable_flag = src->value.mutable_flag;
     // Recompute hash for safety in case value/data changes
-    dest->value.hash = fossil_tofu_hash64(dest->value.data);
+    dest->value.hash = fossil_tofu_hash_value(dest);
 
-    dest->attribute.name = fossil_tofu_strdup(src->attribute.name);
-    if (!dest->attribute.name && src->attribute.name)
-        return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
-    dest->attribute.description = fossil_tofu_strdup(src->attribute.description);
-    if (!dest->attribute.description && src->attribute.description)
+    if (!fossil_tofu_copy_attribute(dest, src))
         return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
-    dest->attribute.id = fossil_tofu_strdup(src->attribute.id);
-    if (!dest->attribute.id && src->attribute.id)
-        return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
-    dest->attribute.required = src->attribute.required;
 
     return FOSSIL_TOFU_SUCCESS;
 }
@@ -584,14 +1075,15 @@ char* fossil_tofu_serialize(const fossil_tofu_t *tofu) {
     const char *type_id = fossil_tofu_type_name(tofu->type);
     if (!type_id) type_id = "any";
 
-    const char *val = tofu->value.data ? tofu->value.data : "";
+    const char *val = fossil_tofu_get_value(tofu);
+    if (!val) val = "";
     const char *name = tofu->attribute.name ? tofu->attribute.name : "";
     const char *desc = tofu->attribute.description ? tofu->attribute.description : "";
     const char *id = tofu->attribute.id ? tofu->attribute.id : "";
 
     // Estimate buffer size
-    size_t buf_size = strlen(type_id) + strlen(val) + strlen(name) + strlen(desc) + strlen(id) + 256;
-    char *fson = (char *)malloc(buf_size);
+    size_t buf_size = strlen(type_id) + fossil_tofu_get_length(tofu) + strlen(name) + strlen(desc) + strlen(id) + 256;
+    char *fson = (char *)fossil_tofu_alloc(buf_size);
     if (!fson) return NULL;
 
     snprintf(fson, buf_size,
@@ -688,9 +1180,11 @@ void fossil_tofu_dump(const fossil_tofu_t *tofu) {
 
     printf("Tofu Dump:\n");
     printf("  Type: %s (%d)\n", fossil_tofu_type_name(tofu->type), tofu->type);
-    printf("  Value: %s\n", tofu->value.data ? tofu->value.data : "(null)");
+    const char *value = fossil_tofu_get_value(tofu);
+    printf("  Value: %s\n", value ? value : "(null)");
     printf("  Value Hash: 0x%016llx\n", (unsigned long long)tofu->value.hash);
     printf("  Mutable: %s\n", tofu->value.mutable_flag ? "true" : "false");
+    printf("  Native: %s\n", tofu->value.native ? "true" : "false");
     printf("  Attribute Name: %s\n", tofu->attribute.name ? tofu->attribute.name : "(null)");
     printf("  Description: %s\n", tofu->attribute.description ? tofu->attribute.description : "(null)");
     printf("  ID: %s\n", tofu->attribute.id ? tofu->attribute.id : "(null)");
@@ -698,12 +1192,14 @@ void fossil_tofu_dump(const fossil_tofu_t *tofu) {
 }
 
 const char* fossil_tofu_get_value_or_default(const fossil_tofu_t *tofu, const char *default_value) {
-    if (!tofu || !tofu->value.data) return default_value;
-    return tofu->value.data;
+    const char *value = fossil_tofu_get_value(tofu);
+    return value ? value : default_value;
 }
 
 bool fossil_tofu_is_empty(const fossil_tofu_t *tofu) {
-    return (!tofu || !tofu->value.data || tofu->value.data[0] == '\0');
+    if (!tofu) return true;
+    if (tofu->value.native) return false;
+    return fossil_tofu_text(tofu) == NULL || tofu->value.length == 0;
 }
 
 fossil_tofu_t* fossil_tofu_clone(const fossil_tofu_t *tofu) {
@@ -713,14 +1209,20 @@ fossil_tofu_t* fossil_tofu_clone(const fossil_tofu_t *tofu) {
     if (!clone) return NULL;
 
     clone->type = tofu->type;
-    clone->value.data = tofu->value.data ? fossil_tofu_strdup(tofu->value.data) : NULL;
+    if (!fossil_tofu_copy_text(clone, tofu)) {
+        fossil_tofu_free(clone);
+        return NULL;
+    }
+    clone->value.native = tofu->value.native;
+    clone->value.as = tofu->value.as;
     clone->value.mutable_flag = tofu->value.mutable_flag;
     clone->value.hash = tofu->value.hash;
 
-    clone->attribute.name = tofu->attribute.name ? fossil_tofu_strdup(tofu->attribute.name) : NULL;
-    clone->attribute.description = tofu->attribute.description ? fossil_tofu_strdup(tofu->attribute.description) : NULL;
-    clone->attribute.id = tofu->attribute.id ? fossil_tofu_strdup(tofu->attribute.id) : NULL;
-    clone->attribute.required = tofu->attribute.required;
+    if (!fossil_tofu_copy_attribute(clone, tofu)) {
+        fossil_tofu_free(clone->value.data);
+        fossil_tofu_free(clone);
+        return NULL;
+    }
 
     return clone;
 }
@@ -736,96 +1238,120 @@ int fossil_tofu_lock(fossil_tofu_t *tofu) {
 // *****************************************************************************
 
 int8_t fossil_tofu_as_i8(const fossil_tofu_t *tofu) {
-    if (!tofu || !tofu->value.data) return 0;
-    return (int8_t)strtol(tofu->value.data, NULL, 10);
+    if (!tofu) return 0;
+    if (tofu->value.native && fossil_tofu_is_signed_type(tofu->type)) return (int8_t)tofu->value.as.i64;
+    const char *text = fossil_tofu_get_value(tofu);
+    if (!text) return 0;
+    return (int8_t)strtol(text, NULL, 10);
 }
 
 fossil_tofu_t fossil_tofu_from_i8(int8_t value) {
-    char buf[8];
-    snprintf(buf, sizeof(buf), "%d", value);
-    return fossil_tofu_create("i8", buf);
+    fossil_tofu_native_t payload = {0};
+    payload.i64 = value;
+    return fossil_tofu_create_native(FOSSIL_TOFU_TYPE_I8, payload);
 }
 
 int16_t fossil_tofu_as_i16(const fossil_tofu_t *tofu) {
-    if (!tofu || !tofu->value.data) return 0;
-    return (int16_t)strtol(tofu->value.data, NULL, 10);
+    if (!tofu) return 0;
+    if (tofu->value.native && fossil_tofu_is_signed_type(tofu->type)) return (int16_t)tofu->value.as.i64;
+    const char *text = fossil_tofu_get_value(tofu);
+    if (!text) return 0;
+    return (int16_t)strtol(text, NULL, 10);
 }
 
 fossil_tofu_t fossil_tofu_from_i16(int16_t value) {
-    char buf[16];
-    snprintf(buf, sizeof(buf), "%d", value);
-    return fossil_tofu_create("i16", buf);
+    fossil_tofu_native_t payload = {0};
+    payload.i64 = value;
+    return fossil_tofu_create_native(FOSSIL_TOFU_TYPE_I16, payload);
 }
 
 int32_t fossil_tofu_as_i32(const fossil_tofu_t *tofu) {
-    if (!tofu || !tofu->value.data) return 0;
-    return (int32_t)strtol(tofu->value.data, NULL, 10);
+    if (!tofu) return 0;
+    if (tofu->value.native && fossil_tofu_is_signed_type(tofu->type)) return (int32_t)tofu->value.as.i64;
+    const char *text = fossil_tofu_get_value(tofu);
+    if (!text) return 0;
+    return (int32_t)strtol(text, NULL, 10);
 }
 
 fossil_tofu_t fossil_tofu_from_i32(int32_t value) {
-    char buf[24];
-    snprintf(buf, sizeof(buf), "%d", value);
-    return fossil_tofu_create("i32", buf);
+    fossil_tofu_native_t payload = {0};
+    payload.i64 = value;
+    return fossil_tofu_create_native(FOSSIL_TOFU_TYPE_I32, payload);
 }
 
 int64_t fossil_tofu_as_i64(const fossil_tofu_t *tofu) {
-    if (!tofu || !tofu->value.data) return 0;
-    return (int64_t)strtoll(tofu->value.data, NULL, 10);
+    if (!tofu) return 0;
+    if (tofu->value.native && fossil_tofu_is_signed_type(tofu->type)) return (int64_t)tofu->value.as.i64;
+    const char *text = fossil_tofu_get_value(tofu);
+    if (!text) return 0;
+    return (int64_t)strtoll(text, NULL, 10);
 }
 
 fossil_tofu_t fossil_tofu_from_i64(int64_t value) {
-    char buf[32];
-    snprintf(buf, sizeof(buf), "%lld", (long long)value);
-    return fossil_tofu_create("i64", buf);
+    fossil_tofu_native_t payload = {0};
+    payload.i64 = value;
+    return fossil_tofu_create_native(FOSSIL_TOFU_TYPE_I64, payload);
 }
 
 uint8_t fossil_tofu_as_u8(const fossil_tofu_t *tofu) {
-    if (!tofu || !tofu->value.data) return 0;
-    return (uint8_t)strtoul(tofu->value.data, NULL, 10);
+    if (!tofu) return 0;
+    if (tofu->value.native && fossil_tofu_is_unsigned_type(tofu->type)) return (uint8_t)tofu->value.as.u64;
+    const char *text = fossil_tofu_get_value(tofu);
+    if (!text) return 0;
+    return (uint8_t)strtoul(text, NULL, 10);
 }
 
 fossil_tofu_t fossil_tofu_from_u8(uint8_t value) {
-    char buf[8];
-    snprintf(buf, sizeof(buf), "%u", value);
-    return fossil_tofu_create("u8", buf);
+    fossil_tofu_native_t payload = {0};
+    payload.u64 = value;
+    return fossil_tofu_create_native(FOSSIL_TOFU_TYPE_U8, payload);
 }
 
 uint16_t fossil_tofu_as_u16(const fossil_tofu_t *tofu) {
-    if (!tofu || !tofu->value.data) return 0;
-    return (uint16_t)strtoul(tofu->value.data, NULL, 10);
+    if (!tofu) return 0;
+    if (tofu->value.native && fossil_tofu_is_unsigned_type(tofu->type)) return (uint16_t)tofu->value.as.u64;
+    const char *text = fossil_tofu_get_value(tofu);
+    if (!text) return 0;
+    return (uint16_t)strtoul(text, NULL, 10);
 }
 
 fossil_tofu_t fossil_tofu_from_u16(uint16_t value) {
-    char buf[16];
-    snprintf(buf, sizeof(buf), "%u", value);
-    return fossil_tofu_create("u16", buf);
+    fossil_tofu_native_t payload = {0};
+    payload.u64 = value;
+    return fossil_tofu_create_native(FOSSIL_TOFU_TYPE_U16, payload);
 }
 
 uint32_t fossil_tofu_as_u32(const fossil_tofu_t *tofu) {
-    if (!tofu || !tofu->value.data) return 0;
-    return (uint32_t)strtoul(tofu->value.data, NULL, 10);
+    if (!tofu) return 0;
+    if (tofu->value.native && fossil_tofu_is_unsigned_type(tofu->type)) return (uint32_t)tofu->value.as.u64;
+    const char *text = fossil_tofu_get_value(tofu);
+    if (!text) return 0;
+    return (uint32_t)strtoul(text, NULL, 10);
 }
 
 fossil_tofu_t fossil_tofu_from_u32(uint32_t value) {
-    char buf[24];
-    snprintf(buf, sizeof(buf), "%u", value);
-    return fossil_tofu_create("u32", buf);
+    fossil_tofu_native_t payload = {0};
+    payload.u64 = value;
+    return fossil_tofu_create_native(FOSSIL_TOFU_TYPE_U32, payload);
 }
 
 uint64_t fossil_tofu_as_u64(const fossil_tofu_t *tofu) {
-    if (!tofu || !tofu->value.data) return 0;
-    return (uint64_t)strtoull(tofu->value.data, NULL, 10);
+    if (!tofu) return 0;
+    if (tofu->value.native && fossil_tofu_is_unsigned_type(tofu->type)) return (uint64_t)tofu->value.as.u64;
+    const char *text = fossil_tofu_get_value(tofu);
+    if (!text) return 0;
+    return (uint64_t)strtoull(text, NULL, 10);
 }
 
 fossil_tofu_t fossil_tofu_from_u64(uint64_t value) {
-    char buf[32];
-    snprintf(buf, sizeof(buf), "%llu", (unsigned long long)value);
-    return fossil_tofu_create("u64", buf);
+    fossil_tofu_native_t payload = {0};
+    payload.u64 = value;
+    return fossil_tofu_create_native(FOSSIL_TOFU_TYPE_U64, payload);
 }
 
 const char* fossil_tofu_as_hex(const fossil_tofu_t *tofu) {
-    if (!tofu || !tofu->value.data) return NULL;
-    return tofu->value.data;
+    if (!tofu) return NULL;
+    return fossil_tofu_get_value(tofu);
 }
 
 fossil_tofu_t fossil_tofu_from_hex(const char *hex_str) {
@@ -833,8 +1359,8 @@ fossil_tofu_t fossil_tofu_from_hex(const char *hex_str) {
 }
 
 const char* fossil_tofu_as_oct(const fossil_tofu_t *tofu) {
-    if (!tofu || !tofu->value.data) return NULL;
-    return tofu->value.data;
+    if (!tofu) return NULL;
+    return fossil_tofu_get_value(tofu);
 }
 
 fossil_tofu_t fossil_tofu_from_oct(const char *oct_str) {
@@ -842,8 +1368,8 @@ fossil_tofu_t fossil_tofu_from_oct(const char *oct_str) {
 }
 
 const char* fossil_tofu_as_bin(const fossil_tofu_t *tofu) {
-    if (!tofu || !tofu->value.data) return NULL;
-    return tofu->value.data;
+    if (!tofu) return NULL;
+    return fossil_tofu_get_value(tofu);
 }
 
 fossil_tofu_t fossil_tofu_from_bin(const char *bin_str) {
@@ -851,34 +1377,38 @@ fossil_tofu_t fossil_tofu_from_bin(const char *bin_str) {
 }
 
 float fossil_tofu_as_f32(const fossil_tofu_t *tofu) {
-    if (!tofu || !tofu->value.data) return 0.0f;
-    return (float)strtof(tofu->value.data, NULL);
+    if (!tofu) return 0.0f;
+    if (tofu->value.native && fossil_tofu_is_float_type(tofu->type)) return (float)tofu->value.as.f64;
+    const char *text = fossil_tofu_get_value(tofu);
+    if (!text) return 0.0f;
+    return (float)strtof(text, NULL);
 }
 
 fossil_tofu_t fossil_tofu_from_f32(float value) {
-    char buf[32];
-    snprintf(buf, sizeof(buf), "%f", value);
-    return fossil_tofu_create("f32", buf);
+    fossil_tofu_native_t payload = {0};
+    payload.f64 = value;
+    return fossil_tofu_create_native(FOSSIL_TOFU_TYPE_F32, payload);
 }
 
 double fossil_tofu_as_f64(const fossil_tofu_t *tofu) {
-    if (!tofu || !tofu->value.data) return 0.0;
+    if (!tofu || !fossil_tofu_has_payload(tofu)) return 0.0;
     // Only parse as double if type is F64, otherwise fallback to strtod
     if (tofu->type == FOSSIL_TOFU_TYPE_F64) {
-        return strtod(tofu->value.data, NULL);
+        if (tofu->value.native) return tofu->value.as.f64;
+        return strtod(fossil_tofu_text(tofu), NULL);
     }
     return 0.0;
 }
 
 fossil_tofu_t fossil_tofu_from_f64(double value) {
-    char buf[48];
-    snprintf(buf, sizeof(buf), "%lf", value);
-    return fossil_tofu_create("f64", buf);
+    fossil_tofu_native_t payload = {0};
+    payload.f64 = value;
+    return fossil_tofu_create_native(FOSSIL_TOFU_TYPE_F64, payload);
 }
 
 const char* fossil_tofu_as_cstr(const fossil_tofu_t *tofu) {
-    if (!tofu || !tofu->value.data) return NULL;
-    return tofu->value.data;
+    if (!tofu) return NULL;
+    return fossil_tofu_get_value(tofu);
 }
 
 fossil_tofu_t fossil_tofu_from_cstr(const char *str) {
@@ -886,8 +1416,11 @@ fossil_tofu_t fossil_tofu_from_cstr(const char *str) {
 }
 
 char fossil_tofu_as_char(const fossil_tofu_t *tofu) {
-    if (!tofu || !tofu->value.data || tofu->value.data[0] == '\0') return '\0';
-    return tofu->value.data[0];
+    if (!tofu) return '\0';
+    if (tofu->value.native && tofu->type == FOSSIL_TOFU_TYPE_CCHAR) return tofu->value.as.c;
+    const char *value = fossil_tofu_get_value(tofu);
+    if (!value || value[0] == '\0') return '\0';
+    return value[0];
 }
 
 fossil_tofu_t fossil_tofu_from_char(char value) {
@@ -896,30 +1429,38 @@ fossil_tofu_t fossil_tofu_from_char(char value) {
 }
 
 bool fossil_tofu_as_bool(const fossil_tofu_t *tofu) {
-    if (!tofu || !tofu->value.data) return false;
-    if (strcmp(tofu->value.data, "true") == 0 || strcmp(tofu->value.data, "1") == 0)
+    if (!tofu) return false;
+    if (tofu->value.native && tofu->type == FOSSIL_TOFU_TYPE_BOOL) return tofu->value.as.b;
+    const char *text = fossil_tofu_get_value(tofu);
+    if (!text) return false;
+    if (strcmp(text, "true") == 0 || strcmp(text, "1") == 0)
         return true;
     return false;
 }
 
 fossil_tofu_t fossil_tofu_from_bool(bool value) {
-    return fossil_tofu_create("bool", value ? "true" : "false");
+    fossil_tofu_native_t payload = {0};
+    payload.b = value;
+    return fossil_tofu_create_native(FOSSIL_TOFU_TYPE_BOOL, payload);
 }
 
 size_t fossil_tofu_as_size(const fossil_tofu_t *tofu) {
-    if (!tofu || !tofu->value.data) return 0;
-    return (size_t)strtoull(tofu->value.data, NULL, 10);
+    if (!tofu) return 0;
+    if (tofu->value.native && fossil_tofu_is_unsigned_type(tofu->type)) return (size_t)tofu->value.as.u64;
+    const char *text = fossil_tofu_get_value(tofu);
+    if (!text) return 0;
+    return (size_t)strtoull(text, NULL, 10);
 }
 
 fossil_tofu_t fossil_tofu_from_size(size_t value) {
-    char buf[32];
-    snprintf(buf, sizeof(buf), "%zu", value);
-    return fossil_tofu_create("size", buf);
+    fossil_tofu_native_t payload = {0};
+    payload.u64 = value;
+    return fossil_tofu_create_native(FOSSIL_TOFU_TYPE_SIZE, payload);
 }
 
 const char* fossil_tofu_as_datetime(const fossil_tofu_t *tofu) {
-    if (!tofu || !tofu->value.data) return NULL;
-    return tofu->value.data;
+    if (!tofu) return NULL;
+    return fossil_tofu_get_value(tofu);
 }
 
 fossil_tofu_t fossil_tofu_from_datetime(const char *datetime_str) {
@@ -927,8 +1468,8 @@ fossil_tofu_t fossil_tofu_from_datetime(const char *datetime_str) {
 }
 
 const char* fossil_tofu_as_duration(const fossil_tofu_t *tofu) {
-    if (!tofu || !tofu->value.data) return NULL;
-    return tofu->value.data;
+    if (!tofu) return NULL;
+    return fossil_tofu_get_value(tofu);
 }
 
 fossil_tofu_t fossil_tofu_from_duration(const char *duration_str) {
@@ -936,8 +1477,8 @@ fossil_tofu_t fossil_tofu_from_duration(const char *duration_str) {
 }
 
 void* fossil_tofu_as_any(const fossil_tofu_t *tofu) {
-    if (!tofu || !tofu->value.data) return NULL;
-    return (void*)tofu->value.data;
+    if (!tofu) return NULL;
+    return (void*)fossil_tofu_get_value(tofu);
 }
 
 fossil_tofu_t fossil_tofu_from_any(void *data, size_t size) {
@@ -957,13 +1498,84 @@ fossil_tofu_t fossil_tofu_from_any(void *data, size_t size) {
 // Memory management functions
 // *****************************************************************************
 
+static tofu_memory_t fossil_tofu_default_alloc(void *context, size_t size) {
+    (void)context;
+    return malloc(size);
+}
+
+static tofu_memory_t fossil_tofu_default_realloc(void *context, tofu_memory_t ptr, size_t size) {
+    (void)context;
+    return realloc(ptr, size);
+}
+
+static void fossil_tofu_default_free(void *context, tofu_memory_t ptr) {
+    (void)context;
+    free(ptr);
+}
+
+static const fossil_tofu_allocator_t _TOFU_DEFAULT_ALLOCATOR = {
+    fossil_tofu_default_alloc,
+    fossil_tofu_default_realloc,
+    fossil_tofu_default_free,
+    NULL
+};
+
+#if defined(_MSC_VER)
+#define FOSSIL_TOFU_THREAD_LOCAL __declspec(thread)
+#else
+#define FOSSIL_TOFU_THREAD_LOCAL _Thread_local
+#endif
+
+static fossil_tofu_allocator_t _tofu_global_allocator = {
+    fossil_tofu_default_alloc,
+    fossil_tofu_default_realloc,
+    fossil_tofu_default_free,
+    NULL
+};
+static FOSSIL_TOFU_THREAD_LOCAL fossil_tofu_allocator_t _tofu_thread_allocator;
+static FOSSIL_TOFU_THREAD_LOCAL bool _tofu_thread_allocator_set = false;
+
+static bool fossil_tofu_allocator_is_complete(const fossil_tofu_allocator_t *allocator) {
+    return allocator->alloc && allocator->realloc && allocator->free;
+}
+
+int fossil_tofu_set_allocator(const fossil_tofu_allocator_t *allocator) {
+    if (allocator == NULL) {
+        _tofu_global_allocator = _TOFU_DEFAULT_ALLOCATOR;
+        return FOSSIL_TOFU_SUCCESS;
+    }
+    if (!fossil_tofu_allocator_is_complete(allocator)) return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
+    _tofu_global_allocator = *allocator;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int fossil_tofu_set_thread_allocator(const fossil_tofu_allocator_t *allocator) {
+    if (allocator == NULL) {
+        _tofu_thread_allocator_set = false;
+        return FOSSIL_TOFU_SUCCESS;
+    }
+    if (!fossil_tofu_allocator_is_complete(allocator)) return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
+    _tofu_thread_allocator = *allocator;
+    _tofu_thread_allocator_set = true;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+const fossil_tofu_allocator_t *fossil_tofu_get_allocator(void) {
+    return _tofu_thread_allocator_set ? &_tofu_thread_allocator : &_tofu_global_allocator;
+}
+
+const fossil_tofu_allocator_t *fossil_tofu_get_thread_allocator(void) {
+    return _tofu_thread_allocator_set ? &_tofu_thread_allocator : NULL;
+}
+
 tofu_memory_t fossil_tofu_alloc(size_t size) {
     if (size == 0) {
         fprintf(stderr, "Error: Cannot allocate zero bytes\n");
         return NULL;
     }
 
-    tofu_memory_t ptr = malloc(size);
+    const fossil_tofu_allocator_t *allocator = fossil_tofu_get_allocator();
+    tofu_memory_t ptr = allocator->alloc(allocator->context, size);
     if (!ptr) {
         fprintf(stderr, "Error: Memory allocation failed\n");
         return NULL;
@@ -978,7 +1590,8 @@ tofu_memory_t fossil_tofu_realloc(tofu_memory_t ptr, size_t size) {
         return NULL;
     }
 
-    tofu_memory_t new_ptr = realloc(ptr, size);
+    const fossil_tofu_allocator_t *allocator = fossil_tofu_get_allocator();
+    tofu_memory_t new_ptr = allocator->realloc(allocator->context, ptr, size);
     if (!new_ptr) {
         fprintf(stderr, "Error: Memory reallocation failed\n");
         return NULL; // Return NULL if reallocation fails
@@ -989,7 +1602,8 @@ tofu_memory_t fossil_tofu_realloc(tofu_memory_t ptr, size_t size) {
 
 void fossil_tofu_free(tofu_memory_t ptr) {
     if (ptr) {
-        free(ptr);
+        const fossil_tofu_allocator_t *allocator = fossil_tofu_get_allocator();
+        allocator->free(allocator->context, ptr);
     }
 } // end of fun
 
@@ -999,8 +1613,7 @@ char* fossil_tofu_strdup(const char* str) {
         return NULL; // Handle NULL pointer gracefully
     }
 
-    size_t len = 0;
-    while (str[len] != '\0') len++; // Calculate the length of the string
+    size_t len = strlen(str); // Calculate the length of the string
 
     char* dup = fossil_tofu_alloc((len + 1) * sizeof(char)); // Allocate memory for the duplicate string
     if (!dup) {
@@ -1008,10 +1621,7 @@ char* fossil_tofu_strdup(const char* str) {
         return NULL; // Return NULL if allocation fails
     }
 
-    for (size_t i = 0; i < len; i++) {
-        dup[i] = str[i]; // Copy each character from the original string to the duplicate
-    }
-    dup[len] = '\0'; // Add null terminator to the end of the duplicate string
+    memcpy(dup, str, len + 1); // Copy the string including its null terminator
 
     return dup;
 } // end of fun
@@ -24,6 +24,88 @@
  */
 #include "fossil/tofu/tree.h"
 
+// *****************************************************************************
+// Balancing helpers
+// *****************************************************************************
+
+static inline int fossil_tofu_tree_node_height(const fossil_tofu_tree_node_t *node) {
+    return node ? node->height : 0;
+}
+
+static inline size_t fossil_tofu_tree_node_count(const fossil_tofu_tree_node_t *node) {
+    return node ? node->count : 0;
+}
+
+// Recomputes the height and subtree size of `node` from its children.
+static inline void fossil_tofu_tree_update_node(fossil_tofu_tree_node_t *node) {
+    int left = fossil_tofu_tree_node_height(node->left);
+    int right = fossil_tofu_tree_node_height(node->right);
+    node->height = 1 + (left > right ? left : right);
+    node->count = 1 + fossil_tofu_tree_node_count(node->left) + fossil_tofu_tree_node_count(node->right);
+}
+
+static fossil_tofu_tree_node_t* fossil_tofu_tree_rotate_left(fossil_tofu_tree_node_t *node) {
+    fossil_tofu_tree_node_t *pivot = node->right;
+    node->right = pivot->left;
+    pivot->left = node;
+    fossil_tofu_tree_update_node(node);
+    fossil_tofu_tree_update_node(pivot);
+    return pivot;
+}
+
+static fossil_tofu_tree_node_t* fossil_tofu_tree_rotate_right(fossil_tofu_tree_node_t *node) {
+    fossil_tofu_tree_node_t *pivot = node->left;
+    node->left = pivot->right;
+    pivot->right = node;
+    fossil_tofu_tree_update_node(node);
+    fossil_tofu_tree_update_node(pivot);
+    return pivot;
+}
+
+// Restores the AVL invariant at `node`, whose subtrees are already balanced,
+// and returns the new root of the subtree.
+static fossil_tofu_tree_node_t* fossil_tofu_tree_rebalance(fossil_tofu_tree_node_t *node) {
+    fossil_tofu_tree_update_node(node);
+    int balance = fossil_tofu_tree_node_height(node->left) - fossil_tofu_tree_node_height(node->right);
+    if (balance > 1) {
+        if (fossil_tofu_tree_node_height(node->left->left) < fossil_tofu_tree_node_height(node->left->right)) {
+            node->left = fossil_tofu_tree_rotate_left(node->left);
+        }
+        return fossil_tofu_tree_rotate_right(node);
+    }
+    if (balance < -1) {
+        if (fossil_tofu_tree_node_height(node->right->right) < fossil_tofu_tree_node_height(node->right->left)) {
+            node->right = fossil_tofu_tree_rotate_right(node->right);
+        }
+        return fossil_tofu_tree_rotate_left(node);
+    }
+    return node;
+}
+
+// Rebalances the links on `path` from `depth - 1` back to the root. Every
+// ancestor's subtree size changed, so the whole path is revisited.
+static void fossil_tofu_tree_retrace(fossil_tofu_tree_node_t **path[], size_t depth) {
+    while (depth-- > 0) {
+        *path[depth] = fossil_tofu_tree_rebalance(*path[depth]);
+    }
+}
+
+// Counts the elements below `value`, or up to and including it when `inclusive`.
+static size_t fossil_tofu_tree_count_below(const fossil_tofu_tree_t *tree, const fossil_tofu_t *value, bool inclusive) {
+    size_t below = 0;
+    const fossil_tofu_tree_node_t *current = tree->root;
+    while (current) {
+        int cmp = fossil_tofu_compare(value, current->value);
+        if (cmp > 0 || (cmp == 0 && inclusive)) {
+            below += fossil_tofu_tree_node_count(current->left) + 1;
+            current = current->right;
+        } else {
+            current = current->left;
+        }
+    }
+    return below;
+}
+
 // *****************************************************************************
 // Tree Management Functions
 // *****************************************************************************
@@ -34,6 +116,7 @@ fossil_tofu_tree_t* fossil_tofu_tree_create(char *type) {
     tree->root = NULL;
     tree->size = 0;
     tree->type = type ? fossil_tofu_strdup(type) : NULL;
+    fossil_tofu_pool_init(&tree->pool, sizeof(fossil_tofu_tree_node_t));
     return tree;
 }
 
@@ -41,13 +124,15 @@ fossil_tofu_tree_t* fossil_tofu_tree_create_default(void) {
     return fossil_tofu_tree_create("any");
 }
 
-static fossil_tofu_tree_node_t* fossil_tofu_tree_copy_node(const fossil_tofu_tree_node_t* node) {
+static fossil_tofu_tree_node_t* fossil_tofu_tree_copy_node(fossil_tofu_pool_t* pool, const fossil_tofu_tree_node_t* node) {
     if (!node) return NULL;
-    fossil_tofu_tree_node_t* new_node = (fossil_tofu_tree_node_t*)fossil_tofu_alloc(sizeof(fossil_tofu_tree_node_t));
+    fossil_tofu_tree_node_t* new_node = (fossil_tofu_tree_node_t*)fossil_tofu_pool_acquire(pool);
     if (!new_node) return NULL;
     new_node->value = fossil_tofu_clone(node->value);
-    new_node->left = fossil_tofu_tree_copy_node(node->left);
-    new_node->right = fossil_tofu_tree_copy_node(node->right);
+    new_node->height = node->height;
+    new_node->count = node->count;
+    new_node->left = fossil_tofu_tree_copy_node(pool, node->left);
+    new_node->right = fossil_tofu_tree_copy_node(pool, node->right);
     return new_node;
 }
 
@@ -57,7 +142,8 @@ fossil_tofu_tree_t* fossil_tofu_tree_create_copy(const fossil_tofu_tree_t* other
     if (!tree) return NULL;
     tree->type = other->type ? fossil_tofu_strdup(other->type) : NULL;
     tree->size = other->size;
-    tree->root = fossil_tofu_tree_copy_node(other->root);
+    fossil_tofu_pool_init(&tree->pool, sizeof(fossil_tofu_tree_node_t));
+    tree->root = fossil_tofu_tree_copy_node(&tree->pool, other->root);
     return tree;
 }
 
@@ -68,6 +154,8 @@ fossil_tofu_tree_t* fossil_tofu_tree_create_move(fossil_tofu_tree_t* other) {
     tree->root = other->root;
     tree->size = other->size;
     tree->type = other->type;
+    fossil_tofu_pool_init(&tree->pool, sizeof(fossil_tofu_tree_node_t));
+    fossil_tofu_pool_move(&tree->pool, &other->pool);
     other->root = NULL;
     other->size = 0;
     other->type = NULL;
@@ -75,18 +163,19 @@ fossil_tofu_tree_t* fossil_tofu_tree_create_move(fossil_tofu_tree_t* other) {
     return tree;
 }
 
+// Destroys the values only; the nodes are released with the pool's slabs
 static void fossil_tofu_tree_destroy_node(fossil_tofu_tree_node_t *node) {
     if (!node) return;
     fossil_tofu_tree_destroy_node(node->left);
     fossil_tofu_tree_destroy_node(node->right);
     if (node->value) fossil_tofu_destroy(node->value);
-    fossil_tofu_free(node);
 }
 
 void fossil_tofu_tree_destroy(fossil_tofu_tree_t *tree) {
     if (!tree) return;
     fossil_tofu_tree_destroy_node(tree->root);
-    if (tree->type) free(tree->type);
+    fossil_tofu_pool_clear(&tree->pool);
+    if (tree->type) fossil_tofu_free(tree->type);
     fossil_tofu_free(tree);
 }
 
@@ -101,44 +190,38 @@ fossil_tofu_tree_node_t* fossil_tofu_tree_create_node(fossil_tofu_t *value) {
     node->value = value;
     node->left = NULL;
     node->right = NULL;
+    node->height = 1;
+    node->count = 1;
     return node;
 }
 
 int fossil_tofu_tree_insert(fossil_tofu_tree_t *tree, fossil_tofu_t *value) {
     if (!tree || !value) return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
 
-    fossil_tofu_tree_node_t *node = fossil_tofu_tree_create_node(value);
-    if (!node) return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
-
-    if (!tree->root) {
-        tree->root = node;
-        tree->size++;
-        return FOSSIL_TOFU_SUCCESS;
-    }
-
-    fossil_tofu_tree_node_t *current = tree->root;
-    while (true) {
-        int cmp = fossil_tofu_compare(value, current->value);
-        if (cmp < 0) {
-            if (!current->left) {
-                current->left = node;
-                tree->size++;
-                return FOSSIL_TOFU_SUCCESS;
-            }
-            current = current->left;
-        } else if (cmp > 0) {
-            if (!current->right) {
-                current->right = node;
-                tree->size++;
-                return FOSSIL_TOFU_SUCCESS;
-            }
-            current = current->right;
-        } else {
+    fossil_tofu_tree_node_t **path[FOSSIL_TOFU_TREE_MAX_HEIGHT];
+    size_t depth = 0;
+    fossil_tofu_tree_node_t **link = &tree->root;
+    while (*link) {
+        int cmp = fossil_tofu_compare(value, (*link)->value);
+        if (cmp == 0) {
             // Duplicate values not allowed
-            fossil_tofu_free(node);
             return FOSSIL_TOFU_ERROR_OVERFLOW;
         }
+        path[depth++] = link;
+        link = cmp < 0 ? &(*link)->left : &(*link)->right;
     }
+
+    fossil_tofu_tree_node_t *node = (fossil_tofu_tree_node_t*)fossil_tofu_pool_acquire(&tree->pool);
+    if (!node) return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    node->value = value;
+    node->left = NULL;
+    node->right = NULL;
+    node->height = 1;
+    node->count = 1;
+    *link = node;
+    tree->size++;
+    fossil_tofu_tree_retrace(path, depth);
+    return FOSSIL_TOFU_SUCCESS;
 }
 
 fossil_tofu_tree_node_t* fossil_tofu_tree_search(fossil_tofu_tree_t *tree, const fossil_tofu_t *value) {
@@ -156,47 +239,39 @@ fossil_tofu_tree_node_t* fossil_tofu_tree_search(fossil_tofu_tree_t *tree, const
 int fossil_tofu_tree_remove(fossil_tofu_tree_t *tree, const fossil_tofu_t *value) {
     if (!tree || !value) return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
 
-    fossil_tofu_tree_node_t **parent_link = &tree->root;
-    fossil_tofu_tree_node_t *current = tree->root;
-    while (current) {
-        int cmp = fossil_tofu_compare(value, current->value);
-        if (cmp < 0) {
-            parent_link = &current->left;
-            current = current->left;
-        } else if (cmp > 0) {
-            parent_link = &current->right;
-            current = current->right;
-        } else {
-            // Node found
-            if (!current->left) {
-                *parent_link = current->right;
-            } else if (!current->right) {
-                *parent_link = current->left;
-            } else {
-                // Two children: find inorder successor
-                fossil_tofu_tree_node_t **succ_link = &current->right;
-                fossil_tofu_tree_node_t *succ = current->right;
-                while (succ->left) {
-                    succ_link = &succ->left;
-                    succ = succ->left;
-                }
-                // Replace current's value with successor's value
-                fossil_tofu_destroy(current->value);
-                current->value = fossil_tofu_clone(succ->value);
-                // Remove successor node
-                fossil_tofu_tree_node_t *to_delete = succ;
-                *succ_link = succ->right;
-                fossil_tofu_free(to_delete);
-                tree->size--;
-                return FOSSIL_TOFU_SUCCESS;
-            }
-            fossil_tofu_destroy(current->value);
-            fossil_tofu_free(current);
-            tree->size--;
-            return FOSSIL_TOFU_SUCCESS;
+    fossil_tofu_tree_node_t **path[FOSSIL_TOFU_TREE_MAX_HEIGHT];
+    size_t depth = 0;
+    fossil_tofu_tree_node_t **link = &tree->root;
+    while (*link) {
+        int cmp = fossil_tofu_compare(value, (*link)->value);
+        if (cmp == 0) break;
+        path[depth++] = link;
+        link = cmp < 0 ? &(*link)->left : &(*link)->right;
+    }
+    fossil_tofu_tree_node_t *current = *link;
+    if (!current) return FOSSIL_TOFU_ERROR_NOT_FOUND;
+
+    fossil_tofu_destroy(current->value);
+    if (!current->left || !current->right) {
+        *link = current->left ? current->left : current->right;
+        fossil_tofu_pool_release(&tree->pool, current);
+    } else {
+        // Two children: the inorder successor's value takes this node's place
+        // and the successor node is unlinked instead
+        path[depth++] = link;
+        fossil_tofu_tree_node_t **succ_link = &current->right;
+        while ((*succ_link)->left) {
+            path[depth++] = succ_link;
+            succ_link = &(*succ_link)->left;
         }
+        fossil_tofu_tree_node_t *succ = *succ_link;
+        current->value = succ->value;
+        *succ_link = succ->right;
+        fossil_tofu_pool_release(&tree->pool, succ);
     }
-    return FOSSIL_TOFU_ERROR_NOT_FOUND;
+    tree->size--;
+    fossil_tofu_tree_retrace(path, depth);
+    return FOSSIL_TOFU_SUCCESS;
 }
 
 int fossil_tofu_tree_compare(const fossil_tofu_t *a, const fossil_tofu_t *b) {
@@ -243,13 +318,6 @@ fossil_tofu_tree_node_t* fossil_tofu_tree_max(fossil_tofu_tree_t *tree) {
     return current;
 }
 
-static int fossil_tofu_tree_node_height(fossil_tofu_tree_node_t *node) {
-    if (!node) return 0;
-    int left = fossil_tofu_tree_node_height(node->left);
-    int right = fossil_tofu_tree_node_height(node->right);
-    return 1 + (left > right ? left : right);
-}
-
 int fossil_tofu_tree_height(fossil_tofu_tree_t *tree) {
     if (!tree) return 0;
     return fossil_tofu_tree_node_height(tree->root);
@@ -259,29 +327,78 @@ int fossil_tofu_tree_is_empty(fossil_tofu_tree_t *tree) {
     return (!tree || tree->size == 0) ? 1 : 0;
 }
 
+// *****************************************************************************
+// Order Statistics
+// *****************************************************************************
+
+size_t fossil_tofu_tree_rank(fossil_tofu_tree_t *tree, const fossil_tofu_t *value) {
+    if (!tree || !value) return 0;
+    return fossil_tofu_tree_count_below(tree, value, false);
+}
+
+fossil_tofu_tree_node_t* fossil_tofu_tree_select(fossil_tofu_tree_t *tree, size_t k) {
+    if (!tree || k >= tree->size) return NULL;
+    fossil_tofu_tree_node_t *current = tree->root;
+    while (current) {
+        size_t left = fossil_tofu_tree_node_count(current->left);
+        if (k < left) {
+            current = current->left;
+        } else if (k == left) {
+            return current;
+        } else {
+            k -= left + 1;
+            current = current->right;
+        }
+    }
+    return NULL;
+}
+
+size_t fossil_tofu_tree_count_range(fossil_tofu_tree_t *tree, const fossil_tofu_t *lo, const fossil_tofu_t *hi) {
+    if (!tree || !lo || !hi || fossil_tofu_compare(lo, hi) > 0) return 0;
+    return fossil_tofu_tree_count_below(tree, hi, true) - fossil_tofu_tree_count_below(tree, lo, false);
+}
+
 // *****************************************************************************
 // Traversal Functions
 // *****************************************************************************
 
+// Lets the context-free visit functions run on the iterative traversals
+typedef struct {
+    fossil_tofu_tree_visit_fn visit;
+} fossil_tofu_tree_visit_adapter_t;
+
+static bool fossil_tofu_tree_visit_adapter(fossil_tofu_t *value, void *context) {
+    ((const fossil_tofu_tree_visit_adapter_t *)context)->visit(value);
+    return true;
+}
+
+// Pushes `node` and its chain of left children onto the cursor; false if the
+// chain does not fit, which only a hand-built, unbalanced subtree can cause.
+static bool fossil_tofu_tree_iter_push_left(fossil_tofu_tree_iter_t *iter, fossil_tofu_tree_node_t *node) {
+    while (node) {
+        if (iter->depth == FOSSIL_TOFU_TREE_MAX_HEIGHT) return false;
+        iter->stack[iter->depth++] = node;
+        node = node->left;
+    }
+    return true;
+}
+
 void fossil_tofu_tree_traverse_inorder(fossil_tofu_tree_node_t *node, fossil_tofu_tree_visit_fn visit) {
     if (!node || !visit) return;
-    fossil_tofu_tree_traverse_inorder(node->left, visit);
-    visit(node->value);
-    fossil_tofu_tree_traverse_inorder(node->right, visit);
+    fossil_tofu_tree_visit_adapter_t adapter = { visit };
+    fossil_tofu_tree_traverse_inorder_ctx(node, fossil_tofu_tree_visit_adapter, &adapter);
 }
 
 void fossil_tofu_tree_traverse_preorder(fossil_tofu_tree_node_t *node, fossil_tofu_tree_visit_fn visit) {
     if (!node || !visit) return;
-    visit(node->value);
-    fossil_tofu_tree_traverse_preorder(node->left, visit);
-    fossil_tofu_tree_traverse_preorder(node->right, visit);
+    fossil_tofu_tree_visit_adapter_t adapter = { visit };
+    fossil_tofu_tree_traverse_preorder_ctx(node, fossil_tofu_tree_visit_adapter, &adapter);
 }
 
 void fossil_tofu_tree_traverse_postorder(fossil_tofu_tree_node_t *node, fossil_tofu_tree_visit_fn visit) {
     if (!node || !visit) return;
-    fossil_tofu_tree_traverse_postorder(node->left, visit);
-    fossil_tofu_tree_traverse_postorder(node->right, visit);
-    visit(node->value);
+    fossil_tofu_tree_visit_adapter_t adapter = { visit };
+    fossil_tofu_tree_traverse_postorder_ctx(node, fossil_tofu_tree_visit_adapter, &adapter);
 }
 
 void fossil_tofu_tree_traverse(fossil_tofu_tree_t *tree, fossil_tofu_tree_visit_fn visit) {
@@ -289,6 +406,102 @@ void fossil_tofu_tree_traverse(fossil_tofu_tree_t *tree, fossil_tofu_tree_visit_
     fossil_tofu_tree_traverse_inorder(tree->root, visit);
 }
 
+bool fossil_tofu_tree_traverse_ctx(fossil_tofu_tree_t *tree, fossil_tofu_tree_visit_ctx_fn visit, void *context) {
+    if (!tree || !visit) return true;
+    return fossil_tofu_tree_traverse_inorder_ctx(tree->root, visit, context);
+}
+
+bool fossil_tofu_tree_traverse_inorder_ctx(fossil_tofu_tree_node_t *node, fossil_tofu_tree_visit_ctx_fn visit, void *context) {
+    if (!node || !visit) return true;
+    fossil_tofu_tree_iter_t iter;
+    iter.depth = 0;
+    if (!fossil_tofu_tree_iter_push_left(&iter, node)) return false;
+    while (iter.depth > 0) {
+        fossil_tofu_tree_node_t *current = iter.stack[--iter.depth];
+        if (!visit(current->value, context)) return false;
+        if (!fossil_tofu_tree_iter_push_left(&iter, current->right)) return false;
+    }
+    return true;
+}
+
+bool fossil_tofu_tree_traverse_preorder_ctx(fossil_tofu_tree_node_t *node, fossil_tofu_tree_visit_ctx_fn visit, void *context) {
+    if (!node || !visit) return true;
+    // Each level leaves at most one right child waiting, so a balanced subtree
+    // stays within the height; a deeper hand-built one stops the walk instead
+    fossil_tofu_tree_node_t *stack[FOSSIL_TOFU_TREE_MAX_HEIGHT + 1];
+    const size_t capacity = sizeof(stack) / sizeof(stack[0]);
+    size_t depth = 0;
+    stack[depth++] = node;
+    while (depth > 0) {
+        fossil_tofu_tree_node_t *current = stack[--depth];
+        if (!visit(current->value, context)) return false;
+        if (depth + (current->right != NULL) + (current->left != NULL) > capacity) return false;
+        if (current->right) stack[depth++] = current->right;
+        if (current->left) stack[depth++] = current->left;
+    }
+    return true;
+}
+
+bool fossil_tofu_tree_traverse_postorder_ctx(fossil_tofu_tree_node_t *node, fossil_tofu_tree_visit_ctx_fn visit, void *context) {
+    if (!node || !visit) return true;
+    fossil_tofu_tree_node_t *stack[FOSSIL_TOFU_TREE_MAX_HEIGHT];
+    size_t depth = 0;
+    fossil_tofu_tree_node_t *current = node;
+    const fossil_tofu_tree_node_t *last = NULL;
+    while (current || depth > 0) {
+        if (current) {
+            if (depth == FOSSIL_TOFU_TREE_MAX_HEIGHT) return false;
+            stack[depth++] = current;
+            current = current->left;
+            continue;
+        }
+        fossil_tofu_tree_node_t *top = stack[depth - 1];
+        if (top->right && top->right != last) {
+            // Finish the right subtree before the node itself
+            current = top->right;
+        } else {
+            if (!visit(top->value, context)) return false;
+            last = top;
+            depth--;
+        }
+    }
+    return true;
+}
+
+// *****************************************************************************
+// Cursor Functions
+// *****************************************************************************
+
+void fossil_tofu_tree_iter_begin(fossil_tofu_tree_t *tree, fossil_tofu_tree_iter_t *iter) {
+    if (!iter) return;
+    iter->depth = 0;
+    if (tree) fossil_tofu_tree_iter_push_left(iter, tree->root);
+}
+
+bool fossil_tofu_tree_iter_seek(fossil_tofu_tree_t *tree, fossil_tofu_tree_iter_t *iter, const fossil_tofu_t *value) {
+    if (!iter) return false;
+    iter->depth = 0;
+    if (!tree || !value) return false;
+    // Keep exactly the ancestors at or above `value`; the smallest ends up on top
+    fossil_tofu_tree_node_t *current = tree->root;
+    while (current) {
+        if (fossil_tofu_compare(value, current->value) <= 0) {
+            iter->stack[iter->depth++] = current;
+            current = current->left;
+        } else {
+            current = current->right;
+        }
+    }
+    return iter->depth > 0;
+}
+
+fossil_tofu_tree_node_t* fossil_tofu_tree_iter_next(fossil_tofu_tree_iter_t *iter) {
+    if (!iter || iter->depth == 0) return NULL;
+    fossil_tofu_tree_node_t *node = iter->stack[--iter->depth];
+    fossil_tofu_tree_iter_push_left(iter, node->right);
+    return node;
+}
+
 /**
  * -----------------------------------------------------------------------------
  * Utility Functions
@@ -298,6 +511,7 @@ void fossil_tofu_tree_traverse(fossil_tofu_tree_t *tree, fossil_tofu_tree_visit_
 void fossil_tofu_tree_clear(fossil_tofu_tree_t *tree) {
     if (!tree) return;
     fossil_tofu_tree_destroy_node(tree->root);
+    fossil_tofu_pool_clear(&tree->pool);
     tree->root = NULL;
     tree->size = 0;
 }
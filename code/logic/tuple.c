@@ -41,6 +41,7 @@ fossil_tofu_tuple_t *fossil_tofu_tuple_create(char *type) {
     tuple->element_count = 0;
     tuple->capacity = INITIAL_CAPACITY;
     tuple->type = type;
+    tuple->type_enum = fossil_tofu_validate_type(type);
     return tuple;
 }
 
@@ -59,11 +60,12 @@ fossil_tofu_tuple_t* fossil_tofu_tuple_create_copy(const fossil_tofu_tuple_t* ot
         return NULL;
     }
     for (size_t i = 0; i < other->element_count; i++) {
-        tuple->elements[i] = fossil_tofu_create(other->type, other->elements[i].value.data);
+        tuple->elements[i] = fossil_tofu_create_typed(other->type_enum, fossil_tofu_get_value(&other->elements[i]));
     }
     tuple->element_count = other->element_count;
     tuple->capacity = other->capacity;
     tuple->type = other->type;
+    tuple->type_enum = other->type_enum;
     return tuple;
 }
 
@@ -76,10 +78,12 @@ fossil_tofu_tuple_t* fossil_tofu_tuple_create_move(fossil_tofu_tuple_t* other) {
     tuple->element_count = other->element_count;
     tuple->capacity = other->capacity;
     tuple->type = other->type;
+    tuple->type_enum = other->type_enum;
     other->elements = NULL;
     other->element_count = 0;
     other->capacity = 0;
     other->type = NULL;
+    other->type_enum = FOSSIL_TOFU_TYPE_CNULL;
     return tuple;
 }
 
@@ -116,7 +120,7 @@ void fossil_tofu_tuple_add(fossil_tofu_tuple_t *tuple, char *element) {
         tuple->elements = new_elements;
         tuple->capacity *= 2;
     }
-    tuple->elements[tuple->element_count++] = fossil_tofu_create(tuple->type, element);
+    tuple->elements[tuple->element_count++] = fossil_tofu_create_typed(tuple->type_enum, element);
 }
 
 void fossil_tofu_tuple_remove(fossil_tofu_tuple_t *tuple, size_t index) {
@@ -160,7 +164,7 @@ char *fossil_tofu_tuple_get(fossil_tofu_tuple_t *tuple, size_t index) {
     if (tuple == NULL || index >= tuple->element_count) {
         return NULL;
     }
-    return tuple->elements[index].value.data;
+    return fossil_tofu_get_value(&tuple->elements[index]);
 }
 
 /**
@@ -171,7 +175,7 @@ char *fossil_tofu_tuple_get(fossil_tofu_tuple_t *tuple, size_t index) {
  * @note Time complexity: O(1)
  */
 char *fossil_tofu_tuple_get_front(const fossil_tofu_tuple_t* tuple) {
-    return tuple == NULL || tuple->element_count == 0 ? NULL : tuple->elements[0].value.data;
+    return tuple == NULL || tuple->element_count == 0 ? NULL : fossil_tofu_get_value(&tuple->elements[0]);
 }
 
 /**
@@ -182,7 +186,7 @@ char *fossil_tofu_tuple_get_front(const fossil_tofu_tuple_t* tuple) {
  * @note Time complexity: O(1)
  */
 char *fossil_tofu_tuple_get_back(const fossil_tofu_tuple_t* tuple) {
-    return tuple == NULL || tuple->element_count == 0 ? NULL : tuple->elements[tuple->element_count - 1].value.data;
+    return tuple == NULL || tuple->element_count == 0 ? NULL : fossil_tofu_get_value(&tuple->elements[tuple->element_count - 1]);
 }
 
 /**
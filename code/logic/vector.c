@@ -45,6 +45,21 @@ fossil_tofu_vector_t* fossil_tofu_vector_create_container(char* type) {
     vector->size = 0;
     vector->capacity = INITIAL_CAPACITY;
     vector->type = type;
+    vector->type_enum = validated_type;
+    vector->arena = NULL;
+    return vector;
+}
+
+fossil_tofu_vector_t* fossil_tofu_vector_create_in_arena(char* type, fossil_tofu_arena_t* arena) {
+    if (arena == NULL) {
+        return NULL;
+    }
+    fossil_tofu_arena_enter(arena);
+    fossil_tofu_vector_t* vector = fossil_tofu_vector_create_container(type);
+    if (vector != NULL) {
+        vector->arena = arena;
+    }
+    fossil_tofu_arena_leave(arena);
     return vector;
 }
 
@@ -56,22 +71,28 @@ fossil_tofu_vector_t* fossil_tofu_vector_create_copy(const fossil_tofu_vector_t*
     if (other == NULL) {
         return NULL;
     }
-    fossil_tofu_type_t validated_type = fossil_tofu_validate_type(other->type);
-    if (validated_type == FOSSIL_TOFU_TYPE_CNULL) {
+    if (other->type_enum == FOSSIL_TOFU_TYPE_CNULL) {
         return NULL;
     }
+    // A copy of an arena-backed vector lives in the same arena
+    fossil_tofu_arena_enter(other->arena);
     fossil_tofu_vector_t* vector = (fossil_tofu_vector_t*)fossil_tofu_alloc(sizeof(fossil_tofu_vector_t));
     if (vector == NULL) {
+        fossil_tofu_arena_leave(other->arena);
         return NULL;
     }
     vector->data = (fossil_tofu_t*)fossil_tofu_alloc(other->capacity * sizeof(fossil_tofu_t));
     if (vector->data == NULL) {
         fossil_tofu_free(vector);
+        fossil_tofu_arena_leave(other->arena);
         return NULL;
     }
+    fossil_tofu_arena_leave(other->arena);
     vector->size = other->size;
     vector->capacity = other->capacity;
     vector->type = other->type;
+    vector->type_enum = other->type_enum;
+    vector->arena = other->arena;
     for (size_t i = 0; i < other->size; i++) {
         vector->data[i] = other->data[i];
     }
@@ -82,11 +103,12 @@ fossil_tofu_vector_t* fossil_tofu_vector_create_move(fossil_tofu_vector_t* other
     if (other == NULL) {
         return NULL;
     }
-    fossil_tofu_type_t validated_type = fossil_tofu_validate_type(other->type);
-    if (validated_type == FOSSIL_TOFU_TYPE_CNULL) {
+    if (other->type_enum == FOSSIL_TOFU_TYPE_CNULL) {
         return NULL;
     }
+    fossil_tofu_arena_enter(other->arena);
     fossil_tofu_vector_t* vector = (fossil_tofu_vector_t*)fossil_tofu_alloc(sizeof(fossil_tofu_vector_t));
+    fossil_tofu_arena_leave(other->arena);
     if (vector == NULL) {
         return NULL;
     }
@@ -94,15 +116,20 @@ fossil_tofu_vector_t* fossil_tofu_vector_create_move(fossil_tofu_vector_t* other
     vector->size = other->size;
     vector->capacity = other->capacity;
     vector->type = other->type;
+    vector->type_enum = other->type_enum;
+    vector->arena = other->arena;
     other->data = NULL;
     other->size = 0;
     other->capacity = 0;
     other->type = NULL;
+    other->type_enum = FOSSIL_TOFU_TYPE_CNULL;
+    other->arena = NULL;
     return vector;
 }
 
 void fossil_tofu_vector_destroy(fossil_tofu_vector_t* vector) {
-    if (vector == NULL) {
+    if (vector == NULL || vector->arena != NULL) {
+        // Arena-backed vectors are released together with their arena
         return;
     }
     fossil_tofu_free(vector->data);
@@ -117,9 +144,11 @@ void fossil_tofu_vector_push_back(fossil_tofu_vector_t* vector, char *element) {
     if (vector == NULL) {
         return;
     }
+    fossil_tofu_arena_enter(vector->arena);
     if (vector->size == vector->capacity) {
         fossil_tofu_t* new_data = (fossil_tofu_t*)fossil_tofu_alloc(2 * vector->capacity * sizeof(fossil_tofu_t));
         if (new_data == NULL) {
+            fossil_tofu_arena_leave(vector->arena);
             return;
         }
         for (size_t i = 0; i < vector->size; i++) {
@@ -129,16 +158,47 @@ void fossil_tofu_vector_push_back(fossil_tofu_vector_t* vector, char *element) {
         vector->data = new_data;
         vector->capacity *= 2;
     }
-    vector->data[vector->size++] = fossil_tofu_create(vector->type, element);
+    vector->data[vector->size++] = fossil_tofu_create_typed(vector->type_enum, element);
+    fossil_tofu_arena_leave(vector->arena);
+}
+
+int32_t fossil_tofu_vector_push_back_many(fossil_tofu_vector_t* vector, char **elements, size_t count) {
+    if (vector == NULL || elements == NULL) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    fossil_tofu_arena_enter(vector->arena);
+    // Reserve room for the whole batch at once instead of doubling per element
+    if (vector->size + count > vector->capacity) {
+        size_t new_capacity = vector->capacity * 2;
+        if (new_capacity < vector->size + count) {
+            new_capacity = vector->size + count;
+        }
+        fossil_tofu_t* new_data = (fossil_tofu_t*)fossil_tofu_realloc(vector->data, new_capacity * sizeof(fossil_tofu_t));
+        if (new_data == NULL) {
+            fossil_tofu_arena_leave(vector->arena);
+            return FOSSIL_TOFU_FAILURE;
+        }
+        vector->data = new_data;
+        vector->capacity = new_capacity;
+    }
+    int32_t result = fossil_tofu_create_batch(vector->type_enum, (const char *const *)elements, count, vector->data + vector->size);
+    fossil_tofu_arena_leave(vector->arena);
+    if (result != FOSSIL_TOFU_SUCCESS) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    vector->size += count;
+    return FOSSIL_TOFU_SUCCESS;
 }
 
 void fossil_tofu_vector_push_front(fossil_tofu_vector_t* vector, char *element) {
     if (vector == NULL) {
         return;
     }
+    fossil_tofu_arena_enter(vector->arena);
     if (vector->size == vector->capacity) {
         fossil_tofu_t* new_data = (fossil_tofu_t*)fossil_tofu_alloc(2 * vector->capacity * sizeof(fossil_tofu_t));
         if (new_data == NULL) {
+            fossil_tofu_arena_leave(vector->arena);
             return;
         }
         for (size_t i = 0; i < vector->size; i++) {
@@ -152,17 +212,20 @@ void fossil_tofu_vector_push_front(fossil_tofu_vector_t* vector, char *element)
             vector->data[i] = vector->data[i - 1];
         }
     }
-    vector->data[0] = fossil_tofu_create(vector->type, element);
+    vector->data[0] = fossil_tofu_create_typed(vector->type_enum, element);
     vector->size++;
+    fossil_tofu_arena_leave(vector->arena);
 }
 
 void fossil_tofu_vector_push_at(fossil_tofu_vector_t* vector, size_t index, char *element) {
     if (vector == NULL || index > vector->size) {
         return;
     }
+    fossil_tofu_arena_enter(vector->arena);
     if (vector->size == vector->capacity) {
         fossil_tofu_t* new_data = (fossil_tofu_t*)fossil_tofu_alloc(2 * vector->capacity * sizeof(fossil_tofu_t));
         if (new_data == NULL) {
+            fossil_tofu_arena_leave(vector->arena);
             return;
         }
         for (size_t i = 0; i < index; i++) {
@@ -179,22 +242,27 @@ void fossil_tofu_vector_push_at(fossil_tofu_vector_t* vector, size_t index, char
             vector->data[i] = vector->data[i - 1];
         }
     }
-    vector->data[index] = fossil_tofu_create(vector->type, element);
+    vector->data[index] = fossil_tofu_create_typed(vector->type_enum, element);
     vector->size++;
+    fossil_tofu_arena_leave(vector->arena);
 }
 
 void fossil_tofu_vector_pop_back(fossil_tofu_vector_t* vector) {
     if (vector == NULL || vector->size == 0) {
         return;
     }
+    fossil_tofu_arena_enter(vector->arena);
     fossil_tofu_destroy(&vector->data[--vector->size]);
+    fossil_tofu_arena_leave(vector->arena);
 }
 
 void fossil_tofu_vector_pop_front(fossil_tofu_vector_t* vector) {
     if (vector == NULL || vector->size == 0) {
         return;
     }
+    fossil_tofu_arena_enter(vector->arena);
     fossil_tofu_destroy(&vector->data[0]);
+    fossil_tofu_arena_leave(vector->arena);
     for (size_t i = 0; i < vector->size - 1; i++) {
         vector->data[i] = vector->data[i + 1];
     }
@@ -205,7 +273,9 @@ void fossil_tofu_vector_pop_at(fossil_tofu_vector_t* vector, size_t index) {
     if (vector == NULL || index >= vector->size) {
         return;
     }
+    fossil_tofu_arena_enter(vector->arena);
     fossil_tofu_destroy(&vector->data[index]);
+    fossil_tofu_arena_leave(vector->arena);
     for (size_t i = index; i < vector->size - 1; i++) {
         vector->data[i] = vector->data[i + 1];
     }
@@ -216,9 +286,11 @@ void fossil_tofu_vector_erase(fossil_tofu_vector_t* vector) {
     if (vector == NULL) {
         return;
     }
+    fossil_tofu_arena_enter(vector->arena);
     for (size_t i = 0; i < vector->size; i++) {
         fossil_tofu_destroy(&vector->data[i]);
     }
+    fossil_tofu_arena_leave(vector->arena);
     vector->size = 0;
 }
 
@@ -250,46 +322,59 @@ size_t fossil_tofu_vector_capacity(const fossil_tofu_vector_t* vector) {
 // Getter and setter functions
 // *****************************************************************************
 
+// Reads an element's text; values carry it from creation, so no allocator is needed.
+static char *fossil_tofu_vector_value(const fossil_tofu_vector_t* vector, size_t index) {
+    return fossil_tofu_get_value(&vector->data[index]);
+}
+
 char *fossil_tofu_vector_get(const fossil_tofu_vector_t* vector, size_t index) {
-    return vector == NULL || index >= vector->size ? NULL : fossil_tofu_get_value(&vector->data[index]);
+    return vector == NULL || index >= vector->size ? NULL : fossil_tofu_vector_value(vector, index);
 }
 
 char *fossil_tofu_vector_get_front(const fossil_tofu_vector_t* vector) {
-    return vector == NULL || vector->size == 0 ? NULL : fossil_tofu_get_value(&vector->data[0]);
+    return vector == NULL || vector->size == 0 ? NULL : fossil_tofu_vector_value(vector, 0);
 }
 
 char *fossil_tofu_vector_get_back(const fossil_tofu_vector_t* vector) {
-    return vector == NULL || vector->size == 0 ? NULL : fossil_tofu_get_value(&vector->data[vector->size - 1]);
+    return vector == NULL || vector->size == 0 ? NULL : fossil_tofu_vector_value(vector, vector->size - 1);
 }
 
 char *fossil_tofu_vector_get_at(const fossil_tofu_vector_t* vector, size_t index) {
-    return vector == NULL || index >= vector->size ? NULL : fossil_tofu_get_value(&vector->data[index]);
+    return vector == NULL || index >= vector->size ? NULL : fossil_tofu_vector_value(vector, index);
 }
 
 void fossil_tofu_vector_set(fossil_tofu_vector_t* vector, size_t index, char *element) {
     if (vector == NULL || index >= vector->size) {
         return;
     }
+    fossil_tofu_arena_enter(vector->arena);
     fossil_tofu_set_value(&vector->data[index], element);
+    fossil_tofu_arena_leave(vector->arena);
 }
 
 void fossil_tofu_vector_set_front(fossil_tofu_vector_t* vector, char *element) {
     if (vector == NULL || vector->size == 0) {
         return;
     }
+    fossil_tofu_arena_enter(vector->arena);
     fossil_tofu_set_value(&vector->data[0], element);
+    fossil_tofu_arena_leave(vector->arena);
 }
 
 void fossil_tofu_vector_set_back(fossil_tofu_vector_t* vector, char *element) {
     if (vector == NULL || vector->size == 0) {
         return;
     }
+    fossil_tofu_arena_enter(vector->arena);
     fossil_tofu_set_value(&vector->data[vector->size - 1], element);
+    fossil_tofu_arena_leave(vector->arena);
 }
 
 void fossil_tofu_vector_set_at(fossil_tofu_vector_t* vector, size_t index, char *element) {
     if (vector == NULL || index >= vector->size) {
         return;
     }
+    fossil_tofu_arena_enter(vector->arena);
     fossil_tofu_set_value(&vector->data[index], element);
+    fossil_tofu_arena_leave(vector->arena);
 }
@@ -0,0 +1,129 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/tofu/framework.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_SUITE(c_arena_tofu_fixture);
+
+FOSSIL_SETUP(c_arena_tofu_fixture) {
+    // Setup the test fixture
+}
+
+FOSSIL_TEARDOWN(c_arena_tofu_fixture) {
+    // Teardown the test fixture
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(c_test_arena_alloc_and_reset) {
+    fossil_tofu_arena_t* arena = fossil_tofu_arena_create(256);
+    ASSUME_NOT_CNULL(arena);
+    char* first = (char*)fossil_tofu_arena_alloc(arena, 10);
+    char* second = (char*)fossil_tofu_arena_alloc(arena, 10);
+    ASSUME_NOT_CNULL(first);
+    ASSUME_NOT_CNULL(second);
+    ASSUME_ITS_TRUE(first != second);
+    ASSUME_ITS_EQUAL_SIZE((size_t)second % _Alignof(max_align_t), 0);
+    ASSUME_NOT_CNULL(fossil_tofu_arena_alloc(arena, 4096)); // Larger than a chunk
+    ASSUME_ITS_TRUE(fossil_tofu_arena_used(arena) > 4096);
+    fossil_tofu_arena_reset(arena);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_arena_used(arena), 0);
+    fossil_tofu_arena_destroy(arena);
+}
+
+FOSSIL_TEST(c_test_arena_enter_and_leave) {
+    fossil_tofu_arena_t* arena = fossil_tofu_arena_create(0);
+    fossil_tofu_arena_enter(arena);
+    fossil_tofu_arena_enter(arena);
+    char* text = fossil_tofu_strdup("allocated from the arena");
+    ASSUME_ITS_TRUE(fossil_tofu_arena_used(arena) > 0);
+    fossil_tofu_arena_leave(arena);
+    ASSUME_ITS_TRUE(fossil_tofu_get_thread_allocator() != NULL);
+    char* grown = (char*)fossil_tofu_realloc(text, 64);
+    ASSUME_ITS_EQUAL_CSTR(grown, "allocated from the arena");
+    fossil_tofu_free(grown);
+    fossil_tofu_arena_leave(arena);
+    ASSUME_ITS_TRUE(fossil_tofu_get_thread_allocator() == NULL);
+    fossil_tofu_arena_destroy(arena);
+}
+
+FOSSIL_TEST(c_test_arena_vector) {
+    fossil_tofu_arena_t* arena = fossil_tofu_arena_create(0);
+    fossil_tofu_vector_t* vector = fossil_tofu_vector_create_in_arena("cstr", arena);
+    ASSUME_NOT_CNULL(vector);
+    for (int i = 0; i < 100; i++) {
+        fossil_tofu_vector_push_back(vector, "a string well beyond the inline capacity");
+    }
+    fossil_tofu_vector_pop_back(vector);
+    fossil_tofu_vector_set(vector, 0, "another string well beyond the inline capacity");
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_vector_size(vector), 99);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_vector_get(vector, 0), "another string well beyond the inline capacity");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_vector_get(vector, 98), "a string well beyond the inline capacity");
+    ASSUME_ITS_TRUE(fossil_tofu_get_thread_allocator() == NULL);
+    fossil_tofu_vector_destroy(vector);
+    fossil_tofu_arena_destroy(arena);
+}
+
+FOSSIL_TEST(c_test_arena_mapof) {
+    fossil_tofu_arena_t* arena = fossil_tofu_arena_create(0);
+    fossil_tofu_mapof_t* map = fossil_tofu_mapof_create_in_arena("cstr", "i32", arena);
+    ASSUME_NOT_CNULL(map);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_mapof_insert(map, "first key that is not inline", "1"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_mapof_insert(map, "second key that is not inline", "2"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_mapof_set(map, "first key that is not inline", "10"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_mapof_remove(map, "second key that is not inline"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_TRUE(fossil_tofu_mapof_contains(map, "first key that is not inline"));
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mapof_size(map), 1);
+    fossil_tofu_mapof_destroy(map);
+    fossil_tofu_arena_destroy(arena);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_arena_tofu_tests) {
+    // Generic ToFu Fixture
+    FOSSIL_ADD_TEST(c_arena_tofu_fixture, c_test_arena_alloc_and_reset);
+    FOSSIL_ADD_TEST(c_arena_tofu_fixture, c_test_arena_enter_and_leave);
+    FOSSIL_ADD_TEST(c_arena_tofu_fixture, c_test_arena_vector);
+    FOSSIL_ADD_TEST(c_arena_tofu_fixture, c_test_arena_mapof);
+
+    // Register the test group
+    FOSSIL_ADD_SUITE(c_arena_tofu_fixture);
+} // end of tests
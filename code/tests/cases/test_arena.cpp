@@ -0,0 +1,95 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/tofu/framework.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_SUITE(cpp_arena_tofu_fixture);
+
+FOSSIL_SETUP(cpp_arena_tofu_fixture) {
+    // Setup the test fixture
+}
+
+FOSSIL_TEARDOWN(cpp_arena_tofu_fixture) {
+    // Teardown the test fixture
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+using fossil::tofu::Arena;
+using fossil::tofu::MapOf;
+using fossil::tofu::Vector;
+
+FOSSIL_TEST(cpp_test_arena_vector) {
+    Arena arena;
+    Vector vector("i32", arena);
+    for (int i = 0; i < 1000; i++) {
+        vector.push_back(std::to_string(i));
+    }
+    ASSUME_ITS_EQUAL_I32(vector.size(), 1000);
+    ASSUME_ITS_EQUAL_CSTR(vector.get(999).c_str(), "999");
+    ASSUME_ITS_TRUE(arena.used() > 0);
+}
+
+FOSSIL_TEST(cpp_test_arena_mapof) {
+    Arena arena(1024);
+    MapOf map("cstr", "cstr", arena);
+    map.insert("key", "value");
+    ASSUME_ITS_TRUE(map.contains("key"));
+    ASSUME_ITS_EQUAL_SIZE(map.size(), 1);
+}
+
+FOSSIL_TEST(cpp_test_arena_reset) {
+    Arena arena;
+    ASSUME_NOT_CNULL(fossil_tofu_arena_alloc(arena.get(), 128));
+    arena.reset();
+    ASSUME_ITS_EQUAL_SIZE(arena.used(), 0);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_arena_tofu_tests) {
+    // Generic ToFu Fixture
+    FOSSIL_ADD_TEST(cpp_arena_tofu_fixture, cpp_test_arena_vector);
+    FOSSIL_ADD_TEST(cpp_arena_tofu_fixture, cpp_test_arena_mapof);
+    FOSSIL_ADD_TEST(cpp_arena_tofu_fixture, cpp_test_arena_reset);
+
+    // Register the test group
+    FOSSIL_ADD_SUITE(cpp_arena_tofu_fixture);
+} // end of tests
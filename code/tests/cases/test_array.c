@@ -62,6 +62,16 @@ FOSSIL_TEST(c_test_array_push_and_get) {
     fossil_tofu_array_destroy(array);
 }
 
+FOSSIL_TEST(c_test_array_push_back_many) {
+    fossil_tofu_array_t* array = fossil_tofu_array_create_container("i32");
+    char *elements[] = {"10", "20", "30", "40", "50"};
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_array_push_back_many(array, elements, 5), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_array_size(array), 5);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_array_get(array, 0), "10");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_array_get(array, 4), "50");
+    fossil_tofu_array_destroy(array);
+}
+
 FOSSIL_TEST(c_test_array_push_front_and_pop_front) {
     fossil_tofu_array_t* array = fossil_tofu_array_create_container("i32");
     fossil_tofu_array_push_front(array, "1");
@@ -231,6 +241,7 @@ FOSSIL_TEST(c_test_array_pop_at_various_positions) {
 FOSSIL_TEST_GROUP(c_array_tofu_tests) {    
     FOSSIL_ADD_TEST(c_array_tofu_fixture, c_test_array_create_and_destroy);
     FOSSIL_ADD_TEST(c_array_tofu_fixture, c_test_array_push_and_get);
+    FOSSIL_ADD_TEST(c_array_tofu_fixture, c_test_array_push_back_many);
     FOSSIL_ADD_TEST(c_array_tofu_fixture, c_test_array_push_front_and_pop_front);
     FOSSIL_ADD_TEST(c_array_tofu_fixture, c_test_array_push_at_and_pop_at);
     FOSSIL_ADD_TEST(c_array_tofu_fixture, c_test_array_set_and_get);
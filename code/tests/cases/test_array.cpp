@@ -61,6 +61,13 @@ FOSSIL_TEST(cpp_test_array_push_and_get) {
     ASSUME_ITS_EQUAL_CSTR(array.get(2).c_str(), "30");
 }
 
+FOSSIL_TEST(cpp_test_array_push_back_many) {
+    Array array("cstr");
+    array.push_back_many({"alpha", "a string well beyond the inline capacity"});
+    ASSUME_ITS_EQUAL_I32(array.size(), 2);
+    ASSUME_ITS_EQUAL_CSTR(array.get(1).c_str(), "a string well beyond the inline capacity");
+}
+
 FOSSIL_TEST(cpp_test_array_push_front_and_pop_front) {
     Array array("i32");
     array.push_front("1");
@@ -207,6 +214,7 @@ FOSSIL_TEST(cpp_test_array_pop_at_various_positions) {
 FOSSIL_TEST_GROUP(cpp_array_tofu_tests) {    
     FOSSIL_ADD_TEST(cpp_array_tofu_fixture, cpp_test_array_create_and_destroy);
     FOSSIL_ADD_TEST(cpp_array_tofu_fixture, cpp_test_array_push_and_get);
+    FOSSIL_ADD_TEST(cpp_array_tofu_fixture, cpp_test_array_push_back_many);
     FOSSIL_ADD_TEST(cpp_array_tofu_fixture, cpp_test_array_push_front_and_pop_front);
     FOSSIL_ADD_TEST(cpp_array_tofu_fixture, cpp_test_array_push_at_and_pop_at);
     FOSSIL_ADD_TEST(cpp_array_tofu_fixture, cpp_test_array_set_and_get);
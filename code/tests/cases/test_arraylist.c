@@ -74,6 +74,16 @@ FOSSIL_TEST(c_test_arraylist_insert_and_size) {
     fossil_tofu_arraylist_destroy(alist);
 }
 
+FOSSIL_TEST(c_test_arraylist_insert_many) {
+    fossil_tofu_arraylist_t* alist = fossil_tofu_arraylist_create_container("i32", 2);
+    char *data[] = {"1", "2", "3", "4"};
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_arraylist_insert_many(alist, data, 4), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_arraylist_size(alist), 4);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_arraylist_get(alist, 0), "1");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_arraylist_get(alist, 3), "4");
+    fossil_tofu_arraylist_destroy(alist);
+}
+
 FOSSIL_TEST(c_test_arraylist_remove) {
     fossil_tofu_arraylist_t* alist = fossil_tofu_arraylist_create_container("i32", 4);
     fossil_tofu_arraylist_insert(alist, "1");
@@ -151,6 +161,7 @@ FOSSIL_TEST_GROUP(c_arraylist_tofu_tests) {
     FOSSIL_ADD_TEST(c_arraylist_tofu_fixture, c_test_arraylist_create_and_destroy);
     FOSSIL_ADD_TEST(c_arraylist_tofu_fixture, c_test_arraylist_create_default);
     FOSSIL_ADD_TEST(c_arraylist_tofu_fixture, c_test_arraylist_insert_and_size);
+    FOSSIL_ADD_TEST(c_arraylist_tofu_fixture, c_test_arraylist_insert_many);
     FOSSIL_ADD_TEST(c_arraylist_tofu_fixture, c_test_arraylist_remove);
     FOSSIL_ADD_TEST(c_arraylist_tofu_fixture, c_test_arraylist_get_and_set);
     FOSSIL_ADD_TEST(c_arraylist_tofu_fixture, c_test_arraylist_get_front_and_back);
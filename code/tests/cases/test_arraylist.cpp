@@ -74,6 +74,13 @@ FOSSIL_TEST(cpp_test_arraylist_insert_and_size) {
     ASSUME_ITS_EQUAL_SIZE(alist.size(), 3);
 }
 
+FOSSIL_TEST(cpp_test_arraylist_insert_many) {
+    ArrayList alist("i32", 2);
+    alist.insert_many({"100", "200", "300"});
+    ASSUME_ITS_EQUAL_SIZE(alist.size(), 3);
+    ASSUME_ITS_EQUAL_CSTR(alist.get(2).c_str(), "300");
+}
+
 FOSSIL_TEST(cpp_test_arraylist_remove) {
     ArrayList alist("i32", 4);
     alist.insert("1");
@@ -145,6 +152,7 @@ FOSSIL_TEST_GROUP(cpp_arraylist_tofu_tests) {
     FOSSIL_ADD_TEST(cpp_arraylist_tofu_fixture, cpp_test_arraylist_create_and_destroy);
     FOSSIL_ADD_TEST(cpp_arraylist_tofu_fixture, cpp_test_arraylist_create_default);
     FOSSIL_ADD_TEST(cpp_arraylist_tofu_fixture, cpp_test_arraylist_insert_and_size);
+    FOSSIL_ADD_TEST(cpp_arraylist_tofu_fixture, cpp_test_arraylist_insert_many);
     FOSSIL_ADD_TEST(cpp_arraylist_tofu_fixture, cpp_test_arraylist_remove);
     FOSSIL_ADD_TEST(cpp_arraylist_tofu_fixture, cpp_test_arraylist_get_and_set);
     FOSSIL_ADD_TEST(cpp_arraylist_tofu_fixture, cpp_test_arraylist_get_front_and_back);
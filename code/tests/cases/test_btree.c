@@ -0,0 +1,252 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/tofu/framework.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_SUITE(c_btree_tofu_fixture);
+
+FOSSIL_SETUP(c_btree_tofu_fixture) {
+    // Setup the test fixture
+}
+
+FOSSIL_TEARDOWN(c_btree_tofu_fixture) {
+    // Teardown the test fixture
+}
+
+// Checks node fill, key order and uniform leaf depth below `node`; returns the
+// number of elements under it, or -1 if anything is off.
+static long c_btree_check(const fossil_tofu_btree_node_t* node, bool is_root, size_t depth, size_t* leaf_depth) {
+    if ((!is_root && node->count < FOSSIL_TOFU_BTREE_MIN_KEYS) || node->count > FOSSIL_TOFU_BTREE_ORDER) return -1;
+    for (size_t i = 1; i < node->count; i++) {
+        if (fossil_tofu_compare(&node->keys[i - 1], &node->keys[i]) >= 0) return -1;
+    }
+    if (node->leaf) {
+        if (*leaf_depth == 0) *leaf_depth = depth;
+        return *leaf_depth == depth ? (long)node->count : -1;
+    }
+    long total = 0;
+    for (size_t i = 0; i <= node->count; i++) {
+        long below = c_btree_check(node->children[i], false, depth + 1, leaf_depth);
+        if (below < 0) return -1;
+        total += below;
+    }
+    return total;
+}
+
+static bool c_btree_is_valid(const fossil_tofu_btree_t* tree) {
+    if (tree->root == NULL) return tree->size == 0;
+    size_t leaf_depth = 0;
+    return c_btree_check(tree->root, true, 1, &leaf_depth) == (long)tree->size;
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(c_test_btree_create_and_destroy) {
+    fossil_tofu_btree_t* tree = fossil_tofu_btree_create_container("i32");
+    ASSUME_NOT_CNULL(tree);
+    ASSUME_ITS_EQUAL_CSTR(tree->type, "i32");
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_btree_size(tree), 0);
+    ASSUME_ITS_TRUE(fossil_tofu_btree_is_empty(tree));
+    ASSUME_ITS_CNULL(fossil_tofu_btree_get_front(tree));
+    fossil_tofu_btree_iterator_t it = fossil_tofu_btree_begin(tree);
+    ASSUME_ITS_FALSE(fossil_tofu_btree_iterator_valid(&it));
+    fossil_tofu_btree_destroy(tree);
+}
+
+FOSSIL_TEST(c_test_btree_insert_contains_and_remove) {
+    fossil_tofu_btree_t* tree = fossil_tofu_btree_create_container("i32");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_btree_insert(tree, "20"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_btree_insert(tree, "10"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_btree_insert(tree, "20"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_btree_size(tree), 2);
+    ASSUME_ITS_TRUE(fossil_tofu_btree_contains(tree, "10"));
+    ASSUME_ITS_FALSE(fossil_tofu_btree_contains(tree, "15"));
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_btree_get_front(tree), "10");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_btree_get_back(tree), "20");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_btree_remove(tree, "15"), FOSSIL_TOFU_FAILURE);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_btree_remove(tree, "10"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_btree_remove(tree, "20"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_TRUE(fossil_tofu_btree_is_empty(tree));
+    ASSUME_ITS_CNULL(tree->root);
+    fossil_tofu_btree_destroy(tree);
+}
+
+FOSSIL_TEST(c_test_btree_many_keys_stay_balanced) {
+    enum { COUNT = 5000 };
+    fossil_tofu_btree_t* tree = fossil_tofu_btree_create_container("i32");
+    char buffer[16];
+    // 7919 is prime, so this visits every key once in scattered order
+    for (int i = 0; i < COUNT; i++) {
+        snprintf(buffer, sizeof(buffer), "%d", (i * 7919) % COUNT);
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_btree_insert(tree, buffer), FOSSIL_TOFU_SUCCESS);
+    }
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_btree_size(tree), COUNT);
+    ASSUME_ITS_TRUE(c_btree_is_valid(tree));
+
+    // Remove all multiples of three, forcing borrows and merges
+    for (int i = 0; i < COUNT; i += 3) {
+        snprintf(buffer, sizeof(buffer), "%d", i);
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_btree_remove(tree, buffer), FOSSIL_TOFU_SUCCESS);
+    }
+    ASSUME_ITS_TRUE(c_btree_is_valid(tree));
+    int expected = 1;
+    size_t seen = 0;
+    for (fossil_tofu_btree_iterator_t it = fossil_tofu_btree_begin(tree); fossil_tofu_btree_iterator_valid(&it); fossil_tofu_btree_iterator_next(&it)) {
+        snprintf(buffer, sizeof(buffer), "%d", expected);
+        ASSUME_ITS_EQUAL_CSTR(fossil_tofu_btree_iterator_get(&it), buffer);
+        expected += expected % 3 == 1 ? 1 : 2;
+        seen++;
+    }
+    ASSUME_ITS_EQUAL_SIZE(seen, fossil_tofu_btree_size(tree));
+
+    // Then everything else, down to an empty tree
+    for (int i = COUNT - 1; i >= 0; i--) {
+        if (i % 3 != 0) {
+            snprintf(buffer, sizeof(buffer), "%d", i);
+            ASSUME_ITS_EQUAL_I32(fossil_tofu_btree_remove(tree, buffer), FOSSIL_TOFU_SUCCESS);
+        }
+    }
+    ASSUME_ITS_TRUE(fossil_tofu_btree_is_empty(tree));
+    ASSUME_ITS_TRUE(c_btree_is_valid(tree));
+    fossil_tofu_btree_destroy(tree);
+}
+
+FOSSIL_TEST(c_test_btree_bounds_and_iteration) {
+    enum { COUNT = 1000 };
+    static char storage[COUNT][16];
+    char *data[COUNT];
+    for (int i = 0; i < COUNT; i++) {
+        snprintf(storage[i], sizeof(storage[i]), "%d", i * 2);
+        data[i] = storage[i];
+    }
+    fossil_tofu_btree_t* tree = fossil_tofu_btree_create_container("i32");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_btree_bulk_load(tree, data, COUNT), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_btree_size(tree), COUNT);
+    ASSUME_ITS_TRUE(c_btree_is_valid(tree));
+
+    fossil_tofu_btree_iterator_t it = fossil_tofu_btree_lower_bound(tree, "501");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_btree_iterator_get(&it), "502");
+    it = fossil_tofu_btree_lower_bound(tree, "502");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_btree_iterator_get(&it), "502");
+    it = fossil_tofu_btree_upper_bound(tree, "502");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_btree_iterator_get(&it), "504");
+    fossil_tofu_btree_iterator_prev(&it);
+    fossil_tofu_btree_iterator_prev(&it);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_btree_iterator_get(&it), "500");
+    it = fossil_tofu_btree_lower_bound(tree, "-5");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_btree_iterator_get(&it), "0");
+    it = fossil_tofu_btree_upper_bound(tree, "1998");
+    ASSUME_ITS_FALSE(fossil_tofu_btree_iterator_valid(&it));
+
+    // Walk the whole tree backwards across the leaf links
+    int expected = (COUNT - 1) * 2;
+    for (it = fossil_tofu_btree_rbegin(tree); fossil_tofu_btree_iterator_valid(&it); fossil_tofu_btree_iterator_prev(&it)) {
+        char buffer[16];
+        snprintf(buffer, sizeof(buffer), "%d", expected);
+        ASSUME_ITS_EQUAL_CSTR(fossil_tofu_btree_iterator_get(&it), buffer);
+        expected -= 2;
+    }
+    ASSUME_ITS_EQUAL_I32(expected, -2);
+
+    // The bulk-loaded tree keeps accepting inserts and removes
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_btree_insert(tree, "501"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_btree_remove(tree, "0"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_TRUE(c_btree_is_valid(tree));
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_btree_get_front(tree), "2");
+    fossil_tofu_btree_destroy(tree);
+}
+
+FOSSIL_TEST(c_test_btree_bulk_load_rejects_bad_input) {
+    fossil_tofu_btree_t* tree = fossil_tofu_btree_create_container("cstr");
+    char *unsorted[] = {"apple", "cherry", "banana"};
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_btree_bulk_load(tree, unsorted, 3), FOSSIL_TOFU_FAILURE);
+    ASSUME_ITS_TRUE(fossil_tofu_btree_is_empty(tree));
+
+    char *repeated[] = {"apple", "apple", "banana, long enough to leave inline storage", "cherry"};
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_btree_bulk_load(tree, repeated, 4), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_btree_size(tree), 3);
+    ASSUME_ITS_TRUE(fossil_tofu_btree_contains(tree, "banana, long enough to leave inline storage"));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_btree_bulk_load(tree, repeated, 4), FOSSIL_TOFU_FAILURE);
+    fossil_tofu_btree_destroy(tree);
+}
+
+FOSSIL_TEST(c_test_btree_create_copy_and_move) {
+    fossil_tofu_btree_t* tree = fossil_tofu_btree_create_container("i32");
+    char buffer[16];
+    for (int i = 0; i < 200; i++) {
+        snprintf(buffer, sizeof(buffer), "%d", i);
+        fossil_tofu_btree_insert(tree, buffer);
+    }
+    fossil_tofu_btree_t* copy = fossil_tofu_btree_create_copy(tree);
+    ASSUME_NOT_CNULL(copy);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_btree_size(copy), 200);
+    ASSUME_ITS_TRUE(c_btree_is_valid(copy));
+    fossil_tofu_btree_remove(copy, "100");
+    ASSUME_ITS_TRUE(fossil_tofu_btree_contains(tree, "100"));
+
+    fossil_tofu_btree_t* moved = fossil_tofu_btree_create_move(tree);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_btree_size(moved), 200);
+    ASSUME_ITS_TRUE(fossil_tofu_btree_is_empty(tree));
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_btree_get_back(moved), "199");
+    fossil_tofu_btree_destroy(tree);
+    fossil_tofu_btree_destroy(copy);
+    fossil_tofu_btree_destroy(moved);
+}
+
+FOSSIL_TEST(c_test_btree_rejects_null_type_and_null_move) {
+    ASSUME_ITS_CNULL(fossil_tofu_btree_create_container("null"));
+    ASSUME_ITS_CNULL(fossil_tofu_btree_create_move(NULL));
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_btree_tofu_tests) {    
+    // Generic ToFu Fixture
+    FOSSIL_ADD_TEST(c_btree_tofu_fixture, c_test_btree_create_and_destroy);
+    FOSSIL_ADD_TEST(c_btree_tofu_fixture, c_test_btree_insert_contains_and_remove);
+    FOSSIL_ADD_TEST(c_btree_tofu_fixture, c_test_btree_many_keys_stay_balanced);
+    FOSSIL_ADD_TEST(c_btree_tofu_fixture, c_test_btree_bounds_and_iteration);
+    FOSSIL_ADD_TEST(c_btree_tofu_fixture, c_test_btree_bulk_load_rejects_bad_input);
+    FOSSIL_ADD_TEST(c_btree_tofu_fixture, c_test_btree_create_copy_and_move);
+    FOSSIL_ADD_TEST(c_btree_tofu_fixture, c_test_btree_rejects_null_type_and_null_move);
+
+    // Register the test group
+    FOSSIL_ADD_SUITE(c_btree_tofu_fixture);
+} // end of tests
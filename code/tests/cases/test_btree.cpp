@@ -0,0 +1,99 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/tofu/framework.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_SUITE(cpp_btree_tofu_fixture);
+
+FOSSIL_SETUP(cpp_btree_tofu_fixture) {
+    // Setup the test fixture
+}
+
+FOSSIL_TEARDOWN(cpp_btree_tofu_fixture) {
+    // Teardown the test fixture
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+using fossil::tofu::BTree;
+
+FOSSIL_TEST(cpp_test_btree_insert_and_range) {
+    BTree tree("i32");
+    for (int i = 100; i > 0; i--) {
+        tree.insert(std::to_string(i));
+    }
+    ASSUME_ITS_EQUAL_SIZE(tree.size(), 100);
+    ASSUME_ITS_TRUE(tree.contains("42"));
+    std::vector<std::string> range = tree.range("40", "44");
+    ASSUME_ITS_EQUAL_SIZE(range.size(), 4);
+    ASSUME_ITS_EQUAL_CSTR(range.front().c_str(), "40");
+    ASSUME_ITS_EQUAL_CSTR(range.back().c_str(), "43");
+    tree.remove("42");
+    ASSUME_ITS_FALSE(tree.contains("42"));
+    ASSUME_ITS_EQUAL_CSTR(tree.get_front().c_str(), "1");
+    ASSUME_ITS_EQUAL_CSTR(tree.get_back().c_str(), "100");
+}
+
+FOSSIL_TEST(cpp_test_btree_bulk_load) {
+    BTree tree("cstr");
+    tree.bulk_load({"alpha", "beta", "gamma"});
+    ASSUME_ITS_EQUAL_SIZE(tree.size(), 3);
+    ASSUME_ITS_EQUAL_CSTR(tree.get_front().c_str(), "alpha");
+    bool threw = false;
+    try {
+        tree.bulk_load({"delta"});
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    ASSUME_ITS_TRUE(threw);
+    tree.clear();
+    ASSUME_ITS_TRUE(tree.is_empty());
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_btree_tofu_tests) {    
+    // Generic ToFu Fixture
+    FOSSIL_ADD_TEST(cpp_btree_tofu_fixture, cpp_test_btree_insert_and_range);
+    FOSSIL_ADD_TEST(cpp_btree_tofu_fixture, cpp_test_btree_bulk_load);
+
+    // Register the test group
+    FOSSIL_ADD_SUITE(cpp_btree_tofu_fixture);
+} // end of tests
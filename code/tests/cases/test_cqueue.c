@@ -170,6 +170,79 @@ FOSSIL_TEST(c_test_cqueue_size_consistency) {
     fossil_tofu_cqueue_destroy(queue);
 }
 
+FOSSIL_TEST(c_test_cqueue_wraparound) {
+    fossil_tofu_cqueue_t* queue = fossil_tofu_cqueue_create_container("i32", 3);
+    char buf[16];
+    // Cycle through the slots several times; the rear must track the tail
+    for (int i = 0; i < 10; i++) {
+        snprintf(buf, sizeof(buf), "%d", i);
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_insert(queue, buf), FOSSIL_TOFU_SUCCESS);
+        ASSUME_ITS_EQUAL_CSTR(fossil_tofu_cqueue_get_rear(queue), buf);
+        if (i >= 1) {
+            ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_remove(queue), FOSSIL_TOFU_SUCCESS);
+        }
+    }
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_size(queue), 1);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_cqueue_get_front(queue), "9");
+    ASSUME_ITS_FALSE(fossil_tofu_cqueue_is_full(queue));
+    fossil_tofu_cqueue_destroy(queue);
+}
+
+FOSSIL_TEST(c_test_cqueue_overwrite_oldest_when_full) {
+    fossil_tofu_cqueue_t* queue = fossil_tofu_cqueue_create_overwrite("i32", 3);
+    ASSUME_NOT_CNULL(queue);
+    fossil_tofu_cqueue_insert(queue, "1");
+    fossil_tofu_cqueue_insert(queue, "2");
+    fossil_tofu_cqueue_insert(queue, "3");
+    ASSUME_ITS_TRUE(fossil_tofu_cqueue_is_full(queue));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_insert(queue, "4"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_insert(queue, "5"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_size(queue), 3);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_cqueue_get_front(queue), "3");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_cqueue_get_rear(queue), "5");
+
+    fossil_tofu_cqueue_t* copy = fossil_tofu_cqueue_create_copy(queue);
+    ASSUME_NOT_CNULL(copy);
+    fossil_tofu_cqueue_insert(copy, "6");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_cqueue_get_front(copy), "4");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_cqueue_get_rear(copy), "6");
+    fossil_tofu_cqueue_destroy(copy);
+    fossil_tofu_cqueue_destroy(queue);
+}
+
+FOSSIL_TEST(c_test_cqueue_spsc_push_pop_and_batches) {
+    fossil_tofu_cqueue_spsc_t* queue = fossil_tofu_cqueue_create_spsc("i32", 3);
+    ASSUME_NOT_CNULL(queue);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_spsc_capacity(queue), 3);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_spsc_try_pop(queue, NULL), FOSSIL_TOFU_FAILURE);
+
+    char* batch[] = {"1", "2", "3", "4"};
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_spsc_push_n(queue, batch, 4), 3);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_spsc_try_push(queue, "5"), FOSSIL_TOFU_FAILURE);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_spsc_size(queue), 3);
+
+    fossil_tofu_t element;
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_spsc_try_pop(queue, &element), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&element), "1");
+    fossil_tofu_destroy(&element);
+
+    // Wrap past the end of the slot array
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_spsc_try_push(queue, "5"), FOSSIL_TOFU_SUCCESS);
+    fossil_tofu_t out[4];
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_spsc_pop_n(queue, out, 4), 3);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&out[0]), "2");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&out[2]), "5");
+    for (int i = 0; i < 3; i++) {
+        fossil_tofu_destroy(&out[i]);
+    }
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_spsc_size(queue), 0);
+
+    // Elements left behind are released by destroy
+    fossil_tofu_cqueue_spsc_try_push(queue, "6");
+    fossil_tofu_cqueue_spsc_destroy(queue);
+    ASSUME_ITS_CNULL(fossil_tofu_cqueue_create_spsc("i32", 0));
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -186,6 +259,9 @@ FOSSIL_TEST_GROUP(c_cqueue_tofu_tests) {
     FOSSIL_ADD_TEST(c_cqueue_tofu_fixture, c_test_cqueue_get_front_and_get_rear_empty);
     FOSSIL_ADD_TEST(c_cqueue_tofu_fixture, c_test_cqueue_remove_empty);
     FOSSIL_ADD_TEST(c_cqueue_tofu_fixture, c_test_cqueue_size_consistency);
+    FOSSIL_ADD_TEST(c_cqueue_tofu_fixture, c_test_cqueue_wraparound);
+    FOSSIL_ADD_TEST(c_cqueue_tofu_fixture, c_test_cqueue_overwrite_oldest_when_full);
+    FOSSIL_ADD_TEST(c_cqueue_tofu_fixture, c_test_cqueue_spsc_push_pop_and_batches);
 
     // Register the test group
     FOSSIL_ADD_SUITE(c_cqueue_tofu_fixture);
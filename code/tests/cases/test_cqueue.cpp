@@ -25,6 +25,7 @@
 #include <fossil/maip/framework.h>
 
 #include "fossil/tofu/framework.h"
+#include <thread>
 
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Utilities
@@ -52,6 +53,7 @@ FOSSIL_TEARDOWN(cpp_cqueue_tofu_fixture) {
 // * * * * * * * * * * * * * * * * * * * * * * * *
 
 using fossil::tofu::CQueue;
+using fossil::tofu::SpscCQueue;
 
 FOSSIL_TEST(cpp_test_cqueue_create_container_and_destroy) {
     CQueue queue("i32", 3);
@@ -156,6 +158,43 @@ FOSSIL_TEST(cpp_test_cqueue_size_consistency) {
     ASSUME_ITS_EQUAL_I32(queue.size(), 0);
 }
 
+FOSSIL_TEST(cpp_test_cqueue_overwrite_oldest_when_full) {
+    CQueue queue("i32", 2, true);
+    queue.insert("1");
+    queue.insert("2");
+    ASSUME_ITS_TRUE(queue.is_full());
+    ASSUME_ITS_EQUAL_I32(queue.insert("3"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_CSTR(queue.get_front().c_str(), "2");
+    ASSUME_ITS_EQUAL_CSTR(queue.get_rear().c_str(), "3");
+}
+
+FOSSIL_TEST(cpp_test_cqueue_spsc_threaded_handoff) {
+    SpscCQueue queue("i32", 64);
+    const int count = 100000;
+    std::thread producer([&queue]() {
+        for (int i = 0; i < count; i++) {
+            std::string value = std::to_string(i);
+            while (!queue.try_push(value)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    // Every value must arrive exactly once and in order
+    bool in_order = true;
+    std::string value;
+    for (int expected = 0; expected < count; expected++) {
+        while (!queue.try_pop(value)) {
+            std::this_thread::yield();
+        }
+        if (value != std::to_string(expected)) {
+            in_order = false;
+        }
+    }
+    producer.join();
+    ASSUME_ITS_TRUE(in_order);
+    ASSUME_ITS_EQUAL_I32(queue.size(), 0);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -172,6 +211,8 @@ FOSSIL_TEST_GROUP(cpp_cqueue_tofu_tests) {
     FOSSIL_ADD_TEST(cpp_cqueue_tofu_fixture, cpp_test_cqueue_get_front_and_get_rear_empty);
     FOSSIL_ADD_TEST(cpp_cqueue_tofu_fixture, cpp_test_cqueue_remove_empty);
     FOSSIL_ADD_TEST(cpp_cqueue_tofu_fixture, cpp_test_cqueue_size_consistency);
+    FOSSIL_ADD_TEST(cpp_cqueue_tofu_fixture, cpp_test_cqueue_overwrite_oldest_when_full);
+    FOSSIL_ADD_TEST(cpp_cqueue_tofu_fixture, cpp_test_cqueue_spsc_threaded_handoff);
 
     // Register the test group
     FOSSIL_ADD_SUITE(cpp_cqueue_tofu_fixture);
@@ -167,6 +167,84 @@ FOSSIL_TEST(c_test_dqueue_size_consistency) {
     fossil_tofu_dqueue_destroy(dqueue);
 }
 
+FOSSIL_TEST(c_test_dqueue_ring_wraparound_and_growth) {
+    fossil_tofu_dqueue_t* dqueue = fossil_tofu_dqueue_create_container("i32");
+    char buf[16];
+    // Push from both ends so the front wraps behind slot 0 before growing
+    for (int i = 0; i < 20; i++) {
+        snprintf(buf, sizeof(buf), "%d", i);
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_dqueue_push_back(dqueue, buf), FOSSIL_TOFU_SUCCESS);
+        snprintf(buf, sizeof(buf), "%d", -i - 1);
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_dqueue_push_front(dqueue, buf), FOSSIL_TOFU_SUCCESS);
+    }
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_dqueue_size(dqueue), 40);
+    ASSUME_ITS_EQUAL_I32(dqueue->capacity, 64);
+    for (int i = 0; i < 40; i++) {
+        snprintf(buf, sizeof(buf), "%d", i - 20);
+        ASSUME_ITS_EQUAL_CSTR(fossil_tofu_dqueue_get(dqueue, (size_t)i), buf);
+    }
+    ASSUME_ITS_CNULL(fossil_tofu_dqueue_get(dqueue, 40));
+
+    fossil_tofu_dqueue_set(dqueue, 39, "99");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_dqueue_get_back(dqueue), "99");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_dqueue_pop_back(dqueue), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_dqueue_pop_front(dqueue), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_dqueue_get_front(dqueue), "-19");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_dqueue_get_back(dqueue), "18");
+
+    fossil_tofu_dqueue_t* copy = fossil_tofu_dqueue_create_copy(dqueue);
+    ASSUME_NOT_CNULL(copy);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_dqueue_size(copy), 38);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_dqueue_get(copy, 19), "0");
+    fossil_tofu_dqueue_destroy(copy);
+
+    while (fossil_tofu_dqueue_pop_back(dqueue) == FOSSIL_TOFU_SUCCESS) {
+    }
+    ASSUME_ITS_TRUE(fossil_tofu_dqueue_is_empty(dqueue));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_dqueue_pop_front(dqueue), FOSSIL_TOFU_FAILURE);
+    fossil_tofu_dqueue_destroy(dqueue);
+}
+
+FOSSIL_TEST(c_test_dqueue_work_stealing_ends_and_growth) {
+    fossil_tofu_dqueue_ws_t* dqueue = fossil_tofu_dqueue_create_ws("i32", 2);
+    ASSUME_NOT_CNULL(dqueue);
+    fossil_tofu_t value;
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_dqueue_ws_pop(dqueue, &value), FOSSIL_TOFU_FAILURE);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_dqueue_ws_steal(dqueue, &value), FOSSIL_TOFU_FAILURE);
+
+    char buf[16];
+    // Pushing past the initial ring grows it twice
+    for (int i = 0; i < 7; i++) {
+        snprintf(buf, sizeof(buf), "%d", i);
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_dqueue_ws_push(dqueue, buf), FOSSIL_TOFU_SUCCESS);
+    }
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_dqueue_ws_size(dqueue), 7);
+
+    // The owner takes the newest element, thieves the oldest
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_dqueue_ws_pop(dqueue, &value), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&value), "6");
+    fossil_tofu_destroy(&value);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_dqueue_ws_steal(dqueue, &value), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&value), "0");
+    fossil_tofu_destroy(&value);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_dqueue_ws_steal(dqueue, NULL), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_dqueue_ws_size(dqueue), 4);
+
+    // Drain down to the last element, which goes through the top as well
+    for (int i = 0; i < 3; i++) {
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_dqueue_ws_pop(dqueue, NULL), FOSSIL_TOFU_SUCCESS);
+    }
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_dqueue_ws_pop(dqueue, &value), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&value), "2");
+    fossil_tofu_destroy(&value);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_dqueue_ws_pop(dqueue, &value), FOSSIL_TOFU_FAILURE);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_dqueue_ws_size(dqueue), 0);
+
+    // Elements left behind are released by destroy
+    fossil_tofu_dqueue_ws_push(dqueue, "8");
+    fossil_tofu_dqueue_ws_destroy(dqueue);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -183,6 +261,8 @@ FOSSIL_TEST_GROUP(c_dqueue_tofu_tests) {
     FOSSIL_ADD_TEST(c_dqueue_tofu_fixture, c_test_dqueue_get_front_and_get_back_empty);
     FOSSIL_ADD_TEST(c_dqueue_tofu_fixture, c_test_dqueue_remove_empty);
     FOSSIL_ADD_TEST(c_dqueue_tofu_fixture, c_test_dqueue_size_consistency);
+    FOSSIL_ADD_TEST(c_dqueue_tofu_fixture, c_test_dqueue_ring_wraparound_and_growth);
+    FOSSIL_ADD_TEST(c_dqueue_tofu_fixture, c_test_dqueue_work_stealing_ends_and_growth);
 
     // Register the test group
     FOSSIL_ADD_SUITE(c_dqueue_tofu_fixture);
@@ -25,6 +25,9 @@
 #include <fossil/maip/framework.h>
 
 #include "fossil/tofu/framework.h"
+#include <atomic>
+#include <thread>
+#include <vector>
 
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Utilities
@@ -52,6 +55,7 @@ FOSSIL_TEARDOWN(cpp_dqueue_tofu_fixture) {
 // * * * * * * * * * * * * * * * * * * * * * * * *
 
 using fossil::tofu::DQueue;
+using fossil::tofu::WorkStealingDQueue;
 
 FOSSIL_TEST(cpp_test_dqueue_create_container_and_destroy) {
     DQueue dqueue("i32");
@@ -154,6 +158,73 @@ FOSSIL_TEST(cpp_test_dqueue_size_consistency) {
     ASSUME_ITS_EQUAL_I32(dqueue.size(), 0);
 }
 
+FOSSIL_TEST(cpp_test_dqueue_push_and_pop_both_ends) {
+    DQueue dqueue("i32");
+    dqueue.push_back("2");
+    dqueue.push_front("1");
+    dqueue.push_back("3");
+    ASSUME_ITS_EQUAL_CSTR(dqueue.get(1).c_str(), "2");
+    dqueue.set(1, "20");
+    dqueue.pop_back();
+    ASSUME_ITS_EQUAL_I32(dqueue.size(), 2);
+    ASSUME_ITS_EQUAL_CSTR(dqueue.get_back().c_str(), "20");
+    dqueue.pop_front();
+    dqueue.pop_front();
+    bool threw = false;
+    try {
+        dqueue.pop_back();
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    ASSUME_ITS_TRUE(threw);
+}
+
+FOSSIL_TEST(cpp_test_dqueue_work_stealing_owner_and_thieves) {
+    WorkStealingDQueue dqueue("i64", 4);
+    const long long total = 50000;
+    std::atomic<long long> taken(0);
+    std::atomic<long long> sum(0);
+    std::atomic<bool> done(false);
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < 3; t++) {
+        thieves.emplace_back([&]() {
+            std::string value;
+            while (!done.load()) {
+                if (dqueue.steal(value)) {
+                    sum += std::stoll(value);
+                    taken++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    // The owner pushes in bursts and pops some back, like a task runner
+    std::string value;
+    for (long long i = 0; i < total; i++) {
+        dqueue.push(std::to_string(i));
+        if (i % 3 == 0 && dqueue.pop(value)) {
+            sum += std::stoll(value);
+            taken++;
+        }
+    }
+    while (dqueue.pop(value)) {
+        sum += std::stoll(value);
+        taken++;
+    }
+    while (taken.load() < total) {
+        std::this_thread::yield();
+    }
+    done = true;
+    for (std::thread& thief : thieves) {
+        thief.join();
+    }
+    // Every value 0 .. total-1 must be taken exactly once
+    ASSUME_ITS_TRUE(taken.load() == total);
+    ASSUME_ITS_TRUE(sum.load() == total * (total - 1) / 2);
+    ASSUME_ITS_EQUAL_I32(dqueue.size(), 0);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -170,6 +241,8 @@ FOSSIL_TEST_GROUP(cpp_dqueue_tofu_tests) {
     FOSSIL_ADD_TEST(cpp_dqueue_tofu_fixture, cpp_test_dqueue_get_front_and_get_back_empty);
     FOSSIL_ADD_TEST(cpp_dqueue_tofu_fixture, cpp_test_dqueue_remove_empty);
     FOSSIL_ADD_TEST(cpp_dqueue_tofu_fixture, cpp_test_dqueue_size_consistency);
+    FOSSIL_ADD_TEST(cpp_dqueue_tofu_fixture, cpp_test_dqueue_push_and_pop_both_ends);
+    FOSSIL_ADD_TEST(cpp_dqueue_tofu_fixture, cpp_test_dqueue_work_stealing_owner_and_thieves);
 
     // Register the test group
     FOSSIL_ADD_SUITE(cpp_dqueue_tofu_fixture);
@@ -174,6 +174,19 @@ FOSSIL_TEST(c_test_flist_empty_and_null_checks) {
     fossil_tofu_flist_destroy(flist);
 }
 
+FOSSIL_TEST(c_test_flist_elements_are_typed_values) {
+    fossil_tofu_flist_t* flist = fossil_tofu_flist_create_container("i32");
+    fossil_tofu_flist_insert(flist, "7");
+    fossil_tofu_flist_insert(flist, "a string too long to be stored inline");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_get_type(&flist->head->data), FOSSIL_TOFU_TYPE_I32);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_flist_get_back(flist), "a string too long to be stored inline");
+    fossil_tofu_flist_set_back(flist, "8");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_flist_get_back(flist), "8");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_flist_remove(flist), 0);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_flist_get_front(flist), "8");
+    fossil_tofu_flist_destroy(flist);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -190,6 +203,7 @@ FOSSIL_TEST_GROUP(c_flist_tofu_tests) {
     FOSSIL_ADD_TEST(c_flist_tofu_fixture, c_test_flist_set_front_and_back);
     FOSSIL_ADD_TEST(c_flist_tofu_fixture, c_test_flist_copy_and_move);
     FOSSIL_ADD_TEST(c_flist_tofu_fixture, c_test_flist_empty_and_null_checks);
+    FOSSIL_ADD_TEST(c_flist_tofu_fixture, c_test_flist_elements_are_typed_values);
 
     // Register the test group
     FOSSIL_ADD_SUITE(c_flist_tofu_fixture);
@@ -73,7 +73,7 @@ FOSSIL_TEST(cpp_test_mapof_insert_and_contains) {
     ASSUME_ITS_TRUE(map.contains("10"));
     ASSUME_ITS_EQUAL_I32(map.size(), 1);
     fossil_tofu_t value = map.get("10");
-    ASSUME_ITS_EQUAL_CSTR(value.value.data, "hello");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&value), "hello");
 }
 
 FOSSIL_TEST(cpp_test_mapof_remove) {
@@ -97,8 +97,8 @@ FOSSIL_TEST(cpp_test_mapof_copy_constructor) {
     ASSUME_ITS_TRUE(map2.contains("200"));
     fossil_tofu_t v1 = map2.get("100");
     fossil_tofu_t v2 = map2.get("200");
-    ASSUME_ITS_EQUAL_CSTR(v1.value.data, "alpha");
-    ASSUME_ITS_EQUAL_CSTR(v2.value.data, "beta");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&v1), "alpha");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&v2), "beta");
 }
 
 FOSSIL_TEST(cpp_test_mapof_move_constructor) {
@@ -128,9 +128,9 @@ FOSSIL_TEST(cpp_test_mapof_insert_duplicate) {
     size_t size_before = map.size();
     map.insert("55", "bar"); // Should update value, not add new entry
     size_t size_after = map.size();
-    ASSUME_ITS_MORE_THAN_I32(size_after, size_before);
+    ASSUME_ITS_EQUAL_SIZE(size_after, size_before);
     fossil_tofu_t value = map.get("55");
-    ASSUME_ITS_EQUAL_CSTR(value.value.data, "bar");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&value), "bar");
 }
 
 FOSSIL_TEST(cpp_test_mapof_remove_nonexistent) {
@@ -142,6 +142,23 @@ FOSSIL_TEST(cpp_test_mapof_remove_nonexistent) {
 
 // Null argument tests are not applicable for C++ class usage, as null pointers are not passed.
 
+FOSSIL_TEST(cpp_test_mapof_many_keys) {
+    MapOf map("cstr", "i32");
+    for (int i = 0; i < 5000; i++) {
+        map.insert("key" + std::to_string(i), std::to_string(i));
+    }
+    for (int i = 0; i < 5000; i += 2) {
+        ASSUME_ITS_EQUAL_I32(map.remove("key" + std::to_string(i)), FOSSIL_TOFU_SUCCESS);
+    }
+    ASSUME_ITS_EQUAL_SIZE(map.size(), 2500);
+    for (int i = 0; i < 5000; i++) {
+        ASSUME_ITS_TRUE(map.contains("key" + std::to_string(i)) == (i % 2 == 1));
+    }
+    map.set("key1", "-1");
+    fossil_tofu_t value = map.get("key1");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&value), "-1");
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -156,6 +173,7 @@ FOSSIL_TEST_GROUP(cpp_mapof_tofu_tests) {
     FOSSIL_ADD_TEST(cpp_mapof_tofu_fixture, cpp_test_mapof_is_empty_and_not_empty);
     FOSSIL_ADD_TEST(cpp_mapof_tofu_fixture, cpp_test_mapof_insert_duplicate);
     FOSSIL_ADD_TEST(cpp_mapof_tofu_fixture, cpp_test_mapof_remove_nonexistent);
+    FOSSIL_ADD_TEST(cpp_mapof_tofu_fixture, cpp_test_mapof_many_keys);
 
     // Register the test group
     FOSSIL_ADD_SUITE(cpp_mapof_tofu_fixture);
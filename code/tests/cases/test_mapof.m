@@ -75,7 +75,7 @@ FOSSIL_TEST(objc_test_mapof_insert_and_contains) {
     ASSUME_ITS_TRUE(fossil_tofu_mapof_contains(map, "10"));
     ASSUME_ITS_EQUAL_I32(fossil_tofu_mapof_size(map), 1);
     fossil_tofu_t value = fossil_tofu_mapof_get(map, "10");
-    ASSUME_ITS_EQUAL_CSTR(value.value.data, "hello");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&value), "hello");
     fossil_tofu_mapof_destroy(map);
 }
 
@@ -101,8 +101,8 @@ FOSSIL_TEST(objc_test_mapof_copy_constructor) {
     ASSUME_ITS_TRUE(fossil_tofu_mapof_contains(map2, "200"));
     fossil_tofu_t v1 = fossil_tofu_mapof_get(map2, "100");
     fossil_tofu_t v2 = fossil_tofu_mapof_get(map2, "200");
-    ASSUME_ITS_EQUAL_CSTR(v1.value.data, "alpha");
-    ASSUME_ITS_EQUAL_CSTR(v2.value.data, "beta");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&v1), "alpha");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&v2), "beta");
     fossil_tofu_mapof_destroy(map1);
     fossil_tofu_mapof_destroy(map2);
 }
@@ -137,9 +137,9 @@ FOSSIL_TEST(objc_test_mapof_insert_duplicate) {
     size_t size_before = fossil_tofu_mapof_size(map);
     fossil_tofu_mapof_insert(map, "55", "bar"); // Should update value, not add new entry
     size_t size_after = fossil_tofu_mapof_size(map);
-    ASSUME_ITS_MORE_THAN_I32(size_after, size_before);
+    ASSUME_ITS_EQUAL_SIZE(size_after, size_before);
     fossil_tofu_t value = fossil_tofu_mapof_get(map, "55");
-    ASSUME_ITS_EQUAL_CSTR(value.value.data, "bar");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&value), "bar");
     fossil_tofu_mapof_destroy(map);
 }
 
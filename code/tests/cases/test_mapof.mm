@@ -73,7 +73,7 @@ FOSSIL_TEST(objcpp_test_mapof_insert_and_contains) {
     ASSUME_ITS_TRUE(map.contains("10"));
     ASSUME_ITS_EQUAL_I32(map.size(), 1);
     fossil_tofu_t value = map.get("10");
-    ASSUME_ITS_EQUAL_CSTR(value.value.data, "hello");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&value), "hello");
 }
 
 FOSSIL_TEST(objcpp_test_mapof_remove) {
@@ -97,8 +97,8 @@ FOSSIL_TEST(objcpp_test_mapof_copy_constructor) {
     ASSUME_ITS_TRUE(map2.contains("200"));
     fossil_tofu_t v1 = map2.get("100");
     fossil_tofu_t v2 = map2.get("200");
-    ASSUME_ITS_EQUAL_CSTR(v1.value.data, "alpha");
-    ASSUME_ITS_EQUAL_CSTR(v2.value.data, "beta");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&v1), "alpha");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&v2), "beta");
 }
 
 FOSSIL_TEST(objcpp_test_mapof_move_constructor) {
@@ -128,9 +128,9 @@ FOSSIL_TEST(objcpp_test_mapof_insert_duplicate) {
     size_t size_before = map.size();
     map.insert("55", "bar"); // Should update value, not add new entry
     size_t size_after = map.size();
-    ASSUME_ITS_MORE_THAN_I32(size_after, size_before);
+    ASSUME_ITS_EQUAL_SIZE(size_after, size_before);
     fossil_tofu_t value = map.get("55");
-    ASSUME_ITS_EQUAL_CSTR(value.value.data, "bar");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&value), "bar");
 }
 
 FOSSIL_TEST(objcpp_test_mapof_remove_nonexistent) {
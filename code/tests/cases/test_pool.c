@@ -0,0 +1,123 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/maip/framework.h>
+
+#include "fossil/tofu/framework.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_SUITE(c_pool_tofu_fixture);
+
+FOSSIL_SETUP(c_pool_tofu_fixture) {
+    // Setup the test fixture
+}
+
+FOSSIL_TEARDOWN(c_pool_tofu_fixture) {
+    // Teardown the test fixture
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(c_test_pool_acquire_and_release) {
+    fossil_tofu_pool_t pool;
+    fossil_tofu_pool_init(&pool, 40);
+    ASSUME_ITS_TRUE(pool.slabs == NULL);
+    char* first = (char*)fossil_tofu_pool_acquire(&pool);
+    char* second = (char*)fossil_tofu_pool_acquire(&pool);
+    ASSUME_NOT_CNULL(first);
+    ASSUME_NOT_CNULL(second);
+    ASSUME_ITS_EQUAL_SIZE((size_t)(second - first), pool.object_size);
+    ASSUME_ITS_EQUAL_SIZE((size_t)second % _Alignof(max_align_t), 0);
+    fossil_tofu_pool_release(&pool, first);
+    ASSUME_ITS_TRUE(fossil_tofu_pool_acquire(&pool) == first); // Released objects are reused first
+    fossil_tofu_pool_clear(&pool);
+    ASSUME_ITS_TRUE(pool.slabs == NULL);
+}
+
+FOSSIL_TEST(c_test_pool_slab_growth) {
+    fossil_tofu_pool_t pool;
+    fossil_tofu_pool_init(&pool, sizeof(int));
+    for (int i = 0; i < FOSSIL_TOFU_POOL_FIRST_SLAB; i++) {
+        ASSUME_NOT_CNULL(fossil_tofu_pool_acquire(&pool));
+    }
+    ASSUME_ITS_TRUE(pool.slabs != NULL && pool.slabs->next == NULL);
+    ASSUME_NOT_CNULL(fossil_tofu_pool_acquire(&pool));
+    ASSUME_ITS_TRUE(pool.slabs->next != NULL);
+    ASSUME_ITS_EQUAL_SIZE(pool.slab_objects, FOSSIL_TOFU_POOL_FIRST_SLAB * 4);
+    fossil_tofu_pool_clear(&pool);
+}
+
+FOSSIL_TEST(c_test_pool_move) {
+    fossil_tofu_pool_t src;
+    fossil_tofu_pool_t dest;
+    fossil_tofu_pool_init(&src, 24);
+    fossil_tofu_pool_init(&dest, 24);
+    void* object = fossil_tofu_pool_acquire(&src);
+    fossil_tofu_pool_release(&src, object);
+    fossil_tofu_pool_move(&dest, &src);
+    ASSUME_ITS_TRUE(src.slabs == NULL);
+    ASSUME_ITS_TRUE(fossil_tofu_pool_acquire(&dest) == object);
+    fossil_tofu_pool_clear(&dest);
+}
+
+FOSSIL_TEST(c_test_pool_queue_churn) {
+    fossil_tofu_queue_t* queue = fossil_tofu_queue_create_container("i32");
+    for (int i = 0; i < 8; i++) {
+        fossil_tofu_queue_insert(queue, "1");
+    }
+    fossil_tofu_pool_slab_t* slabs = queue->pool.slabs;
+    for (int i = 0; i < 10000; i++) {
+        fossil_tofu_queue_insert(queue, "2");
+        fossil_tofu_queue_remove(queue);
+    }
+    ASSUME_ITS_TRUE(queue->pool.slabs == slabs); // Churn never grows the pool
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_queue_size(queue), 8);
+    fossil_tofu_queue_destroy(queue);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_pool_tofu_tests) {
+    // Generic ToFu Fixture
+    FOSSIL_ADD_TEST(c_pool_tofu_fixture, c_test_pool_acquire_and_release);
+    FOSSIL_ADD_TEST(c_pool_tofu_fixture, c_test_pool_slab_growth);
+    FOSSIL_ADD_TEST(c_pool_tofu_fixture, c_test_pool_move);
+    FOSSIL_ADD_TEST(c_pool_tofu_fixture, c_test_pool_queue_churn);
+
+    // Register the test group
+    FOSSIL_ADD_SUITE(c_pool_tofu_fixture);
+} // end of tests
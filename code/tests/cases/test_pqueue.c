@@ -168,6 +168,215 @@ FOSSIL_TEST(c_test_pqueue_size_consistency) {
 }
 
 
+FOSSIL_TEST(c_test_pqueue_pop_in_priority_order) {
+    fossil_tofu_pqueue_t* pqueue = fossil_tofu_pqueue_create_container("i32");
+    char value[16];
+    for (int i = 0; i < 500; i++) {
+        int32_t priority = (i * 7919) % 500; // Every priority once, out of order
+        snprintf(value, sizeof(value), "%d", (int)priority);
+        fossil_tofu_pqueue_insert(pqueue, value, priority);
+    }
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_back(pqueue), "499");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_remove(pqueue, 250), FOSSIL_TOFU_SUCCESS);
+    for (int expected = 0; expected < 500; expected++) {
+        if (expected == 250) continue;
+        snprintf(value, sizeof(value), "%d", expected);
+        ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_front(pqueue), value);
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_pop(pqueue), FOSSIL_TOFU_SUCCESS);
+    }
+    ASSUME_ITS_TRUE(fossil_tofu_pqueue_is_empty(pqueue));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_pop(pqueue), FOSSIL_TOFU_FAILURE);
+    fossil_tofu_pqueue_destroy(pqueue);
+}
+
+FOSSIL_TEST(c_test_pqueue_heapify) {
+    fossil_tofu_pqueue_t* pqueue = fossil_tofu_pqueue_create_container("cstr");
+    fossil_tofu_pqueue_insert(pqueue, "middle", 5);
+    char *data[] = {"late", "a label long enough to leave inline storage", "later"};
+    int32_t priorities[] = {8, 1, 9};
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_heapify(pqueue, data, priorities, 3), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_pqueue_size(pqueue), 4);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_front(pqueue), "a label long enough to leave inline storage");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_back(pqueue), "later");
+    fossil_tofu_pqueue_pop(pqueue);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_front(pqueue), "middle");
+    fossil_tofu_pqueue_t* copy = fossil_tofu_pqueue_create_copy(pqueue);
+    fossil_tofu_pqueue_pop(copy);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_front(copy), "late");
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_pqueue_size(pqueue), 3);
+    fossil_tofu_pqueue_destroy(copy);
+    fossil_tofu_pqueue_destroy(pqueue);
+}
+
+FOSSIL_TEST(c_test_pqueue_handles) {
+    fossil_tofu_pqueue_t* pqueue = fossil_tofu_pqueue_create_container("i32");
+    fossil_tofu_pqueue_handle_t ten = fossil_tofu_pqueue_insert_handle(pqueue, "10", 10);
+    fossil_tofu_pqueue_handle_t twenty = fossil_tofu_pqueue_insert_handle(pqueue, "20", 20);
+    fossil_tofu_pqueue_handle_t thirty = fossil_tofu_pqueue_insert_handle(pqueue, "30", 30);
+    ASSUME_ITS_TRUE(ten != FOSSIL_TOFU_PQUEUE_INVALID_HANDLE);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_handle(pqueue, thirty), "30");
+
+    // Decrease-key moves the element to the front, increase-key to the back
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_update_priority(pqueue, thirty, 1), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_front(pqueue), "30");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_update_priority(pqueue, thirty, 40), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_front(pqueue), "10");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_back(pqueue), "30");
+
+    // Removing through a handle leaves the others valid and the old handle stale
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_remove_handle(pqueue, ten), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_pqueue_size(pqueue), 2);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_front(pqueue), "20");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_remove_handle(pqueue, ten), FOSSIL_TOFU_FAILURE);
+    fossil_tofu_pqueue_handle_t reused = fossil_tofu_pqueue_insert_handle(pqueue, "5", 5);
+    ASSUME_ITS_TRUE(reused != ten);
+    ASSUME_ITS_TRUE(fossil_tofu_pqueue_get_handle(pqueue, ten) == NULL);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_update_priority(pqueue, ten, 0), FOSSIL_TOFU_FAILURE);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_handle(pqueue, twenty), "20");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_front(pqueue), "5");
+    fossil_tofu_pqueue_destroy(pqueue);
+}
+
+FOSSIL_TEST(c_test_pqueue_handles_keep_heap_order) {
+    fossil_tofu_pqueue_t* pqueue = fossil_tofu_pqueue_create_container("i32");
+    fossil_tofu_pqueue_handle_t handles[64];
+    char buffer[16];
+    for (int32_t i = 0; i < 64; i++) {
+        snprintf(buffer, sizeof(buffer), "%d", (int)i);
+        handles[i] = fossil_tofu_pqueue_insert_handle(pqueue, buffer, i);
+    }
+    // Reverse the order through decrease-key and drop every fourth element
+    for (int32_t i = 0; i < 64; i++) {
+        if (i % 4 == 0) {
+            fossil_tofu_pqueue_remove_handle(pqueue, handles[i]);
+        } else {
+            fossil_tofu_pqueue_update_priority(pqueue, handles[i], -i);
+        }
+    }
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_pqueue_size(pqueue), 48);
+    int32_t expected = 63;
+    while (!fossil_tofu_pqueue_is_empty(pqueue)) {
+        if (expected % 4 == 0) {
+            expected--;
+        }
+        snprintf(buffer, sizeof(buffer), "%d", (int)expected);
+        ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_front(pqueue), buffer);
+        fossil_tofu_pqueue_pop(pqueue);
+        expected--;
+    }
+    fossil_tofu_pqueue_destroy(pqueue);
+}
+
+FOSSIL_TEST(c_test_pqueue_merge) {
+    fossil_tofu_pqueue_t* dest = fossil_tofu_pqueue_create_container("i32");
+    fossil_tofu_pqueue_t* src = fossil_tofu_pqueue_create_container("i32");
+    fossil_tofu_pqueue_handle_t kept = fossil_tofu_pqueue_insert_handle(dest, "40", 40);
+    fossil_tofu_pqueue_insert(dest, "10", 10);
+    fossil_tofu_pqueue_handle_t moved = fossil_tofu_pqueue_insert_handle(src, "30", 30);
+    fossil_tofu_pqueue_insert(src, "5", 5);
+    fossil_tofu_pqueue_insert(src, "20", 20);
+
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_merge(dest, src), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_pqueue_size(dest), 5);
+    ASSUME_ITS_TRUE(fossil_tofu_pqueue_is_empty(src));
+    ASSUME_ITS_TRUE(fossil_tofu_pqueue_get_handle(src, moved) == NULL);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_handle(dest, kept), "40");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_front(dest), "5");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_back(dest), "40");
+
+    // The drained queue stays usable and merging it back takes its storage whole
+    fossil_tofu_pqueue_insert(src, "1", 1);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_merge(src, dest), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_pqueue_size(src), 6);
+    const char *expected[] = {"1", "5", "10", "20", "30", "40"};
+    for (size_t i = 0; i < 6; i++) {
+        ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_front(src), expected[i]);
+        fossil_tofu_pqueue_pop(src);
+    }
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_merge(src, src), FOSSIL_TOFU_FAILURE);
+    fossil_tofu_pqueue_destroy(dest);
+    fossil_tofu_pqueue_destroy(src);
+}
+
+FOSSIL_TEST(c_test_pqueue_merge_into_empty_and_mismatched) {
+    fossil_tofu_pqueue_t* dest = fossil_tofu_pqueue_create_container("i32");
+    fossil_tofu_pqueue_t* src = fossil_tofu_pqueue_create_container("i32");
+    fossil_tofu_pqueue_t* other = fossil_tofu_pqueue_create_container("cstr");
+    fossil_tofu_pqueue_handle_t handle = fossil_tofu_pqueue_insert_handle(src, "7", 7);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_merge(dest, src), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_front(dest), "7");
+    // src's handles go stale on both queues, even when dest took its storage
+    ASSUME_ITS_CNULL(fossil_tofu_pqueue_get_handle(dest, handle));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_update_priority(dest, handle, 3), FOSSIL_TOFU_FAILURE);
+    fossil_tofu_pqueue_handle_t reused = fossil_tofu_pqueue_insert_handle(src, "8", 8);
+    ASSUME_ITS_TRUE(reused != handle);
+    ASSUME_ITS_CNULL(fossil_tofu_pqueue_get_handle(src, handle));
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_handle(src, reused), "8");
+    fossil_tofu_pqueue_insert(other, "text", 1);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_merge(dest, other), FOSSIL_TOFU_FAILURE);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_pqueue_size(other), 1);
+    fossil_tofu_pqueue_destroy(dest);
+    fossil_tofu_pqueue_destroy(src);
+    fossil_tofu_pqueue_destroy(other);
+}
+
+FOSSIL_TEST(c_test_pqueue_merge_keeps_stale_dest_handles_stale) {
+    fossil_tofu_pqueue_t* dest = fossil_tofu_pqueue_create_container("i32");
+    fossil_tofu_pqueue_t* src = fossil_tofu_pqueue_create_container("i32");
+    fossil_tofu_pqueue_handle_t stale = fossil_tofu_pqueue_insert_handle(dest, "1", 1);
+    fossil_tofu_pqueue_pop(dest);
+    fossil_tofu_pqueue_insert_handle(src, "2", 2);
+    // dest is empty again but has issued a handle, so it must keep its slots
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_merge(dest, src), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_pqueue_size(dest), 1);
+    ASSUME_ITS_CNULL(fossil_tofu_pqueue_get_handle(dest, stale));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_remove_handle(dest, stale), FOSSIL_TOFU_FAILURE);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_pqueue_size(dest), 1);
+    fossil_tofu_pqueue_destroy(dest);
+    fossil_tofu_pqueue_destroy(src);
+}
+
+FOSSIL_TEST(c_test_pqueue_merge_small_into_large) {
+    fossil_tofu_pqueue_t* dest = fossil_tofu_pqueue_create_container("i32");
+    fossil_tofu_pqueue_t* src = fossil_tofu_pqueue_create_container("i32");
+    char buffer[16];
+    for (int32_t i = 0; i < 100; i += 2) {
+        snprintf(buffer, sizeof(buffer), "%d", (int)i);
+        fossil_tofu_pqueue_insert(dest, buffer, i);
+    }
+    fossil_tofu_pqueue_insert(src, "-1", -1);
+    fossil_tofu_pqueue_insert(src, "51", 51);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_merge(dest, src), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_pqueue_size(dest), 52);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_front(dest), "-1");
+    int32_t previous = INT32_MIN;
+    while (!fossil_tofu_pqueue_is_empty(dest)) {
+        int32_t current = (int32_t)strtol(fossil_tofu_pqueue_get_front(dest), NULL, 10);
+        ASSUME_ITS_TRUE(current >= previous);
+        previous = current;
+        fossil_tofu_pqueue_pop(dest);
+    }
+    fossil_tofu_pqueue_destroy(dest);
+    fossil_tofu_pqueue_destroy(src);
+}
+
+FOSSIL_TEST(c_test_pqueue_move_keeps_old_handles_stale_on_source) {
+    fossil_tofu_pqueue_t* pqueue = fossil_tofu_pqueue_create_container("i32");
+    fossil_tofu_pqueue_handle_t retired = fossil_tofu_pqueue_insert_handle(pqueue, "4", 4);
+    fossil_tofu_pqueue_pop(pqueue);
+    fossil_tofu_pqueue_handle_t live = fossil_tofu_pqueue_insert_handle(pqueue, "5", 5);
+    fossil_tofu_pqueue_t* moved = fossil_tofu_pqueue_create_move(pqueue);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_handle(moved, live), "5");
+    // Reusing the moved-from queue must not revive either handle there
+    fossil_tofu_pqueue_insert(pqueue, "99", 99);
+    ASSUME_ITS_CNULL(fossil_tofu_pqueue_get_handle(pqueue, live));
+    ASSUME_ITS_CNULL(fossil_tofu_pqueue_get_handle(pqueue, retired));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_remove_handle(pqueue, live), FOSSIL_TOFU_FAILURE);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_pqueue_size(pqueue), 1);
+    fossil_tofu_pqueue_destroy(moved);
+    fossil_tofu_pqueue_destroy(pqueue);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -184,6 +393,15 @@ FOSSIL_TEST_GROUP(c_pqueue_tofu_tests) {
     FOSSIL_ADD_TEST(c_pqueue_tofu_fixture, c_test_pqueue_get_front_and_get_back_empty);
     FOSSIL_ADD_TEST(c_pqueue_tofu_fixture, c_test_pqueue_remove_empty);
     FOSSIL_ADD_TEST(c_pqueue_tofu_fixture, c_test_pqueue_size_consistency);
+    FOSSIL_ADD_TEST(c_pqueue_tofu_fixture, c_test_pqueue_pop_in_priority_order);
+    FOSSIL_ADD_TEST(c_pqueue_tofu_fixture, c_test_pqueue_heapify);
+    FOSSIL_ADD_TEST(c_pqueue_tofu_fixture, c_test_pqueue_handles);
+    FOSSIL_ADD_TEST(c_pqueue_tofu_fixture, c_test_pqueue_handles_keep_heap_order);
+    FOSSIL_ADD_TEST(c_pqueue_tofu_fixture, c_test_pqueue_merge);
+    FOSSIL_ADD_TEST(c_pqueue_tofu_fixture, c_test_pqueue_merge_into_empty_and_mismatched);
+    FOSSIL_ADD_TEST(c_pqueue_tofu_fixture, c_test_pqueue_merge_keeps_stale_dest_handles_stale);
+    FOSSIL_ADD_TEST(c_pqueue_tofu_fixture, c_test_pqueue_merge_small_into_large);
+    FOSSIL_ADD_TEST(c_pqueue_tofu_fixture, c_test_pqueue_move_keeps_old_handles_stale_on_source);
 
     // Register the test group
     FOSSIL_ADD_SUITE(c_pqueue_tofu_fixture);
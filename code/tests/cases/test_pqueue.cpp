@@ -150,6 +150,49 @@ FOSSIL_TEST(cpp_test_pqueue_size_consistency) {
 }
 
 
+FOSSIL_TEST(cpp_test_pqueue_heapify_and_pop) {
+    PQueue pqueue("i32");
+    pqueue.heapify({"30", "10", "20", "40"}, {3, 1, 2, 4});
+    ASSUME_ITS_EQUAL_SIZE(pqueue.size(), 4);
+    ASSUME_ITS_EQUAL_CSTR(pqueue.get_front().c_str(), "10");
+    pqueue.pop();
+    ASSUME_ITS_EQUAL_CSTR(pqueue.get_front().c_str(), "20");
+    ASSUME_ITS_EQUAL_CSTR(pqueue.get_back().c_str(), "40");
+    ASSUME_ITS_EQUAL_SIZE(pqueue.size(), 3);
+}
+
+FOSSIL_TEST(cpp_test_pqueue_handles) {
+    PQueue pqueue("i32");
+    fossil_tofu_pqueue_handle_t ten = pqueue.insert_handle("10", 10);
+    fossil_tofu_pqueue_handle_t twenty = pqueue.insert_handle("20", 20);
+    pqueue.update_priority(twenty, 1);
+    ASSUME_ITS_EQUAL_CSTR(pqueue.get_front().c_str(), "20");
+    pqueue.remove_handle(twenty);
+    ASSUME_ITS_EQUAL_CSTR(pqueue.get_front().c_str(), "10");
+    ASSUME_ITS_EQUAL_CSTR(pqueue.get_handle(ten).c_str(), "10");
+    ASSUME_ITS_TRUE(pqueue.get_handle(twenty).empty());
+    bool threw = false;
+    try {
+        pqueue.remove_handle(twenty);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    ASSUME_ITS_TRUE(threw);
+}
+
+FOSSIL_TEST(cpp_test_pqueue_merge) {
+    PQueue dest("i32");
+    PQueue src("i32");
+    dest.insert("20", 20);
+    src.insert("10", 10);
+    src.insert("30", 30);
+    dest.merge(src);
+    ASSUME_ITS_EQUAL_SIZE(dest.size(), 3);
+    ASSUME_ITS_TRUE(src.is_empty());
+    ASSUME_ITS_EQUAL_CSTR(dest.get_front().c_str(), "10");
+    ASSUME_ITS_EQUAL_CSTR(dest.get_back().c_str(), "30");
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -165,6 +208,9 @@ FOSSIL_TEST_GROUP(cpp_pqueue_tofu_tests) {
     FOSSIL_ADD_TEST(cpp_pqueue_tofu_fixture, cpp_test_pqueue_get_front_and_get_back_empty);
     FOSSIL_ADD_TEST(cpp_pqueue_tofu_fixture, cpp_test_pqueue_remove_empty);
     FOSSIL_ADD_TEST(cpp_pqueue_tofu_fixture, cpp_test_pqueue_size_consistency);
+    FOSSIL_ADD_TEST(cpp_pqueue_tofu_fixture, cpp_test_pqueue_heapify_and_pop);
+    FOSSIL_ADD_TEST(cpp_pqueue_tofu_fixture, cpp_test_pqueue_handles);
+    FOSSIL_ADD_TEST(cpp_pqueue_tofu_fixture, cpp_test_pqueue_merge);
 
     // Register the test group
     FOSSIL_ADD_SUITE(cpp_pqueue_tofu_fixture);
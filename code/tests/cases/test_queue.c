@@ -166,6 +166,35 @@ FOSSIL_TEST(c_test_queue_size_consistency) {
     fossil_tofu_queue_destroy(queue);
 }
 
+FOSSIL_TEST(c_test_queue_mpmc_bounded_push_and_pop) {
+    fossil_tofu_queue_mpmc_t* queue = fossil_tofu_queue_create_mpmc("i32", 3);
+    ASSUME_NOT_CNULL(queue);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_queue_mpmc_capacity(queue), 4);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_queue_mpmc_try_pop(queue, NULL), FOSSIL_TOFU_FAILURE);
+
+    char buf[16];
+    // Several laps around the slots, keeping the queue full at each step
+    for (int i = 0; i < 4; i++) {
+        snprintf(buf, sizeof(buf), "%d", i);
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_queue_mpmc_try_push(queue, buf), FOSSIL_TOFU_SUCCESS);
+    }
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_queue_mpmc_try_push(queue, "99"), FOSSIL_TOFU_FAILURE);
+    for (int i = 4; i < 12; i++) {
+        fossil_tofu_t element;
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_queue_mpmc_try_pop(queue, &element), FOSSIL_TOFU_SUCCESS);
+        snprintf(buf, sizeof(buf), "%d", i - 4);
+        ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&element), buf);
+        fossil_tofu_destroy(&element);
+        snprintf(buf, sizeof(buf), "%d", i);
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_queue_mpmc_try_push(queue, buf), FOSSIL_TOFU_SUCCESS);
+    }
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_queue_mpmc_size(queue), 4);
+
+    // Elements left behind are released by destroy
+    fossil_tofu_queue_mpmc_destroy(queue);
+    ASSUME_ITS_CNULL(fossil_tofu_queue_create_mpmc("i32", 0));
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -182,6 +211,7 @@ FOSSIL_TEST_GROUP(c_queue_tofu_tests) {
     FOSSIL_ADD_TEST(c_queue_tofu_fixture, c_test_queue_get_front_and_get_rear_empty);
     FOSSIL_ADD_TEST(c_queue_tofu_fixture, c_test_queue_remove_empty);
     FOSSIL_ADD_TEST(c_queue_tofu_fixture, c_test_queue_size_consistency);
+    FOSSIL_ADD_TEST(c_queue_tofu_fixture, c_test_queue_mpmc_bounded_push_and_pop);
 
     // Register the test group
     FOSSIL_ADD_SUITE(c_queue_tofu_fixture);
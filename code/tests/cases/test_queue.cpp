@@ -25,6 +25,9 @@
 #include <fossil/maip/framework.h>
 
 #include "fossil/tofu/framework.h"
+#include <atomic>
+#include <thread>
+#include <vector>
 
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Utilities
@@ -52,6 +55,7 @@ FOSSIL_TEARDOWN(cpp_queue_tofu_fixture) {
 // * * * * * * * * * * * * * * * * * * * * * * * *
 
 using fossil::tofu::Queue;
+using fossil::tofu::MpmcQueue;
 
 FOSSIL_TEST(cpp_test_queue_create_container_and_destroy) {
     Queue queue("i32");
@@ -153,6 +157,44 @@ FOSSIL_TEST(cpp_test_queue_size_consistency) {
     ASSUME_ITS_EQUAL_I32(queue.size(), 0);
 }
 
+FOSSIL_TEST(cpp_test_queue_mpmc_many_producers_and_consumers) {
+    MpmcQueue queue("i64", 128);
+    const int threads = 4;
+    const long long per_producer = 20000;
+    std::atomic<long long> popped(0);
+    std::atomic<long long> sum(0);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&queue, t]() {
+            for (long long i = 0; i < per_producer; i++) {
+                std::string value = std::to_string(t * per_producer + i);
+                while (!queue.try_push(value)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        workers.emplace_back([&queue, &popped, &sum]() {
+            std::string value;
+            while (popped.load() < threads * per_producer) {
+                if (queue.try_pop(value)) {
+                    sum += std::stoll(value);
+                    popped++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    // Every value 0 .. n-1 must be popped exactly once
+    long long n = threads * per_producer;
+    ASSUME_ITS_TRUE(popped.load() == n);
+    ASSUME_ITS_TRUE(sum.load() == n * (n - 1) / 2);
+    ASSUME_ITS_EQUAL_I32(queue.size(), 0);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -169,6 +211,7 @@ FOSSIL_TEST_GROUP(cpp_queue_tofu_tests) {
     FOSSIL_ADD_TEST(cpp_queue_tofu_fixture, cpp_test_queue_get_front_and_get_rear_empty);
     FOSSIL_ADD_TEST(cpp_queue_tofu_fixture, cpp_test_queue_remove_empty);
     FOSSIL_ADD_TEST(cpp_queue_tofu_fixture, cpp_test_queue_size_consistency);
+    FOSSIL_ADD_TEST(cpp_queue_tofu_fixture, cpp_test_queue_mpmc_many_producers_and_consumers);
 
     // Register the test group
     FOSSIL_ADD_SUITE(cpp_queue_tofu_fixture);
@@ -88,9 +88,9 @@ FOSSIL_TEST(cpp_test_setof_insert_duplicate) {
     SetOf set("i32");
     set.insert("55");
     size_t size_before = set.size();
-    set.insert("55"); // Should allow duplicate, as per current implementation
+    set.insert("55"); // Duplicates are ignored
     size_t size_after = set.size();
-    ASSUME_ITS_EQUAL_I32(size_after, size_before + 1);
+    ASSUME_ITS_EQUAL_I32(size_after, size_before);
 }
 
 FOSSIL_TEST(cpp_test_setof_remove_nonexistent) {
@@ -104,6 +104,22 @@ FOSSIL_TEST(cpp_test_setof_remove_nonexistent) {
     }
 }
 
+FOSSIL_TEST(cpp_test_setof_algebra) {
+    SetOf a("cstr");
+    SetOf b("cstr");
+    a.insert("red");
+    a.insert("green");
+    b.insert("green");
+    b.insert("blue");
+    ASSUME_ITS_EQUAL_SIZE(a.set_union(b).size(), 3);
+    SetOf common = a.intersection(b);
+    ASSUME_ITS_EQUAL_SIZE(common.size(), 1);
+    ASSUME_ITS_TRUE(common.contains("green"));
+    ASSUME_ITS_TRUE(a.difference(b).contains("red"));
+    ASSUME_ITS_TRUE(common.is_subset(a));
+    ASSUME_ITS_FALSE(a.is_subset(b));
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -114,6 +130,7 @@ FOSSIL_TEST_GROUP(cpp_setof_tofu_tests) {
     FOSSIL_ADD_TEST(cpp_setof_tofu_fixture, cpp_test_setof_remove);
     FOSSIL_ADD_TEST(cpp_setof_tofu_fixture, cpp_test_setof_is_empty_and_not_empty);
     FOSSIL_ADD_TEST(cpp_setof_tofu_fixture, cpp_test_setof_insert_duplicate);
+    FOSSIL_ADD_TEST(cpp_setof_tofu_fixture, cpp_test_setof_algebra);
     FOSSIL_ADD_TEST(cpp_setof_tofu_fixture, cpp_test_setof_remove_nonexistent);
 
     // Register the test group
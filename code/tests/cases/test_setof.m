@@ -127,9 +127,9 @@ FOSSIL_TEST(objc_test_setof_insert_duplicate) {
     fossil_tofu_setof_t* set = fossil_tofu_setof_create_container("i32");
     fossil_tofu_setof_insert(set, "55");
     size_t size_before = fossil_tofu_setof_size(set);
-    fossil_tofu_setof_insert(set, "55"); // Should allow duplicate, as per current implementation
+    fossil_tofu_setof_insert(set, "55"); // Duplicates are ignored
     size_t size_after = fossil_tofu_setof_size(set);
-    ASSUME_ITS_EQUAL_I32(size_after, size_before + 1);
+    ASSUME_ITS_EQUAL_I32(size_after, size_before);
     fossil_tofu_setof_destroy(set);
 }
 
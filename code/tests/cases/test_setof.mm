@@ -88,9 +88,9 @@ FOSSIL_TEST(objcpp_test_setof_insert_duplicate) {
     SetOf set("i32");
     set.insert("55");
     size_t size_before = set.size();
-    set.insert("55"); // Should allow duplicate, as per current implementation
+    set.insert("55"); // Duplicates are ignored
     size_t size_after = set.size();
-    ASSUME_ITS_EQUAL_I32(size_after, size_before + 1);
+    ASSUME_ITS_EQUAL_I32(size_after, size_before);
 }
 
 FOSSIL_TEST(objcpp_test_setof_remove_nonexistent) {
@@ -43,6 +43,27 @@ FOSSIL_TEARDOWN(c_generic_tofu_fixture) {
     // Teardown the test fixture
 }
 
+// Counting allocator used to check that tofu memory goes through the hooks
+typedef struct {
+    size_t allocs;
+    size_t frees;
+} counting_allocator_t;
+
+static tofu_memory_t counting_alloc(void *context, size_t size) {
+    ((counting_allocator_t *)context)->allocs++;
+    return malloc(size);
+}
+
+static tofu_memory_t counting_realloc(void *context, tofu_memory_t ptr, size_t size) {
+    if (!ptr) ((counting_allocator_t *)context)->allocs++;
+    return realloc(ptr, size);
+}
+
+static void counting_free(void *context, tofu_memory_t ptr) {
+    ((counting_allocator_t *)context)->frees++;
+    free(ptr);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Cases
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -122,6 +143,24 @@ FOSSIL_TEST(c_test_tofu_set_and_get_attribute) {
     fossil_tofu_destroy(&tofu);
 }
 
+FOSSIL_TEST(c_test_tofu_attribute_copy_on_write) {
+    fossil_tofu_t tofu1 = fossil_tofu_from_u8(1);
+    fossil_tofu_t tofu2 = fossil_tofu_from_u8(2);
+    ASSUME_ITS_TRUE(tofu1.attribute.name == tofu2.attribute.name);
+    ASSUME_ITS_FALSE(tofu1.attribute.owned);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_set_attribute(&tofu1, "Custom Name", "Custom Description", "custom_id"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_TRUE(tofu1.attribute.owned);
+    ASSUME_ITS_EQUAL_CSTR(tofu2.attribute.name, "Unsigned 8-bit Integer");
+    fossil_tofu_t *clone = fossil_tofu_clone(&tofu1);
+    ASSUME_NOT_CNULL(clone);
+    ASSUME_ITS_EQUAL_CSTR(clone->attribute.name, "Custom Name");
+    ASSUME_ITS_TRUE(clone->attribute.name != tofu1.attribute.name);
+    fossil_tofu_destroy(clone);
+    fossil_tofu_free(clone);
+    fossil_tofu_destroy(&tofu1);
+    fossil_tofu_destroy(&tofu2);
+}
+
 FOSSIL_TEST(c_test_tofu_validate_type) {
     ASSUME_ITS_EQUAL_I32(fossil_tofu_validate_type("i32"), FOSSIL_TOFU_TYPE_I32);
     ASSUME_ITS_EQUAL_I32(fossil_tofu_validate_type("f64"), FOSSIL_TOFU_TYPE_F64);
@@ -383,6 +422,223 @@ FOSSIL_TEST(c_test_tofu_as_from_any) {
     fossil_tofu_destroy(&tofu);
 }
 
+FOSSIL_TEST(c_test_tofu_native_round_trip) {
+    fossil_tofu_t native = fossil_tofu_from_i32(-42);
+    fossil_tofu_t parsed = fossil_tofu_create("i32", "-42");
+    fossil_tofu_t padded = fossil_tofu_create("i32", "042");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&native), "-42");
+    ASSUME_ITS_TRUE(fossil_tofu_equals(&native, &parsed));
+    ASSUME_ITS_TRUE(native.value.hash == parsed.value.hash);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&padded), "042");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_as_i32(&padded), 42);
+    fossil_tofu_destroy(&native);
+    fossil_tofu_destroy(&parsed);
+    fossil_tofu_destroy(&padded);
+}
+
+FOSSIL_TEST(c_test_tofu_create_typed) {
+    fossil_tofu_t typed = fossil_tofu_create_typed(FOSSIL_TOFU_TYPE_I16, "123");
+    fossil_tofu_t named = fossil_tofu_create("i16", "123");
+    ASSUME_ITS_EQUAL_I32(typed.type, FOSSIL_TOFU_TYPE_I16);
+    ASSUME_ITS_TRUE(fossil_tofu_equals(&typed, &named));
+    ASSUME_ITS_EQUAL_CSTR(typed.attribute.id, "i16");
+    fossil_tofu_t invalid = fossil_tofu_create_typed(FOSSIL_TOFU_TYPE_CNULL, "x");
+    ASSUME_ITS_EQUAL_I32(invalid.type, FOSSIL_TOFU_TYPE_ANY);
+    fossil_tofu_destroy(&typed);
+    fossil_tofu_destroy(&named);
+    fossil_tofu_destroy(&invalid);
+}
+
+FOSSIL_TEST(c_test_tofu_small_string_inline) {
+    fossil_tofu_t small = fossil_tofu_from_cstr("short text");
+    fossil_tofu_t large = fossil_tofu_from_cstr("a string well beyond the inline capacity");
+    ASSUME_ITS_TRUE(small.value.small);
+    ASSUME_ITS_FALSE(large.value.small);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_get_length(&small), 10);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_get_length(&large), 40);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_as_cstr(&small), "short text");
+    fossil_tofu_t *copy = fossil_tofu_create_copy(&small);
+    ASSUME_NOT_CNULL(copy);
+    ASSUME_ITS_TRUE(fossil_tofu_equals(copy, &small));
+    ASSUME_ITS_FALSE(fossil_tofu_equals(&small, &large));
+    fossil_tofu_destroy(copy);
+    fossil_tofu_free(copy);
+    fossil_tofu_destroy(&small);
+    fossil_tofu_destroy(&large);
+}
+
+FOSSIL_TEST(c_test_tofu_create_batch) {
+    const char *values[] = {"7", "short", "a string well beyond the inline capacity", "another string past the inline capacity"};
+    fossil_tofu_t items[4];
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_create_batch(FOSSIL_TOFU_TYPE_CSTR, values, 4, items), FOSSIL_TOFU_SUCCESS);
+    for (size_t i = 0; i < 4; i++) {
+        ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&items[i]), values[i]);
+    }
+    ASSUME_ITS_FALSE(items[1].value.shared);
+    ASSUME_ITS_TRUE(items[2].value.shared);
+    ASSUME_ITS_TRUE(items[3].value.shared);
+    fossil_tofu_destroy(&items[2]);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&items[3]), values[3]);
+    fossil_tofu_destroy(&items[0]);
+    fossil_tofu_destroy(&items[1]);
+    fossil_tofu_destroy(&items[3]);
+    const char *bad[] = {"1", NULL};
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_create_batch(FOSSIL_TOFU_TYPE_I32, bad, 2, items), FOSSIL_TOFU_ERROR_INVALID_ARGUMENT);
+}
+
+FOSSIL_TEST(c_test_tofu_hash64_chunked) {
+    const char *text = "a string long enough to span more than one 32-byte hash stripe";
+    for (size_t len = 0; len <= strlen(text); len++) {
+        char buffer[80];
+        memcpy(buffer, text, len);
+        buffer[len] = '\0';
+        ASSUME_ITS_EQUAL_U64(fossil_tofu_hash64(buffer), fossil_tofu_hash64_seed(buffer, len, 0));
+        if (len > 0) {
+            ASSUME_ITS_TRUE(fossil_tofu_hash64_seed(text, len, 0) != fossil_tofu_hash64_seed(text, len - 1, 0));
+        }
+    }
+    ASSUME_ITS_TRUE(fossil_tofu_hash64_seed(text, 40, 0) != fossil_tofu_hash64_seed(text, 40, 1));
+    ASSUME_ITS_EQUAL_U64(fossil_tofu_hash64(NULL), 0);
+}
+
+FOSSIL_TEST(c_test_tofu_hash_tracks_value) {
+    fossil_tofu_t a = fossil_tofu_create("cstr", "first value");
+    fossil_tofu_t b = fossil_tofu_create("cstr", "second value that is not inline");
+    ASSUME_ITS_FALSE(fossil_tofu_equals(&a, &b));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_set_value(&a, "second value that is not inline"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_U64(a.value.hash, b.value.hash);
+    ASSUME_ITS_TRUE(fossil_tofu_equals(&a, &b));
+    fossil_tofu_t n = fossil_tofu_create("i64", "5");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_set_value(&n, "42"), FOSSIL_TOFU_SUCCESS);
+    fossil_tofu_t m = fossil_tofu_from_i64(42);
+    ASSUME_ITS_EQUAL_U64(n.value.hash, m.value.hash);
+    ASSUME_ITS_TRUE(fossil_tofu_equals(&n, &m));
+    fossil_tofu_destroy(&a);
+    fossil_tofu_destroy(&b);
+    fossil_tofu_destroy(&n);
+    fossil_tofu_destroy(&m);
+}
+
+FOSSIL_TEST(c_test_tofu_custom_allocator) {
+    counting_allocator_t counts = {0, 0};
+    fossil_tofu_allocator_t allocator = {counting_alloc, counting_realloc, counting_free, &counts};
+    fossil_tofu_allocator_t incomplete = {counting_alloc, NULL, counting_free, &counts};
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_set_thread_allocator(&incomplete), FOSSIL_TOFU_ERROR_INVALID_ARGUMENT);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_set_thread_allocator(&allocator), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_TRUE(fossil_tofu_get_allocator()->context == &counts);
+
+    fossil_tofu_t text = fossil_tofu_create("cstr", "a string well beyond the inline capacity");
+    fossil_tofu_t *copy = fossil_tofu_create_copy(&text);
+    fossil_tofu_destroy(copy);
+    fossil_tofu_free(copy);
+    fossil_tofu_destroy(&text);
+    ASSUME_ITS_TRUE(counts.allocs > 0);
+    ASSUME_ITS_EQUAL_SIZE(counts.frees, counts.allocs);
+
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_set_thread_allocator(NULL), FOSSIL_TOFU_SUCCESS);
+    size_t before = counts.allocs;
+    char *dup = fossil_tofu_strdup("default allocator");
+    fossil_tofu_free(dup);
+    ASSUME_ITS_EQUAL_SIZE(counts.allocs, before);
+}
+
+FOSSIL_TEST(c_test_tofu_view_lookups_allocate_nothing) {
+    const char *long_key = "a key well beyond the inline capacity";
+    fossil_tofu_t view = fossil_tofu_view_typed(FOSSIL_TOFU_TYPE_CSTR, long_key);
+    fossil_tofu_t stored = fossil_tofu_create_typed(FOSSIL_TOFU_TYPE_CSTR, long_key);
+    ASSUME_ITS_TRUE(view.value.data == long_key); // Borrowed, not copied
+    ASSUME_ITS_EQUAL_U64(view.value.hash, stored.value.hash);
+    ASSUME_ITS_TRUE(fossil_tofu_equals(&stored, &view));
+    fossil_tofu_destroy(&stored);
+    fossil_tofu_t number = fossil_tofu_view_typed(FOSSIL_TOFU_TYPE_F64, "2.5");
+    fossil_tofu_t stored_number = fossil_tofu_create_typed(FOSSIL_TOFU_TYPE_F64, "2.5");
+    ASSUME_ITS_TRUE(fossil_tofu_equals(&stored_number, &number));
+    fossil_tofu_destroy(&stored_number);
+
+    fossil_tofu_mapof_t* map = fossil_tofu_mapof_create_container("cstr", "i32");
+    fossil_tofu_mapof_insert(map, (char *)long_key, "1");
+    fossil_tofu_setof_t* set = fossil_tofu_setof_create_container("cstr");
+    fossil_tofu_setof_insert(set, (char *)long_key);
+
+    counting_allocator_t counts = {0, 0};
+    fossil_tofu_allocator_t allocator = {counting_alloc, counting_realloc, counting_free, &counts};
+    fossil_tofu_set_thread_allocator(&allocator);
+    ASSUME_ITS_TRUE(fossil_tofu_mapof_contains(map, (char *)long_key));
+    ASSUME_ITS_FALSE(fossil_tofu_mapof_contains(map, "another key well beyond the inline capacity"));
+    fossil_tofu_t value = fossil_tofu_mapof_get(map, (char *)long_key);
+    ASSUME_ITS_TRUE(fossil_tofu_setof_contains(set, (char *)long_key));
+    fossil_tofu_set_thread_allocator(NULL);
+    ASSUME_ITS_EQUAL_SIZE(counts.allocs, 0);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&value), "1");
+
+    fossil_tofu_setof_destroy(set);
+    fossil_tofu_mapof_destroy(map);
+}
+
+FOSSIL_TEST(c_test_tofu_native_compare) {
+    fossil_tofu_t small = fossil_tofu_from_u64(9);
+    fossil_tofu_t large = fossil_tofu_from_u64(18446744073709551615ULL);
+    fossil_tofu_t flag = fossil_tofu_from_bool(true);
+    ASSUME_ITS_TRUE(fossil_tofu_compare(&small, &large) < 0);
+    ASSUME_ITS_TRUE(fossil_tofu_compare(&large, &small) > 0);
+    ASSUME_ITS_EQUAL_U64(fossil_tofu_as_u64(&large), 18446744073709551615ULL);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&flag), "true");
+    ASSUME_ITS_TRUE(fossil_tofu_as_bool(&flag));
+    fossil_tofu_destroy(&small);
+    fossil_tofu_destroy(&large);
+    fossil_tofu_destroy(&flag);
+}
+
+FOSSIL_TEST(c_test_tofu_f32_text_matches_from_f32) {
+    fossil_tofu_t parsed = fossil_tofu_create("f32", "0.1");
+    fossil_tofu_t native = fossil_tofu_from_f32(0.1f);
+    ASSUME_ITS_TRUE(fossil_tofu_equals(&parsed, &native));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_compare(&parsed, &native), 0);
+    ASSUME_ITS_TRUE(parsed.value.hash == native.value.hash);
+    fossil_tofu_destroy(&parsed);
+    fossil_tofu_destroy(&native);
+}
+
+FOSSIL_TEST(c_test_tofu_get_value_does_not_modify) {
+    fossil_tofu_t values[3];
+    values[0] = fossil_tofu_from_i64(-42);
+    values[1] = fossil_tofu_from_f64(1e30);
+    values[2] = fossil_tofu_create("u32", "7");
+    const char *expected[3] = {"-42", NULL, "7"};
+    for (int i = 0; i < 3; i++) {
+        // The text form exists from creation, so reading it leaves the bytes untouched
+        fossil_tofu_t before = values[i];
+        const char *text = fossil_tofu_get_value(&values[i]);
+        ASSUME_NOT_CNULL(text);
+        ASSUME_ITS_TRUE(memcmp(&before, &values[i], sizeof(before)) == 0);
+        if (expected[i] != NULL) {
+            ASSUME_ITS_EQUAL_CSTR(text, expected[i]);
+        }
+        fossil_tofu_destroy(&values[i]);
+    }
+}
+
+FOSSIL_TEST(c_test_tofu_native_text_extremes) {
+    fossil_tofu_t values[5];
+    values[0] = fossil_tofu_from_i64(INT64_MIN);
+    values[1] = fossil_tofu_from_i32(0);
+    values[2] = fossil_tofu_from_u64(UINT64_MAX);
+    values[3] = fossil_tofu_from_char('z');
+    values[4] = fossil_tofu_from_bool(false);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&values[0]), "-9223372036854775808");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&values[1]), "0");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&values[2]), "18446744073709551615");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&values[3]), "z");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&values[4]), "false");
+    for (size_t i = 0; i < 5; i++) {
+        // The rendered text parses back to the same value
+        fossil_tofu_t parsed = fossil_tofu_create_typed(values[i].type, fossil_tofu_get_value(&values[i]));
+        ASSUME_ITS_TRUE(fossil_tofu_equals(&parsed, &values[i]));
+        fossil_tofu_destroy(&parsed);
+        fossil_tofu_destroy(&values[i]);
+    }
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -396,6 +652,7 @@ FOSSIL_TEST_GROUP(c_generic_tofu_tests) {
     FOSSIL_ADD_TEST(c_generic_tofu_fixture, c_test_tofu_mutability);
     FOSSIL_ADD_TEST(c_generic_tofu_fixture, c_test_tofu_type_and_info);
     FOSSIL_ADD_TEST(c_generic_tofu_fixture, c_test_tofu_set_and_get_attribute);
+    FOSSIL_ADD_TEST(c_generic_tofu_fixture, c_test_tofu_attribute_copy_on_write);
     FOSSIL_ADD_TEST(c_generic_tofu_fixture, c_test_tofu_validate_type);
     FOSSIL_ADD_TEST(c_generic_tofu_fixture, c_test_tofu_create_invalid_type);
     FOSSIL_ADD_TEST(c_generic_tofu_fixture, c_test_tofu_compare_equal_and_not_equal);
@@ -433,6 +690,18 @@ FOSSIL_TEST_GROUP(c_generic_tofu_tests) {
     FOSSIL_ADD_TEST(c_generic_tofu_fixture, c_test_tofu_as_from_datetime);
     FOSSIL_ADD_TEST(c_generic_tofu_fixture, c_test_tofu_as_from_duration);
     FOSSIL_ADD_TEST(c_generic_tofu_fixture, c_test_tofu_as_from_any);
+    FOSSIL_ADD_TEST(c_generic_tofu_fixture, c_test_tofu_native_round_trip);
+    FOSSIL_ADD_TEST(c_generic_tofu_fixture, c_test_tofu_native_compare);
+    FOSSIL_ADD_TEST(c_generic_tofu_fixture, c_test_tofu_native_text_extremes);
+    FOSSIL_ADD_TEST(c_generic_tofu_fixture, c_test_tofu_f32_text_matches_from_f32);
+    FOSSIL_ADD_TEST(c_generic_tofu_fixture, c_test_tofu_get_value_does_not_modify);
+    FOSSIL_ADD_TEST(c_generic_tofu_fixture, c_test_tofu_create_typed);
+    FOSSIL_ADD_TEST(c_generic_tofu_fixture, c_test_tofu_small_string_inline);
+    FOSSIL_ADD_TEST(c_generic_tofu_fixture, c_test_tofu_create_batch);
+    FOSSIL_ADD_TEST(c_generic_tofu_fixture, c_test_tofu_hash64_chunked);
+    FOSSIL_ADD_TEST(c_generic_tofu_fixture, c_test_tofu_hash_tracks_value);
+    FOSSIL_ADD_TEST(c_generic_tofu_fixture, c_test_tofu_view_lookups_allocate_nothing);
+    FOSSIL_ADD_TEST(c_generic_tofu_fixture, c_test_tofu_custom_allocator);
 
     // Register the test group
     FOSSIL_ADD_SUITE(c_generic_tofu_fixture);
@@ -25,6 +25,9 @@
 #include <fossil/maip/framework.h>
 
 #include "fossil/tofu/framework.h"
+#include <string>
+#include <thread>
+#include <vector>
 
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Utilities
@@ -43,6 +46,27 @@ FOSSIL_TEARDOWN(cpp_generic_tofu_fixture) {
     // Teardown the test fixture
 }
 
+// Counting allocator used to check that tofu memory goes through the hooks
+typedef struct {
+    size_t allocs;
+    size_t frees;
+} counting_allocator_t;
+
+static tofu_memory_t counting_alloc(void *context, size_t size) {
+    static_cast<counting_allocator_t *>(context)->allocs++;
+    return malloc(size);
+}
+
+static tofu_memory_t counting_realloc(void *context, tofu_memory_t ptr, size_t size) {
+    if (!ptr) static_cast<counting_allocator_t *>(context)->allocs++;
+    return realloc(ptr, size);
+}
+
+static void counting_free(void *context, tofu_memory_t ptr) {
+    static_cast<counting_allocator_t *>(context)->frees++;
+    free(ptr);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Cases
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -141,6 +165,17 @@ FOSSIL_TEST(cpp_test_tofu_set_and_get_attribute) {
     ASSUME_ITS_EQUAL_CSTR(attr->id, "custom_id");
 }
 
+FOSSIL_TEST(cpp_test_tofu_attribute_copy_on_write) {
+    auto tofu1 = fossil::tofu::Tofu::from_u8(1);
+    auto tofu2 = fossil::tofu::Tofu::from_u8(2);
+    ASSUME_ITS_TRUE(tofu1.get_attribute()->name == tofu2.get_attribute()->name);
+    tofu1.set_attribute("Custom Name", "Custom Description", "custom_id");
+    ASSUME_ITS_EQUAL_CSTR(tofu2.get_attribute()->name, "Unsigned 8-bit Integer");
+    fossil::tofu::Tofu copy(tofu1);
+    ASSUME_ITS_EQUAL_CSTR(copy.get_attribute()->name, "Custom Name");
+    ASSUME_ITS_TRUE(copy.get_attribute()->name != tofu1.get_attribute()->name);
+}
+
 FOSSIL_TEST(cpp_test_tofu_validate_type) {
     ASSUME_ITS_EQUAL_I32(fossil_tofu_validate_type("i32"), FOSSIL_TOFU_TYPE_I32);
     ASSUME_ITS_EQUAL_I32(fossil_tofu_validate_type("f64"), FOSSIL_TOFU_TYPE_F64);
@@ -324,6 +359,118 @@ FOSSIL_TEST(cpp_test_tofu_as_from_any) {
     ASSUME_NOT_CNULL(ptr);
 }
 
+FOSSIL_TEST(cpp_test_tofu_native_round_trip) {
+    auto native = fossil::tofu::Tofu::from_i32(-42);
+    fossil::tofu::Tofu parsed("i32", "-42");
+    fossil::tofu::Tofu padded("i32", "042");
+    ASSUME_ITS_EQUAL_CSTR(native.get_value().c_str(), "-42");
+    ASSUME_ITS_TRUE(native == parsed);
+    ASSUME_ITS_EQUAL_CSTR(padded.get_value().c_str(), "042");
+    ASSUME_ITS_EQUAL_I32(padded.as_i32(), 42);
+}
+
+FOSSIL_TEST(cpp_test_tofu_create_typed) {
+    fossil::tofu::Tofu typed(FOSSIL_TOFU_TYPE_I16, "123");
+    fossil::tofu::Tofu named("i16", "123");
+    ASSUME_ITS_TRUE(typed == named);
+    ASSUME_ITS_EQUAL_I32(typed.as_i16(), 123);
+}
+
+FOSSIL_TEST(cpp_test_tofu_small_string_inline) {
+    auto small = fossil::tofu::Tofu::from_cstr("short text");
+    auto large = fossil::tofu::Tofu::from_cstr("a string well beyond the inline capacity");
+    ASSUME_ITS_EQUAL_SIZE(small.get_length(), 10);
+    ASSUME_ITS_EQUAL_SIZE(large.get_length(), 40);
+    fossil::tofu::Tofu copy(small);
+    ASSUME_ITS_EQUAL_CSTR(copy.get_value().c_str(), "short text");
+    ASSUME_ITS_TRUE(copy == small);
+    ASSUME_ITS_FALSE(small == large);
+}
+
+FOSSIL_TEST(cpp_test_tofu_create_batch) {
+    const char *values[] = {"12", "34", "56"};
+    fossil_tofu_t items[3];
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_create_batch(FOSSIL_TOFU_TYPE_I32, values, 3, items), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_as_i32(&items[2]), 56);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&items[0]), "12");
+    for (size_t i = 0; i < 3; i++) {
+        fossil_tofu_destroy(&items[i]);
+    }
+}
+
+FOSSIL_TEST(cpp_test_tofu_hash64_chunked) {
+    std::string text(100, 'x');
+    ASSUME_ITS_EQUAL_U64(fossil_tofu_hash64(text.c_str()), fossil_tofu_hash64_seed(text.data(), text.size(), 0));
+    text[99] = 'y';
+    ASSUME_ITS_TRUE(fossil_tofu_hash64(text.c_str()) != fossil_tofu_hash64_seed(text.data(), 99, 0));
+}
+
+FOSSIL_TEST(cpp_test_tofu_hash_tracks_value) {
+    fossil::tofu::Tofu a("cstr", "before");
+    fossil::tofu::Tofu b("cstr", "after");
+    ASSUME_ITS_FALSE(a == b);
+    a.set_value("after");
+    ASSUME_ITS_TRUE(a == b);
+}
+
+FOSSIL_TEST(cpp_test_tofu_view_typed) {
+    std::string key(40, 'k');
+    fossil_tofu_t view = fossil_tofu_view_typed(FOSSIL_TOFU_TYPE_CSTR, key.c_str());
+    fossil::tofu::Tofu stored(FOSSIL_TOFU_TYPE_CSTR, key);
+    ASSUME_ITS_TRUE(view.value.data == key.c_str());
+    ASSUME_ITS_TRUE(fossil_tofu_equals(&view, &stored.get_c_struct()));
+    fossil_tofu_t number = fossil_tofu_view_typed(FOSSIL_TOFU_TYPE_I32, "-17");
+    fossil::tofu::Tofu stored_number(FOSSIL_TOFU_TYPE_I32, "-17");
+    ASSUME_ITS_TRUE(fossil_tofu_equals(&number, &stored_number.get_c_struct()));
+}
+
+FOSSIL_TEST(cpp_test_tofu_custom_allocator) {
+    counting_allocator_t counts = {0, 0};
+    fossil_tofu_allocator_t allocator = {counting_alloc, counting_realloc, counting_free, &counts};
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_set_allocator(&allocator), FOSSIL_TOFU_SUCCESS);
+    {
+        fossil::tofu::Tofu text("cstr", "a string well beyond the inline capacity");
+        ASSUME_ITS_TRUE(counts.allocs > 0);
+    }
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_set_allocator(nullptr), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_SIZE(counts.frees, counts.allocs);
+}
+
+FOSSIL_TEST(cpp_test_tofu_native_compare) {
+    auto small = fossil::tofu::Tofu::from_u64(9);
+    auto large = fossil::tofu::Tofu::from_u64(18446744073709551615ULL);
+    auto flag = fossil::tofu::Tofu::from_bool(true);
+    ASSUME_ITS_TRUE(small.compare(large) < 0);
+    ASSUME_ITS_TRUE(large.compare(small) > 0);
+    ASSUME_ITS_EQUAL_U64(large.as_u64(), 18446744073709551615ULL);
+    ASSUME_ITS_EQUAL_CSTR(flag.get_value().c_str(), "true");
+    ASSUME_ITS_TRUE(flag.as_bool());
+}
+
+FOSSIL_TEST(cpp_test_tofu_batch_destroyed_across_threads) {
+    // Long values share one block; two threads drop their halves concurrently
+    const size_t count = 512;
+    std::vector<std::string> text(count);
+    std::vector<const char*> values(count);
+    for (size_t i = 0; i < count; i++) {
+        text[i] = "a value long enough to need the heap " + std::to_string(i);
+        values[i] = text[i].c_str();
+    }
+    for (int round = 0; round < 50; round++) {
+        std::vector<fossil_tofu_t> items(count);
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_create_batch(FOSSIL_TOFU_TYPE_CSTR, values.data(), count, items.data()), FOSSIL_TOFU_SUCCESS);
+        std::thread odd([&items, count]() {
+            for (size_t i = 1; i < count; i += 2) {
+                fossil_tofu_destroy(&items[i]);
+            }
+        });
+        for (size_t i = 0; i < count; i += 2) {
+            fossil_tofu_destroy(&items[i]);
+        }
+        odd.join();
+    }
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -341,6 +488,7 @@ FOSSIL_TEST_GROUP(cpp_generic_tofu_tests) {
     FOSSIL_ADD_TEST(cpp_generic_tofu_fixture, cpp_test_tofu_mutability);
     FOSSIL_ADD_TEST(cpp_generic_tofu_fixture, cpp_test_tofu_type_and_info);
     FOSSIL_ADD_TEST(cpp_generic_tofu_fixture, cpp_test_tofu_set_and_get_attribute);
+    FOSSIL_ADD_TEST(cpp_generic_tofu_fixture, cpp_test_tofu_attribute_copy_on_write);
     FOSSIL_ADD_TEST(cpp_generic_tofu_fixture, cpp_test_tofu_validate_type);
     FOSSIL_ADD_TEST(cpp_generic_tofu_fixture, cpp_test_tofu_create_invalid_type);
     FOSSIL_ADD_TEST(cpp_generic_tofu_fixture, cpp_test_tofu_compare_equal_and_not_equal);
@@ -369,6 +517,16 @@ FOSSIL_TEST_GROUP(cpp_generic_tofu_tests) {
     FOSSIL_ADD_TEST(cpp_generic_tofu_fixture, cpp_test_tofu_as_from_datetime);
     FOSSIL_ADD_TEST(cpp_generic_tofu_fixture, cpp_test_tofu_as_from_duration);
     FOSSIL_ADD_TEST(cpp_generic_tofu_fixture, cpp_test_tofu_as_from_any);
+    FOSSIL_ADD_TEST(cpp_generic_tofu_fixture, cpp_test_tofu_native_round_trip);
+    FOSSIL_ADD_TEST(cpp_generic_tofu_fixture, cpp_test_tofu_native_compare);
+    FOSSIL_ADD_TEST(cpp_generic_tofu_fixture, cpp_test_tofu_create_typed);
+    FOSSIL_ADD_TEST(cpp_generic_tofu_fixture, cpp_test_tofu_small_string_inline);
+    FOSSIL_ADD_TEST(cpp_generic_tofu_fixture, cpp_test_tofu_create_batch);
+    FOSSIL_ADD_TEST(cpp_generic_tofu_fixture, cpp_test_tofu_hash64_chunked);
+    FOSSIL_ADD_TEST(cpp_generic_tofu_fixture, cpp_test_tofu_hash_tracks_value);
+    FOSSIL_ADD_TEST(cpp_generic_tofu_fixture, cpp_test_tofu_view_typed);
+    FOSSIL_ADD_TEST(cpp_generic_tofu_fixture, cpp_test_tofu_custom_allocator);
+    FOSSIL_ADD_TEST(cpp_generic_tofu_fixture, cpp_test_tofu_batch_destroyed_across_threads);
 
     // Register the test group
     FOSSIL_ADD_SUITE(cpp_generic_tofu_fixture);
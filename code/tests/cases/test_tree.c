@@ -278,6 +278,197 @@ FOSSIL_TEST(c_test_tree_create_move_nonempty) {
     fossil_tofu_tree_destroy(moved);
 }
 
+// Returns the checked height of `node`, or -1 if a stored height is stale or
+// two sibling subtrees differ in height by more than one.
+static int c_tree_checked_height(const fossil_tofu_tree_node_t *node) {
+    if (!node) return 0;
+    int left = c_tree_checked_height(node->left);
+    int right = c_tree_checked_height(node->right);
+    if (left < 0 || right < 0 || left - right > 1 || right - left > 1) return -1;
+    int height = 1 + (left > right ? left : right);
+    return height == node->height ? height : -1;
+}
+
+FOSSIL_TEST(c_test_tree_sorted_ingest_stays_balanced) {
+    enum { COUNT = 1024 };
+    static fossil_tofu_t values[COUNT];
+    char buffer[16];
+    fossil_tofu_tree_t* tree = fossil_tofu_tree_create("i32");
+    for (int i = 0; i < COUNT; i++) {
+        snprintf(buffer, sizeof(buffer), "%d", i);
+        values[i] = fossil_tofu_create("i32", buffer);
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_tree_insert(tree, &values[i]), FOSSIL_TOFU_SUCCESS);
+    }
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_tree_size(tree), COUNT);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_tree_height(tree), 11);
+    ASSUME_ITS_TRUE(c_tree_checked_height(tree->root) == 11);
+
+    // Remove every other value, including nodes with two children
+    for (int i = 0; i < COUNT; i += 2) {
+        snprintf(buffer, sizeof(buffer), "%d", i);
+        fossil_tofu_t key = fossil_tofu_create("i32", buffer);
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_tree_remove(tree, &key), FOSSIL_TOFU_SUCCESS);
+        fossil_tofu_destroy(&key);
+    }
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_tree_size(tree), COUNT / 2);
+    ASSUME_ITS_TRUE(c_tree_checked_height(tree->root) > 0);
+    ASSUME_ITS_TRUE(fossil_tofu_tree_height(tree) <= 14);
+    for (int i = 0; i < COUNT; i++) {
+        snprintf(buffer, sizeof(buffer), "%d", i);
+        fossil_tofu_t key = fossil_tofu_create("i32", buffer);
+        fossil_tofu_tree_node_t *found = fossil_tofu_tree_search(tree, &key);
+        ASSUME_ITS_TRUE((found != NULL) == (i % 2 == 1));
+        fossil_tofu_destroy(&key);
+    }
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_compare(fossil_tofu_tree_min(tree)->value, &values[1]), 0);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_compare(fossil_tofu_tree_max(tree)->value, &values[COUNT - 1]), 0);
+    fossil_tofu_tree_destroy(tree);
+}
+
+// Returns the checked subtree size of `node`, or SIZE_MAX if a stored count is stale.
+static size_t c_tree_checked_count(const fossil_tofu_tree_node_t *node) {
+    if (!node) return 0;
+    size_t left = c_tree_checked_count(node->left);
+    size_t right = c_tree_checked_count(node->right);
+    if (left == SIZE_MAX || right == SIZE_MAX || node->count != left + right + 1) return SIZE_MAX;
+    return node->count;
+}
+
+FOSSIL_TEST(c_test_tree_rank_select_and_count_range) {
+    enum { COUNT = 100 };
+    static fossil_tofu_t values[COUNT];
+    char buffer[16];
+    fossil_tofu_tree_t* tree = fossil_tofu_tree_create("i32");
+    // Keys 0, 10, ..., 990 in scattered order (37 is coprime with 100)
+    for (int i = 0; i < COUNT; i++) {
+        snprintf(buffer, sizeof(buffer), "%d", ((i * 37) % COUNT) * 10);
+        values[i] = fossil_tofu_create("i32", buffer);
+        fossil_tofu_tree_insert(tree, &values[i]);
+    }
+    ASSUME_ITS_TRUE(c_tree_checked_count(tree->root) == COUNT);
+
+    fossil_tofu_t probe = fossil_tofu_create("i32", "250");
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_tree_rank(tree, &probe), 25);
+    fossil_tofu_destroy(&probe);
+    probe = fossil_tofu_create("i32", "255");
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_tree_rank(tree, &probe), 26);
+    fossil_tofu_destroy(&probe);
+    for (size_t k = 0; k < COUNT; k++) {
+        fossil_tofu_tree_node_t *node = fossil_tofu_tree_select(tree, k);
+        ASSUME_NOT_CNULL(node);
+        snprintf(buffer, sizeof(buffer), "%d", (int)k * 10);
+        ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(node->value), buffer);
+    }
+    ASSUME_ITS_CNULL(fossil_tofu_tree_select(tree, COUNT));
+
+    fossil_tofu_t lo = fossil_tofu_create("i32", "100");
+    fossil_tofu_t hi = fossil_tofu_create("i32", "195");
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_tree_count_range(tree, &lo, &hi), 10);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_tree_count_range(tree, &hi, &lo), 0);
+
+    // Removing updates every subtree size on the way back up
+    fossil_tofu_t gone = fossil_tofu_create("i32", "150");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_tree_remove(tree, &gone), FOSSIL_TOFU_SUCCESS);
+    fossil_tofu_destroy(&gone);
+    ASSUME_ITS_TRUE(c_tree_checked_count(tree->root) == COUNT - 1);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_tree_count_range(tree, &lo, &hi), 9);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(fossil_tofu_tree_select(tree, 15)->value), "160");
+    fossil_tofu_destroy(&lo);
+    fossil_tofu_destroy(&hi);
+    fossil_tofu_tree_destroy(tree);
+}
+
+typedef struct {
+    int seen[8];
+    size_t count;
+    size_t limit;
+} c_tree_collector_t;
+
+static bool c_tree_collect(fossil_tofu_t *value, void *context) {
+    c_tree_collector_t *collector = (c_tree_collector_t *)context;
+    collector->seen[collector->count++] = (int)strtol(fossil_tofu_get_value(value), NULL, 10);
+    return collector->count < collector->limit;
+}
+
+FOSSIL_TEST(c_test_tree_cursor_and_context_traversal) {
+    static fossil_tofu_t values[7];
+    const char *keys[] = {"40", "20", "60", "10", "30", "50", "70"};
+    fossil_tofu_tree_t* tree = fossil_tofu_tree_create("i32");
+    for (int i = 0; i < 7; i++) {
+        values[i] = fossil_tofu_create("i32", (char *)keys[i]);
+        fossil_tofu_tree_insert(tree, &values[i]);
+    }
+
+    // Cursor: a full walk, then a page starting from a seek
+    fossil_tofu_tree_iter_t iter;
+    fossil_tofu_tree_iter_begin(tree, &iter);
+    int expected = 10;
+    fossil_tofu_tree_node_t *node;
+    while ((node = fossil_tofu_tree_iter_next(&iter)) != NULL) {
+        ASSUME_ITS_EQUAL_I32((int)strtol(fossil_tofu_get_value(node->value), NULL, 10), expected);
+        expected += 10;
+    }
+    ASSUME_ITS_EQUAL_I32(expected, 80);
+    fossil_tofu_t probe = fossil_tofu_create("i32", "35");
+    ASSUME_ITS_TRUE(fossil_tofu_tree_iter_seek(tree, &iter, &probe));
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(fossil_tofu_tree_iter_next(&iter)->value), "40");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(fossil_tofu_tree_iter_next(&iter)->value), "50");
+    fossil_tofu_destroy(&probe);
+    probe = fossil_tofu_create("i32", "71");
+    ASSUME_ITS_FALSE(fossil_tofu_tree_iter_seek(tree, &iter, &probe));
+    ASSUME_ITS_CNULL(fossil_tofu_tree_iter_next(&iter));
+    fossil_tofu_destroy(&probe);
+
+    // Context callbacks: orders, and stopping early
+    c_tree_collector_t collector = { {0}, 0, 8 };
+    ASSUME_ITS_TRUE(fossil_tofu_tree_traverse_preorder_ctx(tree->root, c_tree_collect, &collector));
+    ASSUME_ITS_EQUAL_I32(collector.seen[0], 40);
+    ASSUME_ITS_EQUAL_I32(collector.seen[1], 20);
+    ASSUME_ITS_EQUAL_I32(collector.seen[2], 10);
+    ASSUME_ITS_EQUAL_I32(collector.seen[6], 70);
+    collector.count = 0;
+    ASSUME_ITS_TRUE(fossil_tofu_tree_traverse_postorder_ctx(tree->root, c_tree_collect, &collector));
+    ASSUME_ITS_EQUAL_I32(collector.seen[0], 10);
+    ASSUME_ITS_EQUAL_I32(collector.seen[2], 20);
+    ASSUME_ITS_EQUAL_I32(collector.seen[6], 40);
+    collector.count = 0;
+    collector.limit = 3;
+    ASSUME_ITS_FALSE(fossil_tofu_tree_traverse_ctx(tree, c_tree_collect, &collector));
+    ASSUME_ITS_EQUAL_SIZE(collector.count, 3);
+    ASSUME_ITS_EQUAL_I32(collector.seen[2], 30);
+    fossil_tofu_tree_destroy(tree);
+}
+
+static bool c_tree_count_visit(fossil_tofu_t *value, void *context) {
+    (void)value;
+    (*(size_t *)context)++;
+    return true;
+}
+
+FOSSIL_TEST(c_test_tree_traverse_deep_subtree_stops_cleanly) {
+    // A hand-linked spine far deeper than any balanced tree, with a right leaf on every level
+    enum { SPINE = FOSSIL_TOFU_TREE_MAX_HEIGHT * 2 };
+    static fossil_tofu_tree_node_t spine[SPINE];
+    static fossil_tofu_tree_node_t leaves[SPINE];
+    fossil_tofu_t value = fossil_tofu_create("i32", "1");
+    for (size_t i = 0; i < SPINE; i++) {
+        leaves[i] = (fossil_tofu_tree_node_t){ &value, NULL, NULL, 1, 1 };
+        spine[i] = (fossil_tofu_tree_node_t){ &value, i + 1 < SPINE ? &spine[i + 1] : NULL, &leaves[i], 0, 0 };
+    }
+
+    size_t visited = 0;
+    ASSUME_ITS_FALSE(fossil_tofu_tree_traverse_inorder_ctx(&spine[0], c_tree_count_visit, &visited));
+    ASSUME_ITS_FALSE(fossil_tofu_tree_traverse_preorder_ctx(&spine[0], c_tree_count_visit, &visited));
+    ASSUME_ITS_FALSE(fossil_tofu_tree_traverse_postorder_ctx(&spine[0], c_tree_count_visit, &visited));
+    ASSUME_ITS_TRUE(visited < SPINE * 2);
+
+    // A subtree within the bound is still walked in full
+    visited = 0;
+    ASSUME_ITS_TRUE(fossil_tofu_tree_traverse_preorder_ctx(&spine[SPINE - 10], c_tree_count_visit, &visited));
+    ASSUME_ITS_EQUAL_SIZE(visited, 20);
+    fossil_tofu_destroy(&value);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -303,6 +494,10 @@ FOSSIL_TEST_GROUP(c_tree_tofu_tests) {
     FOSSIL_ADD_TEST(c_tree_tofu_fixture, c_test_tree_create_copy_nonempty);
     FOSSIL_ADD_TEST(c_tree_tofu_fixture, c_test_tree_create_move_null);
     FOSSIL_ADD_TEST(c_tree_tofu_fixture, c_test_tree_create_move_nonempty);
+    FOSSIL_ADD_TEST(c_tree_tofu_fixture, c_test_tree_sorted_ingest_stays_balanced);
+    FOSSIL_ADD_TEST(c_tree_tofu_fixture, c_test_tree_rank_select_and_count_range);
+    FOSSIL_ADD_TEST(c_tree_tofu_fixture, c_test_tree_cursor_and_context_traversal);
+    FOSSIL_ADD_TEST(c_tree_tofu_fixture, c_test_tree_traverse_deep_subtree_stops_cleanly);
 
     FOSSIL_ADD_SUITE(c_tree_tofu_fixture);
 } // end of tests
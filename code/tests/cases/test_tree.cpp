@@ -103,6 +103,25 @@ FOSSIL_TEST(cpp_test_tree_create_copy_empty) {
     ASSUME_ITS_EQUAL_I32(copy.size(), 0);
 }
 
+FOSSIL_TEST(cpp_test_tree_order_statistics_empty) {
+    Tree tree("i32");
+    Tofu lo("i32", "1");
+    Tofu hi("i32", "9");
+    ASSUME_ITS_EQUAL_SIZE(tree.rank(lo), 0);
+    ASSUME_ITS_CNULL(tree.select(0));
+    ASSUME_ITS_EQUAL_SIZE(tree.count_range(lo, hi), 0);
+}
+
+FOSSIL_TEST(cpp_test_tree_traverse_until_empty) {
+    Tree tree("i32");
+    size_t visited = 0;
+    ASSUME_ITS_TRUE(tree.traverse_until([&visited](fossil_tofu_t*) {
+        visited++;
+        return true;
+    }));
+    ASSUME_ITS_EQUAL_SIZE(visited, 0);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -115,6 +134,8 @@ FOSSIL_TEST_GROUP(cpp_tree_tofu_tests) {
     FOSSIL_ADD_TEST(cpp_tree_tofu_fixture, cpp_test_tree_create_default);
     FOSSIL_ADD_TEST(cpp_tree_tofu_fixture, cpp_test_tree_create_copy_null);
     FOSSIL_ADD_TEST(cpp_tree_tofu_fixture, cpp_test_tree_create_copy_empty);
+    FOSSIL_ADD_TEST(cpp_tree_tofu_fixture, cpp_test_tree_order_statistics_empty);
+    FOSSIL_ADD_TEST(cpp_tree_tofu_fixture, cpp_test_tree_traverse_until_empty);
 
     FOSSIL_ADD_SUITE(cpp_tree_tofu_fixture);
 } // end of tests
@@ -71,6 +71,18 @@ FOSSIL_TEST(c_test_vector_push_and_get) {
     fossil_tofu_vector_destroy(vector);
 }
 
+FOSSIL_TEST(c_test_vector_push_back_many) {
+    fossil_tofu_vector_t* vector = fossil_tofu_vector_create_container("cstr");
+    char *elements[] = {"one", "a string well beyond the inline capacity", "three"};
+    fossil_tofu_vector_push_back(vector, "zero");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_vector_push_back_many(vector, elements, 3), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_vector_size(vector), 4);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_vector_get(vector, 0), "zero");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_vector_get(vector, 2), "a string well beyond the inline capacity");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_vector_get(vector, 3), "three");
+    fossil_tofu_vector_destroy(vector);
+}
+
 FOSSIL_TEST(c_test_vector_push_front_and_pop_front) {
     fossil_tofu_vector_t* vector = fossil_tofu_vector_create_container("i32");
     fossil_tofu_vector_push_front(vector, "1");
@@ -243,6 +255,7 @@ FOSSIL_TEST_GROUP(c_vector_tofu_tests) {
     // Generic ToFu Fixture
     FOSSIL_ADD_TEST(c_vector_tofu_fixture, c_test_vector_create_and_destroy);
     FOSSIL_ADD_TEST(c_vector_tofu_fixture, c_test_vector_push_and_get);
+    FOSSIL_ADD_TEST(c_vector_tofu_fixture, c_test_vector_push_back_many);
     FOSSIL_ADD_TEST(c_vector_tofu_fixture, c_test_vector_push_front_and_pop_front);
     FOSSIL_ADD_TEST(c_vector_tofu_fixture, c_test_vector_push_at_and_pop_at);
     FOSSIL_ADD_TEST(c_vector_tofu_fixture, c_test_vector_set_and_get);
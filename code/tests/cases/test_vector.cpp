@@ -69,6 +69,14 @@ FOSSIL_TEST(cpp_test_vector_push_and_get) {
     ASSUME_ITS_EQUAL_CSTR(vector.get(2).c_str(), "30");
 }
 
+FOSSIL_TEST(cpp_test_vector_push_back_many) {
+    Vector vector("i32");
+    vector.push_back_many({"10", "20", "30"});
+    ASSUME_ITS_EQUAL_I32(vector.size(), 3);
+    ASSUME_ITS_EQUAL_CSTR(vector.get(0).c_str(), "10");
+    ASSUME_ITS_EQUAL_CSTR(vector.get(2).c_str(), "30");
+}
+
 FOSSIL_TEST(cpp_test_vector_push_front_and_pop_front) {
     Vector vector("i32");
     vector.push_front("1");
@@ -221,6 +229,7 @@ FOSSIL_TEST_GROUP(cpp_vector_tofu_tests) {
     // Generic ToFu Fixture
     FOSSIL_ADD_TEST(cpp_vector_tofu_fixture, cpp_test_vector_create_and_destroy);
     FOSSIL_ADD_TEST(cpp_vector_tofu_fixture, cpp_test_vector_push_and_get);
+    FOSSIL_ADD_TEST(cpp_vector_tofu_fixture, cpp_test_vector_push_back_many);
     FOSSIL_ADD_TEST(cpp_vector_tofu_fixture, cpp_test_vector_push_front_and_pop_front);
     FOSSIL_ADD_TEST(cpp_vector_tofu_fixture, cpp_test_vector_push_at_and_pop_at);
     FOSSIL_ADD_TEST(cpp_vector_tofu_fixture, cpp_test_vector_set_and_get);
@@ -26,6 +26,8 @@ FOSSIL_TEST_EXPORT(c_clist_tofu_tests);
 FOSSIL_TEST_EXPORT(c_array_tofu_tests);
 FOSSIL_TEST_EXPORT(cpp_tree_tofu_tests);
 FOSSIL_TEST_EXPORT(c_tree_tofu_tests);
+FOSSIL_TEST_EXPORT(cpp_btree_tofu_tests);
+FOSSIL_TEST_EXPORT(c_btree_tofu_tests);
 FOSSIL_TEST_EXPORT(cpp_dqueue_tofu_tests);
 FOSSIL_TEST_EXPORT(c_tuple_tofu_tests);
 FOSSIL_TEST_EXPORT(c_stack_tofu_tests);
@@ -37,6 +39,9 @@ FOSSIL_TEST_EXPORT(cpp_vector_tofu_tests);
 FOSSIL_TEST_EXPORT(cpp_flist_tofu_tests);
 FOSSIL_TEST_EXPORT(cpp_generic_tofu_tests);
 FOSSIL_TEST_EXPORT(cpp_cqueue_tofu_tests);
+FOSSIL_TEST_EXPORT(c_arena_tofu_tests);
+FOSSIL_TEST_EXPORT(cpp_arena_tofu_tests);
+FOSSIL_TEST_EXPORT(c_pool_tofu_tests);
 
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Runner
@@ -64,6 +69,8 @@ int main(int argc, char **argv) {
     FOSSIL_TEST_IMPORT(c_array_tofu_tests);
     FOSSIL_TEST_IMPORT(cpp_tree_tofu_tests);
     FOSSIL_TEST_IMPORT(c_tree_tofu_tests);
+    FOSSIL_TEST_IMPORT(cpp_btree_tofu_tests);
+    FOSSIL_TEST_IMPORT(c_btree_tofu_tests);
     FOSSIL_TEST_IMPORT(cpp_dqueue_tofu_tests);
     FOSSIL_TEST_IMPORT(c_tuple_tofu_tests);
     FOSSIL_TEST_IMPORT(c_stack_tofu_tests);
@@ -75,6 +82,9 @@ int main(int argc, char **argv) {
     FOSSIL_TEST_IMPORT(cpp_flist_tofu_tests);
     FOSSIL_TEST_IMPORT(cpp_generic_tofu_tests);
     FOSSIL_TEST_IMPORT(cpp_cqueue_tofu_tests);
+    FOSSIL_TEST_IMPORT(c_arena_tofu_tests);
+    FOSSIL_TEST_IMPORT(cpp_arena_tofu_tests);
+    FOSSIL_TEST_IMPORT(c_pool_tofu_tests);
 
     FOSSIL_RUN_ALL();
     FOSSIL_SUMMARY();